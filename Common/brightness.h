@@ -0,0 +1,26 @@
+// Perceptual brightness curves
+//
+// The tables in brightness_tables.h (generated by gen_brightness.py) map a
+// step index to a PWM compare value between 0 and BRIGHTNESS_TOP. The program
+// defines BRIGHTNESS_TOP as its PWM resolution (timer ticks, slots or levels)
+// before including this header, and gets the tables made for it, so stepping
+// the brightness is one indexed load whatever the curve and no value needs
+// scaling. The tables are static const, so they live in flash/FRAM and only
+// the ones a program uses are kept.
+
+#ifndef BRIGHTNESS_H
+#define BRIGHTNESS_H
+
+#ifndef BRIGHTNESS_TOP
+#error "define BRIGHTNESS_TOP, the PWM compare value of full brightness, before including brightness.h"
+#endif
+
+#include "brightness_tables.h"
+
+// Selects a table by curve (Linear, Gamma, Log, Cie) and step count (11, 64, 256)
+#define BRIGHTNESS_TABLE(curve, steps) brightness##curve##steps
+
+// Number of steps in a table selected with BRIGHTNESS_TABLE()
+#define BRIGHTNESS_STEPS(table) (sizeof(table) / sizeof((table)[0]))
+
+#endif
@@ -0,0 +1,1407 @@
+// Generated by gen_brightness.py --top 100,125,255,999,1000,1500,1998,2000,3125 --steps 11,64,256 --curves Linear,Gamma,Log,Cie --gamma 2.2 --k 3
+// Do not edit by hand, rerun the generator instead.
+
+#ifndef BRIGHTNESS_TABLES_H
+#define BRIGHTNESS_TABLES_H
+
+#include <stdint.h>
+
+#if BRIGHTNESS_TOP == 100
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 2, 3, 5, 6, 8, 10, 11, 13, 14, 16, 17,
+    19, 21, 22, 24, 25, 27, 29, 30, 32, 33, 35, 37,
+    38, 40, 41, 43, 44, 46, 48, 49, 51, 52, 54, 56,
+    57, 59, 60, 62, 63, 65, 67, 68, 70, 71, 73, 75,
+    76, 78, 79, 81, 83, 84, 86, 87, 89, 90, 92, 94,
+    95, 97, 98, 100
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4,
+    5, 5, 5, 6, 6, 7, 7, 7, 8, 8, 9, 9,
+    9, 10, 10, 11, 11, 11, 12, 12, 13, 13, 13, 14,
+    14, 15, 15, 15, 16, 16, 16, 17, 17, 18, 18, 18,
+    19, 19, 20, 20, 20, 21, 21, 22, 22, 22, 23, 23,
+    24, 24, 24, 25, 25, 25, 26, 26, 27, 27, 27, 28,
+    28, 29, 29, 29, 30, 30, 31, 31, 31, 32, 32, 33,
+    33, 33, 34, 34, 35, 35, 35, 36, 36, 36, 37, 37,
+    38, 38, 38, 39, 39, 40, 40, 40, 41, 41, 42, 42,
+    42, 43, 43, 44, 44, 44, 45, 45, 45, 46, 46, 47,
+    47, 47, 48, 48, 49, 49, 49, 50, 50, 51, 51, 51,
+    52, 52, 53, 53, 53, 54, 54, 55, 55, 55, 56, 56,
+    56, 57, 57, 58, 58, 58, 59, 59, 60, 60, 60, 61,
+    61, 62, 62, 62, 63, 63, 64, 64, 64, 65, 65, 65,
+    66, 66, 67, 67, 67, 68, 68, 69, 69, 69, 70, 70,
+    71, 71, 71, 72, 72, 73, 73, 73, 74, 74, 75, 75,
+    75, 76, 76, 76, 77, 77, 78, 78, 78, 79, 79, 80,
+    80, 80, 81, 81, 82, 82, 82, 83, 83, 84, 84, 84,
+    85, 85, 85, 86, 86, 87, 87, 87, 88, 88, 89, 89,
+    89, 90, 90, 91, 91, 91, 92, 92, 93, 93, 93, 94,
+    94, 95, 95, 95, 96, 96, 96, 97, 97, 98, 98, 98,
+    99, 99, 100, 100
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 1, 3, 7, 13, 22, 33, 46, 61, 79, 100
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+    3, 3, 4, 4, 5, 6, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 16, 17, 18, 20, 21, 23, 24, 26, 27,
+    29, 31, 33, 35, 37, 39, 41, 43, 45, 48, 50, 52,
+    55, 58, 60, 63, 66, 68, 71, 74, 77, 80, 83, 87,
+    90, 93, 97, 100
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8,
+    9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11,
+    12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15,
+    15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19,
+    19, 19, 20, 20, 20, 21, 21, 22, 22, 22, 23, 23,
+    23, 24, 24, 25, 25, 25, 26, 26, 27, 27, 28, 28,
+    28, 29, 29, 30, 30, 31, 31, 32, 32, 33, 33, 33,
+    34, 34, 35, 35, 36, 36, 37, 37, 38, 38, 39, 39,
+    40, 40, 41, 42, 42, 43, 43, 44, 44, 45, 45, 46,
+    46, 47, 48, 48, 49, 49, 50, 51, 51, 52, 52, 53,
+    54, 54, 55, 55, 56, 57, 57, 58, 59, 59, 60, 61,
+    61, 62, 63, 63, 64, 65, 65, 66, 67, 67, 68, 69,
+    69, 70, 71, 72, 72, 73, 74, 74, 75, 76, 77, 77,
+    78, 79, 80, 80, 81, 82, 83, 84, 84, 85, 86, 87,
+    88, 88, 89, 90, 91, 92, 92, 93, 94, 95, 96, 97,
+    97, 98, 99, 100
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 7, 9, 12, 17, 22, 30, 41, 55, 74, 100
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8,
+    9, 9, 10, 10, 11, 11, 12, 12, 13, 14, 14, 15,
+    16, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    28, 29, 30, 32, 33, 35, 37, 39, 40, 42, 45, 47,
+    49, 51, 54, 56, 59, 62, 65, 68, 72, 75, 79, 83,
+    87, 91, 95, 100
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13,
+    13, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15,
+    15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18,
+    18, 18, 18, 18, 19, 19, 19, 19, 19, 20, 20, 20,
+    20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23,
+    24, 24, 24, 24, 25, 25, 25, 26, 26, 26, 26, 27,
+    27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 30, 31,
+    31, 32, 32, 32, 33, 33, 33, 34, 34, 35, 35, 36,
+    36, 36, 37, 37, 38, 38, 39, 39, 39, 40, 40, 41,
+    41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 47, 47,
+    48, 48, 49, 49, 50, 51, 51, 52, 52, 53, 54, 54,
+    55, 56, 56, 57, 58, 58, 59, 60, 60, 61, 62, 62,
+    63, 64, 65, 65, 66, 67, 68, 69, 69, 70, 71, 72,
+    73, 74, 75, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    97, 98, 99, 100
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 1, 3, 6, 11, 18, 28, 41, 57, 76, 100
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 4, 4, 5, 5, 6, 6, 7, 8, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 22, 23,
+    25, 27, 28, 30, 32, 34, 36, 38, 41, 43, 45, 48,
+    50, 53, 56, 58, 61, 64, 67, 71, 74, 77, 81, 84,
+    88, 92, 96, 100
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7,
+    8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10,
+    10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12,
+    13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16,
+    16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20,
+    20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 24, 24,
+    24, 25, 25, 26, 26, 26, 27, 27, 28, 28, 29, 29,
+    29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35,
+    35, 36, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41,
+    42, 42, 43, 43, 44, 44, 45, 46, 46, 47, 48, 48,
+    49, 49, 50, 51, 51, 52, 53, 53, 54, 55, 55, 56,
+    57, 57, 58, 59, 60, 60, 61, 62, 62, 63, 64, 65,
+    65, 66, 67, 68, 69, 69, 70, 71, 72, 73, 73, 74,
+    75, 76, 77, 78, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+    97, 98, 99, 100
+};
+
+
+#elif BRIGHTNESS_TOP == 125
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 12, 25, 38, 50, 62, 75, 88, 100, 112, 125
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22,
+    24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46,
+    48, 50, 52, 54, 56, 58, 60, 62, 63, 65, 67, 69,
+    71, 73, 75, 77, 79, 81, 83, 85, 87, 89, 91, 93,
+    95, 97, 99, 101, 103, 105, 107, 109, 111, 113, 115, 117,
+    119, 121, 123, 125
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+    6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11,
+    12, 12, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17,
+    18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23,
+    24, 24, 25, 25, 25, 26, 26, 27, 27, 28, 28, 29,
+    29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35,
+    35, 36, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41,
+    41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 46, 47,
+    47, 48, 48, 49, 49, 50, 50, 50, 51, 51, 52, 52,
+    53, 53, 54, 54, 55, 55, 56, 56, 57, 57, 58, 58,
+    59, 59, 60, 60, 61, 61, 62, 62, 63, 63, 64, 64,
+    65, 65, 66, 66, 67, 67, 68, 68, 69, 69, 70, 70,
+    71, 71, 72, 72, 73, 73, 74, 74, 75, 75, 75, 76,
+    76, 77, 77, 78, 78, 79, 79, 80, 80, 81, 81, 82,
+    82, 83, 83, 84, 84, 85, 85, 86, 86, 87, 87, 88,
+    88, 89, 89, 90, 90, 91, 91, 92, 92, 93, 93, 94,
+    94, 95, 95, 96, 96, 97, 97, 98, 98, 99, 99, 100,
+    100, 100, 101, 101, 102, 102, 103, 103, 104, 104, 105, 105,
+    106, 106, 107, 107, 108, 108, 109, 109, 110, 110, 111, 111,
+    112, 112, 113, 113, 114, 114, 115, 115, 116, 116, 117, 117,
+    118, 118, 119, 119, 120, 120, 121, 121, 122, 122, 123, 123,
+    124, 124, 125, 125
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 1, 4, 9, 17, 27, 41, 57, 77, 99, 125
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3,
+    3, 4, 5, 5, 6, 7, 8, 9, 10, 11, 12, 14,
+    15, 16, 18, 19, 21, 23, 24, 26, 28, 30, 32, 34,
+    36, 39, 41, 44, 46, 49, 51, 54, 57, 60, 63, 66,
+    69, 72, 75, 79, 82, 85, 89, 93, 96, 100, 104, 108,
+    112, 116, 121, 125
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+    5, 5, 6, 6, 6, 6, 6, 7, 7, 7, 7, 8,
+    8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 11,
+    11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14,
+    15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18,
+    19, 19, 20, 20, 20, 21, 21, 22, 22, 23, 23, 23,
+    24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28, 29,
+    29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35,
+    36, 36, 37, 37, 38, 38, 39, 39, 40, 41, 41, 42,
+    42, 43, 44, 44, 45, 45, 46, 47, 47, 48, 49, 49,
+    50, 51, 51, 52, 53, 53, 54, 55, 55, 56, 57, 57,
+    58, 59, 60, 60, 61, 62, 62, 63, 64, 65, 65, 66,
+    67, 68, 68, 69, 70, 71, 72, 72, 73, 74, 75, 76,
+    77, 77, 78, 79, 80, 81, 82, 82, 83, 84, 85, 86,
+    87, 88, 89, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 99, 100, 101, 102, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 117, 118, 119, 120, 121,
+    122, 123, 124, 125
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 8, 11, 15, 21, 28, 38, 51, 69, 93, 125
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 7, 7, 7, 8, 8, 8, 9, 9, 10, 10, 11,
+    11, 12, 12, 13, 13, 14, 15, 15, 16, 17, 18, 19,
+    20, 20, 21, 23, 24, 25, 26, 27, 29, 30, 31, 33,
+    35, 36, 38, 40, 42, 44, 46, 48, 51, 53, 56, 58,
+    61, 64, 67, 71, 74, 78, 81, 85, 90, 94, 99, 103,
+    108, 114, 119, 125
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11,
+    11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12,
+    13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14,
+    15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 17,
+    17, 17, 17, 17, 18, 18, 18, 18, 18, 19, 19, 19,
+    19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22,
+    22, 22, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25,
+    26, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29,
+    29, 30, 30, 30, 31, 31, 32, 32, 32, 33, 33, 33,
+    34, 34, 35, 35, 35, 36, 36, 37, 37, 38, 38, 39,
+    39, 39, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44,
+    45, 45, 46, 47, 47, 48, 48, 49, 49, 50, 51, 51,
+    52, 52, 53, 54, 54, 55, 56, 56, 57, 58, 58, 59,
+    60, 60, 61, 62, 62, 63, 64, 65, 65, 66, 67, 68,
+    69, 69, 70, 71, 72, 73, 74, 74, 75, 76, 77, 78,
+    79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+    91, 92, 93, 94, 95, 96, 98, 99, 100, 101, 102, 104,
+    105, 106, 107, 109, 110, 111, 112, 114, 115, 116, 118, 119,
+    121, 122, 124, 125
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 1, 4, 8, 14, 23, 35, 51, 71, 95, 125
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3,
+    3, 4, 4, 5, 6, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 18, 19, 21, 22, 24, 26, 27, 29,
+    31, 33, 36, 38, 40, 43, 45, 48, 51, 54, 56, 60,
+    63, 66, 69, 73, 77, 80, 84, 88, 92, 97, 101, 106,
+    110, 115, 120, 125
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+    5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7,
+    7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9,
+    9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12,
+    12, 13, 13, 13, 13, 14, 14, 14, 15, 15, 15, 16,
+    16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20,
+    20, 20, 21, 21, 22, 22, 22, 23, 23, 24, 24, 24,
+    25, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30,
+    30, 31, 31, 32, 33, 33, 34, 34, 35, 35, 36, 36,
+    37, 37, 38, 39, 39, 40, 40, 41, 41, 42, 43, 43,
+    44, 45, 45, 46, 47, 47, 48, 49, 49, 50, 51, 51,
+    52, 53, 53, 54, 55, 56, 56, 57, 58, 59, 59, 60,
+    61, 62, 63, 63, 64, 65, 66, 67, 67, 68, 69, 70,
+    71, 72, 73, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93,
+    94, 95, 96, 97, 98, 99, 100, 101, 102, 104, 105, 106,
+    107, 108, 109, 110, 112, 113, 114, 115, 116, 118, 119, 120,
+    121, 122, 124, 125
+};
+
+
+#elif BRIGHTNESS_TOP == 255
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 26, 51, 76, 102, 128, 153, 178, 204, 230, 255
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 45,
+    49, 53, 57, 61, 65, 69, 73, 77, 81, 85, 89, 93,
+    97, 101, 105, 109, 113, 117, 121, 125, 130, 134, 138, 142,
+    146, 150, 154, 158, 162, 166, 170, 174, 178, 182, 186, 190,
+    194, 198, 202, 206, 210, 215, 219, 223, 227, 231, 235, 239,
+    243, 247, 251, 255
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+    156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+    180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203,
+    204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+    252, 253, 254, 255
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 2, 7, 18, 34, 55, 83, 116, 156, 202, 255
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 4, 5,
+    7, 8, 9, 11, 13, 14, 16, 18, 20, 23, 25, 28,
+    31, 33, 36, 40, 43, 46, 50, 54, 57, 61, 66, 70,
+    74, 79, 84, 89, 94, 99, 105, 110, 116, 122, 128, 134,
+    140, 147, 153, 160, 167, 174, 182, 189, 197, 205, 213, 221,
+    229, 238, 246, 255
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6,
+    6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10,
+    11, 11, 11, 12, 12, 13, 13, 13, 14, 14, 15, 15,
+    16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 22,
+    22, 23, 23, 24, 25, 25, 26, 26, 27, 28, 28, 29,
+    30, 30, 31, 32, 33, 33, 34, 35, 35, 36, 37, 38,
+    39, 39, 40, 41, 42, 43, 43, 44, 45, 46, 47, 48,
+    49, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    73, 74, 75, 76, 77, 78, 79, 81, 82, 83, 84, 85,
+    87, 88, 89, 90, 91, 93, 94, 95, 97, 98, 99, 100,
+    102, 103, 105, 106, 107, 109, 110, 111, 113, 114, 116, 117,
+    119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154,
+    156, 158, 159, 161, 163, 165, 166, 168, 170, 172, 173, 175,
+    177, 179, 181, 182, 184, 186, 188, 190, 192, 194, 196, 197,
+    199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246,
+    248, 251, 253, 255
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 17, 23, 31, 42, 57, 77, 104, 140, 189, 255
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 13, 14, 15, 15, 16, 17, 18, 19, 19, 20, 21,
+    22, 24, 25, 26, 27, 29, 30, 31, 33, 35, 36, 38,
+    40, 42, 44, 46, 48, 51, 53, 56, 58, 61, 64, 67,
+    70, 74, 78, 81, 85, 89, 94, 98, 103, 108, 113, 119,
+    125, 131, 137, 144, 151, 158, 166, 174, 183, 192, 201, 211,
+    221, 232, 243, 255
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14,
+    15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 17,
+    17, 17, 17, 17, 18, 18, 18, 18, 18, 19, 19, 19,
+    19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22,
+    22, 23, 23, 23, 23, 24, 24, 24, 25, 25, 25, 25,
+    26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29,
+    30, 30, 30, 31, 31, 31, 32, 32, 33, 33, 33, 34,
+    34, 35, 35, 35, 36, 36, 37, 37, 37, 38, 38, 39,
+    39, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44, 45,
+    45, 46, 46, 47, 47, 48, 49, 49, 50, 50, 51, 51,
+    52, 53, 53, 54, 55, 55, 56, 57, 57, 58, 59, 59,
+    60, 61, 61, 62, 63, 64, 64, 65, 66, 67, 67, 68,
+    69, 70, 71, 72, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 81, 82, 83, 84, 85, 86, 87, 88, 89, 91,
+    92, 93, 94, 95, 96, 97, 98, 99, 101, 102, 103, 104,
+    106, 107, 108, 109, 111, 112, 113, 115, 116, 117, 119, 120,
+    122, 123, 124, 126, 127, 129, 130, 132, 134, 135, 137, 138,
+    140, 142, 143, 145, 147, 148, 150, 152, 154, 156, 157, 159,
+    161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183,
+    186, 188, 190, 192, 195, 197, 199, 202, 204, 206, 209, 211,
+    214, 216, 219, 221, 224, 227, 229, 232, 235, 238, 240, 243,
+    246, 249, 252, 255
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 3, 8, 16, 29, 47, 72, 104, 145, 195, 255
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 0, 1, 1, 2, 2, 3, 3, 4, 5, 5, 6,
+    7, 8, 9, 10, 12, 13, 14, 16, 18, 20, 22, 24,
+    26, 28, 31, 33, 36, 39, 42, 45, 49, 52, 56, 60,
+    64, 68, 73, 77, 82, 87, 92, 98, 103, 109, 115, 122,
+    128, 135, 142, 149, 156, 164, 172, 180, 189, 197, 206, 215,
+    225, 235, 245, 255
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7,
+    7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 10, 10,
+    10, 10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14,
+    14, 15, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19,
+    19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25,
+    25, 26, 26, 27, 28, 28, 29, 29, 30, 31, 31, 32,
+    32, 33, 34, 34, 35, 36, 37, 37, 38, 39, 39, 40,
+    41, 42, 43, 43, 44, 45, 46, 47, 47, 48, 49, 50,
+    51, 52, 53, 54, 54, 55, 56, 57, 58, 59, 60, 61,
+    62, 63, 64, 65, 66, 67, 68, 70, 71, 72, 73, 74,
+    75, 76, 77, 79, 80, 81, 82, 83, 85, 86, 87, 88,
+    90, 91, 92, 94, 95, 96, 98, 99, 100, 102, 103, 105,
+    106, 108, 109, 110, 112, 113, 115, 116, 118, 120, 121, 123,
+    124, 126, 128, 129, 131, 132, 134, 136, 138, 139, 141, 143,
+    145, 146, 148, 150, 152, 154, 155, 157, 159, 161, 163, 165,
+    167, 169, 171, 173, 175, 177, 179, 181, 183, 185, 187, 189,
+    191, 193, 196, 198, 200, 202, 204, 207, 209, 211, 214, 216,
+    218, 220, 223, 225, 228, 230, 232, 235, 237, 240, 242, 245,
+    247, 250, 252, 255
+};
+
+
+#elif BRIGHTNESS_TOP == 999
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 100, 200, 300, 400, 500, 599, 699, 799, 899, 999
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 16, 32, 48, 63, 79, 95, 111, 127, 143, 159, 174,
+    190, 206, 222, 238, 254, 270, 285, 301, 317, 333, 349, 365,
+    381, 396, 412, 428, 444, 460, 476, 492, 507, 523, 539, 555,
+    571, 587, 603, 618, 634, 650, 666, 682, 698, 714, 729, 745,
+    761, 777, 793, 809, 825, 840, 856, 872, 888, 904, 920, 936,
+    951, 967, 983, 999
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 4, 8, 12, 16, 20, 24, 27, 31, 35, 39, 43,
+    47, 51, 55, 59, 63, 67, 71, 74, 78, 82, 86, 90,
+    94, 98, 102, 106, 110, 114, 118, 121, 125, 129, 133, 137,
+    141, 145, 149, 153, 157, 161, 165, 168, 172, 176, 180, 184,
+    188, 192, 196, 200, 204, 208, 212, 215, 219, 223, 227, 231,
+    235, 239, 243, 247, 251, 255, 259, 262, 266, 270, 274, 278,
+    282, 286, 290, 294, 298, 302, 306, 309, 313, 317, 321, 325,
+    329, 333, 337, 341, 345, 349, 353, 357, 360, 364, 368, 372,
+    376, 380, 384, 388, 392, 396, 400, 404, 407, 411, 415, 419,
+    423, 427, 431, 435, 439, 443, 447, 451, 454, 458, 462, 466,
+    470, 474, 478, 482, 486, 490, 494, 498, 501, 505, 509, 513,
+    517, 521, 525, 529, 533, 537, 541, 545, 548, 552, 556, 560,
+    564, 568, 572, 576, 580, 584, 588, 592, 595, 599, 603, 607,
+    611, 615, 619, 623, 627, 631, 635, 639, 642, 646, 650, 654,
+    658, 662, 666, 670, 674, 678, 682, 686, 690, 693, 697, 701,
+    705, 709, 713, 717, 721, 725, 729, 733, 737, 740, 744, 748,
+    752, 756, 760, 764, 768, 772, 776, 780, 784, 787, 791, 795,
+    799, 803, 807, 811, 815, 819, 823, 827, 831, 834, 838, 842,
+    846, 850, 854, 858, 862, 866, 870, 874, 878, 881, 885, 889,
+    893, 897, 901, 905, 909, 913, 917, 921, 925, 928, 932, 936,
+    940, 944, 948, 952, 956, 960, 964, 968, 972, 975, 979, 983,
+    987, 991, 995, 999
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 6, 29, 71, 133, 217, 325, 456, 611, 792, 999
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 1, 1, 2, 4, 6, 8, 11, 14, 17, 21,
+    26, 31, 37, 43, 49, 56, 63, 71, 80, 89, 99, 109,
+    120, 131, 143, 155, 168, 181, 195, 210, 225, 241, 257, 274,
+    292, 310, 329, 348, 368, 388, 409, 431, 454, 477, 500, 524,
+    549, 575, 601, 628, 655, 683, 712, 741, 771, 802, 833, 865,
+    897, 931, 964, 999
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 5, 5,
+    6, 6, 7, 7, 8, 8, 9, 10, 10, 11, 12, 13,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 27, 28, 29, 30, 32, 33, 34, 36, 37, 38, 40,
+    41, 43, 45, 46, 48, 49, 51, 53, 55, 56, 58, 60,
+    62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 85,
+    87, 89, 91, 94, 96, 99, 101, 104, 106, 109, 111, 114,
+    116, 119, 122, 125, 127, 130, 133, 136, 139, 142, 145, 148,
+    151, 154, 157, 160, 163, 167, 170, 173, 177, 180, 183, 187,
+    190, 194, 197, 201, 205, 208, 212, 216, 219, 223, 227, 231,
+    235, 239, 243, 247, 251, 255, 259, 263, 267, 271, 276, 280,
+    284, 289, 293, 297, 302, 306, 311, 315, 320, 325, 329, 334,
+    339, 344, 349, 353, 358, 363, 368, 373, 378, 383, 389, 394,
+    399, 404, 409, 415, 420, 425, 431, 436, 442, 447, 453, 459,
+    464, 470, 476, 481, 487, 493, 499, 505, 511, 517, 523, 529,
+    535, 541, 547, 554, 560, 566, 573, 579, 585, 592, 598, 605,
+    611, 618, 625, 631, 638, 645, 652, 659, 665, 672, 679, 686,
+    693, 700, 708, 715, 722, 729, 736, 744, 751, 759, 766, 773,
+    781, 789, 796, 804, 811, 819, 827, 835, 843, 850, 858, 866,
+    874, 882, 890, 898, 907, 915, 923, 931, 940, 948, 956, 965,
+    973, 982, 990, 999
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 67, 91, 122, 165, 223, 301, 406, 548, 740, 999
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 52, 55, 57, 60, 63, 66, 69, 73, 76, 80, 84,
+    88, 92, 97, 102, 107, 112, 117, 123, 129, 135, 142, 149,
+    156, 164, 172, 180, 189, 198, 208, 218, 228, 239, 251, 263,
+    276, 290, 304, 319, 334, 350, 368, 385, 404, 424, 445, 466,
+    489, 513, 538, 564, 592, 621, 651, 683, 716, 751, 787, 826,
+    866, 908, 953, 999
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 50, 51, 52, 52, 53, 53, 54, 55, 55, 56, 57,
+    57, 58, 59, 59, 60, 61, 61, 62, 63, 64, 64, 65,
+    66, 67, 68, 68, 69, 70, 71, 72, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 82, 83, 84, 85, 86,
+    87, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 100,
+    101, 102, 103, 104, 106, 107, 108, 109, 111, 112, 113, 115,
+    116, 117, 119, 120, 122, 123, 125, 126, 127, 129, 131, 132,
+    134, 135, 137, 138, 140, 142, 143, 145, 147, 149, 150, 152,
+    154, 156, 158, 159, 161, 163, 165, 167, 169, 171, 173, 175,
+    177, 179, 181, 184, 186, 188, 190, 192, 195, 197, 199, 202,
+    204, 206, 209, 211, 214, 216, 219, 222, 224, 227, 230, 232,
+    235, 238, 241, 243, 246, 249, 252, 255, 258, 261, 264, 267,
+    271, 274, 277, 280, 284, 287, 290, 294, 297, 301, 304, 308,
+    312, 315, 319, 323, 327, 331, 335, 338, 342, 347, 351, 355,
+    359, 363, 368, 372, 376, 381, 385, 390, 394, 399, 404, 409,
+    413, 418, 423, 428, 433, 438, 444, 449, 454, 460, 465, 471,
+    476, 482, 487, 493, 499, 505, 511, 517, 523, 529, 536, 542,
+    548, 555, 561, 568, 575, 581, 588, 595, 602, 609, 617, 624,
+    631, 639, 646, 654, 662, 670, 678, 686, 694, 702, 710, 719,
+    727, 736, 744, 753, 762, 771, 780, 790, 799, 808, 818, 828,
+    837, 847, 857, 867, 878, 888, 899, 909, 920, 931, 942, 953,
+    964, 976, 987, 999
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 11, 30, 62, 112, 184, 281, 407, 566, 762, 999
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 2, 4, 5, 7, 9, 11, 13, 15, 18, 21, 24,
+    28, 31, 36, 40, 45, 51, 57, 63, 70, 77, 85, 93,
+    101, 110, 120, 130, 141, 153, 165, 177, 191, 205, 219, 234,
+    250, 267, 284, 303, 321, 341, 362, 383, 405, 428, 451, 476,
+    501, 528, 555, 583, 612, 642, 673, 706, 739, 773, 808, 844,
+    881, 919, 959, 999
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 5,
+    5, 6, 6, 7, 7, 7, 8, 8, 9, 9, 10, 10,
+    11, 11, 12, 12, 13, 13, 14, 14, 15, 16, 16, 17,
+    17, 18, 19, 20, 20, 21, 22, 23, 24, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    40, 41, 42, 43, 44, 46, 47, 48, 50, 51, 53, 54,
+    55, 57, 58, 60, 62, 63, 65, 66, 68, 70, 71, 73,
+    75, 77, 79, 81, 82, 84, 86, 88, 90, 92, 95, 97,
+    99, 101, 103, 105, 108, 110, 112, 115, 117, 120, 122, 125,
+    127, 130, 132, 135, 138, 140, 143, 146, 149, 152, 155, 158,
+    160, 163, 167, 170, 173, 176, 179, 182, 186, 189, 192, 196,
+    199, 203, 206, 210, 213, 217, 221, 224, 228, 232, 236, 240,
+    244, 248, 252, 256, 260, 264, 268, 272, 277, 281, 285, 290,
+    294, 299, 303, 308, 313, 317, 322, 327, 332, 336, 341, 346,
+    351, 356, 362, 367, 372, 377, 383, 388, 393, 399, 404, 410,
+    415, 421, 427, 433, 438, 444, 450, 456, 462, 468, 475, 481,
+    487, 493, 500, 506, 513, 519, 526, 532, 539, 546, 552, 559,
+    566, 573, 580, 587, 594, 602, 609, 616, 624, 631, 639, 646,
+    654, 661, 669, 677, 685, 693, 701, 709, 717, 725, 733, 741,
+    750, 758, 767, 775, 784, 792, 801, 810, 819, 827, 836, 846,
+    855, 864, 873, 882, 892, 901, 911, 920, 930, 939, 949, 959,
+    969, 979, 989, 999
+};
+
+
+#elif BRIGHTNESS_TOP == 1000
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 16, 32, 48, 63, 79, 95, 111, 127, 143, 159, 175,
+    190, 206, 222, 238, 254, 270, 286, 302, 317, 333, 349, 365,
+    381, 397, 413, 429, 444, 460, 476, 492, 508, 524, 540, 556,
+    571, 587, 603, 619, 635, 651, 667, 683, 698, 714, 730, 746,
+    762, 778, 794, 810, 825, 841, 857, 873, 889, 905, 921, 937,
+    952, 968, 984, 1000
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 4, 8, 12, 16, 20, 24, 27, 31, 35, 39, 43,
+    47, 51, 55, 59, 63, 67, 71, 75, 78, 82, 86, 90,
+    94, 98, 102, 106, 110, 114, 118, 122, 125, 129, 133, 137,
+    141, 145, 149, 153, 157, 161, 165, 169, 173, 176, 180, 184,
+    188, 192, 196, 200, 204, 208, 212, 216, 220, 224, 227, 231,
+    235, 239, 243, 247, 251, 255, 259, 263, 267, 271, 275, 278,
+    282, 286, 290, 294, 298, 302, 306, 310, 314, 318, 322, 325,
+    329, 333, 337, 341, 345, 349, 353, 357, 361, 365, 369, 373,
+    376, 380, 384, 388, 392, 396, 400, 404, 408, 412, 416, 420,
+    424, 427, 431, 435, 439, 443, 447, 451, 455, 459, 463, 467,
+    471, 475, 478, 482, 486, 490, 494, 498, 502, 506, 510, 514,
+    518, 522, 525, 529, 533, 537, 541, 545, 549, 553, 557, 561,
+    565, 569, 573, 576, 580, 584, 588, 592, 596, 600, 604, 608,
+    612, 616, 620, 624, 627, 631, 635, 639, 643, 647, 651, 655,
+    659, 663, 667, 671, 675, 678, 682, 686, 690, 694, 698, 702,
+    706, 710, 714, 718, 722, 725, 729, 733, 737, 741, 745, 749,
+    753, 757, 761, 765, 769, 773, 776, 780, 784, 788, 792, 796,
+    800, 804, 808, 812, 816, 820, 824, 827, 831, 835, 839, 843,
+    847, 851, 855, 859, 863, 867, 871, 875, 878, 882, 886, 890,
+    894, 898, 902, 906, 910, 914, 918, 922, 925, 929, 933, 937,
+    941, 945, 949, 953, 957, 961, 965, 969, 973, 976, 980, 984,
+    988, 992, 996, 1000
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 6, 29, 71, 133, 218, 325, 456, 612, 793, 1000
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 1, 1, 2, 4, 6, 8, 11, 14, 17, 22,
+    26, 31, 37, 43, 49, 56, 64, 72, 80, 89, 99, 109,
+    120, 131, 143, 155, 168, 181, 195, 210, 225, 241, 257, 274,
+    292, 310, 329, 348, 368, 389, 410, 432, 454, 477, 501, 525,
+    550, 575, 601, 628, 656, 684, 712, 742, 772, 802, 834, 866,
+    898, 931, 965, 1000
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 5, 5,
+    6, 6, 7, 7, 8, 8, 9, 10, 10, 11, 12, 13,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 27, 28, 29, 30, 32, 33, 34, 36, 37, 38, 40,
+    41, 43, 45, 46, 48, 49, 51, 53, 55, 56, 58, 60,
+    62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 85,
+    87, 89, 92, 94, 96, 99, 101, 104, 106, 109, 111, 114,
+    117, 119, 122, 125, 128, 130, 133, 136, 139, 142, 145, 148,
+    151, 154, 157, 160, 164, 167, 170, 173, 177, 180, 184, 187,
+    190, 194, 198, 201, 205, 208, 212, 216, 220, 223, 227, 231,
+    235, 239, 243, 247, 251, 255, 259, 263, 267, 272, 276, 280,
+    284, 289, 293, 298, 302, 307, 311, 316, 320, 325, 330, 334,
+    339, 344, 349, 354, 359, 364, 369, 374, 379, 384, 389, 394,
+    399, 405, 410, 415, 421, 426, 431, 437, 442, 448, 453, 459,
+    465, 470, 476, 482, 488, 494, 500, 505, 511, 517, 523, 530,
+    536, 542, 548, 554, 560, 567, 573, 580, 586, 592, 599, 605,
+    612, 619, 625, 632, 639, 646, 652, 659, 666, 673, 680, 687,
+    694, 701, 708, 715, 723, 730, 737, 745, 752, 759, 767, 774,
+    782, 789, 797, 805, 812, 820, 828, 836, 843, 851, 859, 867,
+    875, 883, 891, 899, 908, 916, 924, 932, 941, 949, 957, 966,
+    974, 983, 991, 1000
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 67, 91, 122, 165, 223, 301, 407, 549, 741, 1000
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 52, 55, 57, 60, 63, 66, 69, 73, 76, 80, 84,
+    88, 92, 97, 102, 107, 112, 117, 123, 129, 135, 142, 149,
+    156, 164, 172, 180, 189, 198, 208, 218, 229, 240, 251, 264,
+    276, 290, 304, 319, 334, 351, 368, 386, 405, 424, 445, 467,
+    490, 513, 538, 565, 592, 621, 651, 683, 717, 751, 788, 827,
+    867, 909, 953, 1000
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 50, 51, 52, 52, 53, 53, 54, 55, 55, 56, 57,
+    57, 58, 59, 59, 60, 61, 62, 62, 63, 64, 64, 65,
+    66, 67, 68, 68, 69, 70, 71, 72, 73, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 99, 100,
+    101, 102, 103, 104, 106, 107, 108, 110, 111, 112, 113, 115,
+    116, 118, 119, 120, 122, 123, 125, 126, 128, 129, 131, 132,
+    134, 135, 137, 139, 140, 142, 144, 145, 147, 149, 150, 152,
+    154, 156, 158, 160, 161, 163, 165, 167, 169, 171, 173, 175,
+    177, 179, 182, 184, 186, 188, 190, 193, 195, 197, 200, 202,
+    204, 207, 209, 212, 214, 217, 219, 222, 224, 227, 230, 233,
+    235, 238, 241, 244, 247, 250, 252, 255, 258, 262, 265, 268,
+    271, 274, 277, 281, 284, 287, 291, 294, 298, 301, 305, 308,
+    312, 316, 319, 323, 327, 331, 335, 339, 343, 347, 351, 355,
+    359, 364, 368, 372, 377, 381, 386, 390, 395, 399, 404, 409,
+    414, 419, 424, 429, 434, 439, 444, 449, 455, 460, 465, 471,
+    477, 482, 488, 494, 500, 505, 511, 517, 524, 530, 536, 542,
+    549, 555, 562, 569, 575, 582, 589, 596, 603, 610, 617, 625,
+    632, 640, 647, 655, 662, 670, 678, 686, 694, 703, 711, 719,
+    728, 736, 745, 754, 763, 772, 781, 790, 800, 809, 819, 828,
+    838, 848, 858, 868, 879, 889, 900, 910, 921, 932, 943, 954,
+    965, 977, 988, 1000
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 11, 30, 62, 113, 184, 281, 407, 567, 763, 1000
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 2, 4, 5, 7, 9, 11, 13, 15, 18, 21, 24,
+    28, 32, 36, 40, 45, 51, 57, 63, 70, 77, 85, 93,
+    101, 111, 120, 131, 141, 153, 165, 178, 191, 205, 219, 235,
+    251, 267, 285, 303, 322, 341, 362, 383, 405, 428, 452, 476,
+    502, 528, 556, 584, 613, 643, 674, 706, 739, 773, 808, 845,
+    882, 920, 960, 1000
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 5,
+    5, 6, 6, 7, 7, 7, 8, 8, 9, 9, 10, 10,
+    11, 11, 12, 12, 13, 13, 14, 14, 15, 16, 16, 17,
+    18, 18, 19, 20, 20, 21, 22, 23, 24, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    40, 41, 42, 43, 44, 46, 47, 48, 50, 51, 53, 54,
+    55, 57, 58, 60, 62, 63, 65, 66, 68, 70, 72, 73,
+    75, 77, 79, 81, 83, 84, 86, 88, 90, 93, 95, 97,
+    99, 101, 103, 106, 108, 110, 113, 115, 117, 120, 122, 125,
+    127, 130, 132, 135, 138, 141, 143, 146, 149, 152, 155, 158,
+    161, 164, 167, 170, 173, 176, 179, 183, 186, 189, 193, 196,
+    199, 203, 206, 210, 214, 217, 221, 225, 228, 232, 236, 240,
+    244, 248, 252, 256, 260, 264, 268, 273, 277, 281, 286, 290,
+    294, 299, 304, 308, 313, 318, 322, 327, 332, 337, 342, 347,
+    352, 357, 362, 367, 372, 378, 383, 388, 394, 399, 405, 410,
+    416, 422, 427, 433, 439, 445, 451, 457, 463, 469, 475, 481,
+    487, 494, 500, 507, 513, 520, 526, 533, 539, 546, 553, 560,
+    567, 574, 581, 588, 595, 602, 610, 617, 624, 632, 639, 647,
+    654, 662, 670, 678, 685, 693, 701, 709, 717, 726, 734, 742,
+    750, 759, 767, 776, 784, 793, 802, 811, 819, 828, 837, 846,
+    855, 865, 874, 883, 893, 902, 911, 921, 931, 940, 950, 960,
+    970, 980, 990, 1000
+};
+
+
+#elif BRIGHTNESS_TOP == 1500
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 150, 300, 450, 600, 750, 900, 1050, 1200, 1350, 1500
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 24, 48, 71, 95, 119, 143, 167, 190, 214, 238, 262,
+    286, 310, 333, 357, 381, 405, 429, 452, 476, 500, 524, 548,
+    571, 595, 619, 643, 667, 690, 714, 738, 762, 786, 810, 833,
+    857, 881, 905, 929, 952, 976, 1000, 1024, 1048, 1071, 1095, 1119,
+    1143, 1167, 1190, 1214, 1238, 1262, 1286, 1310, 1333, 1357, 1381, 1405,
+    1429, 1452, 1476, 1500
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 6, 12, 18, 24, 29, 35, 41, 47, 53, 59, 65,
+    71, 76, 82, 88, 94, 100, 106, 112, 118, 124, 129, 135,
+    141, 147, 153, 159, 165, 171, 176, 182, 188, 194, 200, 206,
+    212, 218, 224, 229, 235, 241, 247, 253, 259, 265, 271, 276,
+    282, 288, 294, 300, 306, 312, 318, 324, 329, 335, 341, 347,
+    353, 359, 365, 371, 376, 382, 388, 394, 400, 406, 412, 418,
+    424, 429, 435, 441, 447, 453, 459, 465, 471, 476, 482, 488,
+    494, 500, 506, 512, 518, 524, 529, 535, 541, 547, 553, 559,
+    565, 571, 576, 582, 588, 594, 600, 606, 612, 618, 624, 629,
+    635, 641, 647, 653, 659, 665, 671, 676, 682, 688, 694, 700,
+    706, 712, 718, 724, 729, 735, 741, 747, 753, 759, 765, 771,
+    776, 782, 788, 794, 800, 806, 812, 818, 824, 829, 835, 841,
+    847, 853, 859, 865, 871, 876, 882, 888, 894, 900, 906, 912,
+    918, 924, 929, 935, 941, 947, 953, 959, 965, 971, 976, 982,
+    988, 994, 1000, 1006, 1012, 1018, 1024, 1029, 1035, 1041, 1047, 1053,
+    1059, 1065, 1071, 1076, 1082, 1088, 1094, 1100, 1106, 1112, 1118, 1124,
+    1129, 1135, 1141, 1147, 1153, 1159, 1165, 1171, 1176, 1182, 1188, 1194,
+    1200, 1206, 1212, 1218, 1224, 1229, 1235, 1241, 1247, 1253, 1259, 1265,
+    1271, 1276, 1282, 1288, 1294, 1300, 1306, 1312, 1318, 1324, 1329, 1335,
+    1341, 1347, 1353, 1359, 1365, 1371, 1376, 1382, 1388, 1394, 1400, 1406,
+    1412, 1418, 1424, 1429, 1435, 1441, 1447, 1453, 1459, 1465, 1471, 1476,
+    1482, 1488, 1494, 1500
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 9, 43, 106, 200, 326, 488, 684, 918, 1190, 1500
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 1, 2, 3, 6, 9, 12, 16, 21, 26, 32,
+    39, 47, 55, 64, 74, 84, 95, 107, 120, 134, 148, 163,
+    179, 196, 214, 233, 252, 272, 293, 315, 338, 362, 386, 412,
+    438, 465, 493, 522, 552, 583, 615, 647, 681, 715, 751, 787,
+    825, 863, 902, 942, 983, 1026, 1069, 1113, 1158, 1204, 1250, 1298,
+    1347, 1397, 1448, 1500
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    2, 2, 3, 3, 3, 4, 4, 5, 6, 6, 7, 8,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 23, 24, 25, 27, 28, 30, 31, 33, 35, 36,
+    38, 40, 42, 43, 45, 47, 49, 51, 53, 56, 58, 60,
+    62, 64, 67, 69, 72, 74, 77, 79, 82, 85, 87, 90,
+    93, 96, 99, 102, 105, 108, 111, 114, 117, 120, 124, 127,
+    130, 134, 137, 141, 144, 148, 152, 155, 159, 163, 167, 171,
+    175, 179, 183, 187, 191, 196, 200, 204, 209, 213, 217, 222,
+    227, 231, 236, 241, 245, 250, 255, 260, 265, 270, 275, 280,
+    286, 291, 296, 302, 307, 313, 318, 324, 329, 335, 341, 346,
+    352, 358, 364, 370, 376, 382, 389, 395, 401, 407, 414, 420,
+    427, 433, 440, 446, 453, 460, 467, 474, 481, 488, 495, 502,
+    509, 516, 523, 531, 538, 545, 553, 560, 568, 576, 583, 591,
+    599, 607, 615, 623, 631, 639, 647, 655, 663, 672, 680, 689,
+    697, 706, 714, 723, 732, 740, 749, 758, 767, 776, 785, 794,
+    803, 813, 822, 831, 841, 850, 860, 869, 879, 889, 898, 908,
+    918, 928, 938, 948, 958, 968, 979, 989, 999, 1010, 1020, 1031,
+    1041, 1052, 1062, 1073, 1084, 1095, 1106, 1117, 1128, 1139, 1150, 1161,
+    1173, 1184, 1195, 1207, 1218, 1230, 1242, 1253, 1265, 1277, 1289, 1301,
+    1313, 1325, 1337, 1349, 1361, 1374, 1386, 1398, 1411, 1423, 1436, 1449,
+    1461, 1474, 1487, 1500
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 101, 136, 184, 248, 335, 452, 610, 823, 1111, 1500
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 78, 82, 86, 90, 95, 99, 104, 109, 115, 120, 126,
+    132, 139, 145, 153, 160, 168, 176, 185, 194, 203, 213, 223,
+    234, 246, 258, 270, 283, 297, 312, 327, 343, 359, 377, 395,
+    415, 435, 456, 478, 502, 526, 552, 579, 607, 637, 668, 700,
+    734, 770, 808, 847, 888, 932, 977, 1025, 1075, 1127, 1182, 1240,
+    1300, 1364, 1430, 1500
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 76, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 96, 97, 98,
+    99, 100, 101, 103, 104, 105, 106, 108, 109, 110, 111, 113,
+    114, 115, 117, 118, 120, 121, 122, 124, 125, 127, 128, 130,
+    131, 133, 134, 136, 138, 139, 141, 143, 144, 146, 148, 150,
+    151, 153, 155, 157, 159, 160, 162, 164, 166, 168, 170, 172,
+    174, 176, 178, 180, 183, 185, 187, 189, 191, 194, 196, 198,
+    201, 203, 205, 208, 210, 213, 215, 218, 220, 223, 226, 228,
+    231, 234, 237, 239, 242, 245, 248, 251, 254, 257, 260, 263,
+    266, 269, 272, 276, 279, 282, 286, 289, 292, 296, 299, 303,
+    306, 310, 314, 317, 321, 325, 329, 333, 337, 341, 345, 349,
+    353, 357, 361, 366, 370, 374, 379, 383, 388, 392, 397, 402,
+    406, 411, 416, 421, 426, 431, 436, 441, 447, 452, 457, 463,
+    468, 474, 479, 485, 491, 496, 502, 508, 514, 520, 526, 533,
+    539, 545, 552, 558, 565, 572, 578, 585, 592, 599, 606, 613,
+    621, 628, 635, 643, 651, 658, 666, 674, 682, 690, 698, 706,
+    715, 723, 732, 741, 749, 758, 767, 776, 785, 795, 804, 814,
+    823, 833, 843, 853, 863, 873, 883, 894, 904, 915, 926, 937,
+    948, 959, 971, 982, 994, 1005, 1017, 1029, 1042, 1054, 1066, 1079,
+    1092, 1105, 1118, 1131, 1144, 1158, 1172, 1186, 1200, 1214, 1228, 1243,
+    1257, 1272, 1287, 1303, 1318, 1334, 1349, 1365, 1381, 1398, 1414, 1431,
+    1448, 1465, 1482, 1500
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 17, 45, 94, 169, 276, 422, 611, 850, 1145, 1500
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 3, 5, 8, 11, 13, 16, 19, 23, 27, 31, 36,
+    41, 47, 54, 61, 68, 76, 85, 95, 105, 115, 127, 139,
+    152, 166, 181, 196, 212, 229, 247, 266, 286, 307, 329, 352,
+    376, 401, 427, 454, 483, 512, 543, 575, 608, 642, 678, 715,
+    753, 793, 833, 876, 919, 965, 1011, 1059, 1109, 1160, 1213, 1267,
+    1323, 1380, 1439, 1500
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 1, 1, 2, 3, 3, 4, 5, 5, 6, 7, 7,
+    8, 8, 9, 10, 10, 11, 12, 12, 13, 14, 14, 15,
+    16, 17, 17, 18, 19, 20, 21, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 31, 32, 33, 34, 35, 37, 38, 39,
+    41, 42, 43, 45, 46, 48, 49, 51, 53, 54, 56, 58,
+    59, 61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 81,
+    83, 85, 88, 90, 92, 95, 97, 100, 102, 105, 107, 110,
+    113, 115, 118, 121, 124, 127, 130, 133, 136, 139, 142, 145,
+    148, 152, 155, 158, 162, 165, 169, 172, 176, 180, 183, 187,
+    191, 195, 199, 203, 207, 211, 215, 219, 223, 228, 232, 236,
+    241, 245, 250, 255, 259, 264, 269, 274, 279, 284, 289, 294,
+    299, 304, 310, 315, 320, 326, 331, 337, 343, 348, 354, 360,
+    366, 372, 378, 384, 390, 396, 403, 409, 415, 422, 428, 435,
+    442, 449, 455, 462, 469, 476, 483, 491, 498, 505, 513, 520,
+    528, 535, 543, 551, 558, 566, 574, 582, 591, 599, 607, 615,
+    624, 632, 641, 650, 658, 667, 676, 685, 694, 703, 713, 722,
+    731, 741, 750, 760, 770, 779, 789, 799, 809, 819, 830, 840,
+    850, 861, 871, 882, 893, 903, 914, 925, 936, 947, 959, 970,
+    981, 993, 1005, 1016, 1028, 1040, 1052, 1064, 1076, 1088, 1101, 1113,
+    1126, 1138, 1151, 1164, 1177, 1190, 1203, 1216, 1229, 1242, 1256, 1270,
+    1283, 1297, 1311, 1325, 1339, 1353, 1367, 1382, 1396, 1411, 1425, 1440,
+    1455, 1470, 1485, 1500
+};
+
+
+#elif BRIGHTNESS_TOP == 1998
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 200, 400, 599, 799, 999, 1199, 1399, 1598, 1798, 1998
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 32, 63, 95, 127, 159, 190, 222, 254, 285, 317, 349,
+    381, 412, 444, 476, 507, 539, 571, 603, 634, 666, 698, 729,
+    761, 793, 825, 856, 888, 920, 951, 983, 1015, 1047, 1078, 1110,
+    1142, 1173, 1205, 1237, 1269, 1300, 1332, 1364, 1395, 1427, 1459, 1491,
+    1522, 1554, 1586, 1617, 1649, 1681, 1713, 1744, 1776, 1808, 1839, 1871,
+    1903, 1935, 1966, 1998
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 8, 16, 24, 31, 39, 47, 55, 63, 71, 78, 86,
+    94, 102, 110, 118, 125, 133, 141, 149, 157, 165, 172, 180,
+    188, 196, 204, 212, 219, 227, 235, 243, 251, 259, 266, 274,
+    282, 290, 298, 306, 313, 321, 329, 337, 345, 353, 360, 368,
+    376, 384, 392, 400, 407, 415, 423, 431, 439, 447, 454, 462,
+    470, 478, 486, 494, 501, 509, 517, 525, 533, 541, 548, 556,
+    564, 572, 580, 588, 595, 603, 611, 619, 627, 635, 642, 650,
+    658, 666, 674, 682, 690, 697, 705, 713, 721, 729, 737, 744,
+    752, 760, 768, 776, 784, 791, 799, 807, 815, 823, 831, 838,
+    846, 854, 862, 870, 878, 885, 893, 901, 909, 917, 925, 932,
+    940, 948, 956, 964, 972, 979, 987, 995, 1003, 1011, 1019, 1026,
+    1034, 1042, 1050, 1058, 1066, 1073, 1081, 1089, 1097, 1105, 1113, 1120,
+    1128, 1136, 1144, 1152, 1160, 1167, 1175, 1183, 1191, 1199, 1207, 1214,
+    1222, 1230, 1238, 1246, 1254, 1261, 1269, 1277, 1285, 1293, 1301, 1308,
+    1316, 1324, 1332, 1340, 1348, 1356, 1363, 1371, 1379, 1387, 1395, 1403,
+    1410, 1418, 1426, 1434, 1442, 1450, 1457, 1465, 1473, 1481, 1489, 1497,
+    1504, 1512, 1520, 1528, 1536, 1544, 1551, 1559, 1567, 1575, 1583, 1591,
+    1598, 1606, 1614, 1622, 1630, 1638, 1645, 1653, 1661, 1669, 1677, 1685,
+    1692, 1700, 1708, 1716, 1724, 1732, 1739, 1747, 1755, 1763, 1771, 1779,
+    1786, 1794, 1802, 1810, 1818, 1826, 1833, 1841, 1849, 1857, 1865, 1873,
+    1880, 1888, 1896, 1904, 1912, 1920, 1927, 1935, 1943, 1951, 1959, 1967,
+    1974, 1982, 1990, 1998
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 13, 58, 141, 266, 435, 649, 912, 1223, 1585, 1998
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 1, 2, 5, 8, 11, 16, 21, 28, 35, 43,
+    52, 62, 73, 85, 98, 112, 127, 143, 160, 178, 197, 218,
+    239, 262, 285, 310, 336, 363, 391, 420, 450, 482, 514, 548,
+    583, 620, 657, 696, 735, 777, 819, 862, 907, 953, 1000, 1049,
+    1098, 1149, 1202, 1255, 1310, 1366, 1423, 1482, 1542, 1603, 1666, 1730,
+    1795, 1861, 1929, 1998
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+    2, 3, 3, 4, 5, 5, 6, 7, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 17, 18, 19, 21, 22, 24, 25,
+    27, 29, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
+    51, 53, 55, 58, 60, 63, 66, 68, 71, 74, 77, 80,
+    83, 86, 89, 92, 95, 99, 102, 106, 109, 113, 116, 120,
+    124, 128, 131, 135, 139, 143, 148, 152, 156, 160, 165, 169,
+    174, 178, 183, 188, 192, 197, 202, 207, 212, 217, 222, 228,
+    233, 238, 244, 249, 255, 260, 266, 272, 278, 284, 290, 296,
+    302, 308, 314, 321, 327, 333, 340, 347, 353, 360, 367, 374,
+    381, 388, 395, 402, 409, 416, 424, 431, 439, 446, 454, 462,
+    469, 477, 485, 493, 501, 509, 518, 526, 534, 543, 551, 560,
+    568, 577, 586, 595, 604, 613, 622, 631, 640, 649, 659, 668,
+    678, 687, 697, 707, 717, 726, 736, 746, 757, 767, 777, 787,
+    798, 808, 819, 829, 840, 851, 862, 873, 884, 895, 906, 917,
+    929, 940, 951, 963, 975, 986, 998, 1010, 1022, 1034, 1046, 1058,
+    1070, 1083, 1095, 1107, 1120, 1132, 1145, 1158, 1171, 1184, 1197, 1210,
+    1223, 1236, 1249, 1263, 1276, 1290, 1303, 1317, 1331, 1345, 1359, 1373,
+    1387, 1401, 1415, 1429, 1444, 1458, 1473, 1488, 1502, 1517, 1532, 1547,
+    1562, 1577, 1592, 1608, 1623, 1638, 1654, 1669, 1685, 1701, 1717, 1733,
+    1749, 1765, 1781, 1797, 1813, 1830, 1846, 1863, 1879, 1896, 1913, 1930,
+    1947, 1964, 1981, 1998
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 134, 181, 245, 330, 446, 602, 812, 1097, 1480, 1998
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 104, 109, 115, 120, 126, 132, 139, 146, 153, 160, 168,
+    176, 185, 194, 203, 213, 224, 234, 246, 258, 270, 284, 297,
+    312, 327, 343, 360, 377, 396, 415, 435, 457, 479, 502, 527,
+    552, 579, 608, 637, 668, 701, 735, 771, 808, 848, 889, 933,
+    978, 1026, 1076, 1128, 1183, 1241, 1302, 1365, 1432, 1501, 1575, 1651,
+    1732, 1816, 1905, 1998
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 101, 102, 103, 104, 106, 107, 108, 109, 111, 112, 113,
+    115, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130,
+    132, 133, 135, 137, 138, 140, 142, 143, 145, 147, 148, 150,
+    152, 154, 156, 157, 159, 161, 163, 165, 167, 169, 171, 173,
+    175, 177, 179, 181, 183, 186, 188, 190, 192, 195, 197, 199,
+    201, 204, 206, 209, 211, 214, 216, 219, 221, 224, 227, 229,
+    232, 235, 238, 240, 243, 246, 249, 252, 255, 258, 261, 264,
+    267, 270, 274, 277, 280, 283, 287, 290, 294, 297, 301, 304,
+    308, 311, 315, 319, 323, 326, 330, 334, 338, 342, 346, 350,
+    354, 359, 363, 367, 372, 376, 380, 385, 389, 394, 399, 403,
+    408, 413, 418, 423, 428, 433, 438, 443, 448, 454, 459, 465,
+    470, 476, 481, 487, 493, 499, 504, 510, 516, 523, 529, 535,
+    541, 548, 554, 561, 567, 574, 581, 588, 595, 602, 609, 616,
+    623, 631, 638, 646, 653, 661, 669, 677, 685, 693, 701, 710,
+    718, 726, 735, 744, 753, 761, 770, 780, 789, 798, 808, 817,
+    827, 837, 846, 856, 867, 877, 887, 898, 908, 919, 930, 941,
+    952, 963, 975, 986, 998, 1010, 1022, 1034, 1046, 1058, 1071, 1084,
+    1097, 1110, 1123, 1136, 1149, 1163, 1177, 1191, 1205, 1219, 1233, 1248,
+    1263, 1278, 1293, 1308, 1324, 1339, 1355, 1371, 1387, 1404, 1420, 1437,
+    1454, 1471, 1489, 1507, 1524, 1542, 1561, 1579, 1598, 1617, 1636, 1655,
+    1675, 1695, 1715, 1735, 1755, 1776, 1797, 1819, 1840, 1862, 1884, 1906,
+    1929, 1952, 1975, 1998
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 22, 60, 125, 225, 368, 562, 814, 1132, 1525, 1998
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 4, 7, 11, 14, 18, 21, 26, 30, 36, 41, 48,
+    55, 63, 71, 81, 91, 102, 113, 126, 139, 154, 169, 185,
+    203, 221, 240, 261, 283, 306, 330, 355, 381, 409, 438, 469,
+    501, 534, 569, 605, 643, 682, 723, 766, 810, 855, 903, 952,
+    1003, 1056, 1110, 1167, 1225, 1285, 1347, 1411, 1477, 1545, 1615, 1688,
+    1762, 1838, 1917, 1998
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9, 10,
+    10, 11, 12, 13, 14, 15, 16, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 29, 30, 31, 32, 34,
+    35, 36, 38, 39, 41, 42, 44, 45, 47, 49, 50, 52,
+    54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 77,
+    79, 81, 84, 86, 89, 91, 94, 97, 99, 102, 105, 108,
+    111, 114, 117, 120, 123, 126, 129, 133, 136, 139, 143, 146,
+    150, 154, 157, 161, 165, 169, 173, 177, 181, 185, 189, 193,
+    198, 202, 206, 211, 215, 220, 225, 230, 234, 239, 244, 249,
+    254, 259, 265, 270, 275, 281, 286, 292, 298, 303, 309, 315,
+    321, 327, 333, 339, 346, 352, 358, 365, 371, 378, 385, 391,
+    398, 405, 412, 419, 427, 434, 441, 449, 456, 464, 472, 479,
+    487, 495, 503, 511, 520, 528, 536, 545, 553, 562, 571, 579,
+    588, 597, 607, 616, 625, 634, 644, 653, 663, 673, 683, 693,
+    703, 713, 723, 733, 744, 754, 765, 776, 787, 798, 809, 820,
+    831, 842, 854, 865, 877, 889, 901, 913, 925, 937, 949, 961,
+    974, 987, 999, 1012, 1025, 1038, 1051, 1065, 1078, 1091, 1105, 1119,
+    1132, 1146, 1160, 1175, 1189, 1203, 1218, 1232, 1247, 1262, 1277, 1292,
+    1307, 1323, 1338, 1354, 1369, 1385, 1401, 1417, 1433, 1450, 1466, 1483,
+    1499, 1516, 1533, 1550, 1567, 1585, 1602, 1620, 1637, 1655, 1673, 1691,
+    1709, 1728, 1746, 1765, 1783, 1802, 1821, 1840, 1859, 1879, 1898, 1918,
+    1938, 1958, 1978, 1998
+};
+
+
+#elif BRIGHTNESS_TOP == 2000
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 200, 400, 600, 800, 1000, 1200, 1400, 1600, 1800, 2000
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 32, 63, 95, 127, 159, 190, 222, 254, 286, 317, 349,
+    381, 413, 444, 476, 508, 540, 571, 603, 635, 667, 698, 730,
+    762, 794, 825, 857, 889, 921, 952, 984, 1016, 1048, 1079, 1111,
+    1143, 1175, 1206, 1238, 1270, 1302, 1333, 1365, 1397, 1429, 1460, 1492,
+    1524, 1556, 1587, 1619, 1651, 1683, 1714, 1746, 1778, 1810, 1841, 1873,
+    1905, 1937, 1968, 2000
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 8, 16, 24, 31, 39, 47, 55, 63, 71, 78, 86,
+    94, 102, 110, 118, 125, 133, 141, 149, 157, 165, 173, 180,
+    188, 196, 204, 212, 220, 227, 235, 243, 251, 259, 267, 275,
+    282, 290, 298, 306, 314, 322, 329, 337, 345, 353, 361, 369,
+    376, 384, 392, 400, 408, 416, 424, 431, 439, 447, 455, 463,
+    471, 478, 486, 494, 502, 510, 518, 525, 533, 541, 549, 557,
+    565, 573, 580, 588, 596, 604, 612, 620, 627, 635, 643, 651,
+    659, 667, 675, 682, 690, 698, 706, 714, 722, 729, 737, 745,
+    753, 761, 769, 776, 784, 792, 800, 808, 816, 824, 831, 839,
+    847, 855, 863, 871, 878, 886, 894, 902, 910, 918, 925, 933,
+    941, 949, 957, 965, 973, 980, 988, 996, 1004, 1012, 1020, 1027,
+    1035, 1043, 1051, 1059, 1067, 1075, 1082, 1090, 1098, 1106, 1114, 1122,
+    1129, 1137, 1145, 1153, 1161, 1169, 1176, 1184, 1192, 1200, 1208, 1216,
+    1224, 1231, 1239, 1247, 1255, 1263, 1271, 1278, 1286, 1294, 1302, 1310,
+    1318, 1325, 1333, 1341, 1349, 1357, 1365, 1373, 1380, 1388, 1396, 1404,
+    1412, 1420, 1427, 1435, 1443, 1451, 1459, 1467, 1475, 1482, 1490, 1498,
+    1506, 1514, 1522, 1529, 1537, 1545, 1553, 1561, 1569, 1576, 1584, 1592,
+    1600, 1608, 1616, 1624, 1631, 1639, 1647, 1655, 1663, 1671, 1678, 1686,
+    1694, 1702, 1710, 1718, 1725, 1733, 1741, 1749, 1757, 1765, 1773, 1780,
+    1788, 1796, 1804, 1812, 1820, 1827, 1835, 1843, 1851, 1859, 1867, 1875,
+    1882, 1890, 1898, 1906, 1914, 1922, 1929, 1937, 1945, 1953, 1961, 1969,
+    1976, 1984, 1992, 2000
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 13, 58, 141, 266, 435, 650, 913, 1224, 1586, 2000
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 1, 2, 5, 8, 11, 16, 21, 28, 35, 43,
+    52, 62, 73, 85, 98, 112, 127, 143, 160, 178, 198, 218,
+    239, 262, 285, 310, 336, 363, 391, 420, 451, 482, 515, 549,
+    584, 620, 658, 696, 736, 777, 820, 863, 908, 954, 1001, 1050,
+    1100, 1151, 1203, 1256, 1311, 1367, 1425, 1483, 1543, 1605, 1667, 1731,
+    1796, 1863, 1931, 2000
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+    2, 3, 3, 4, 5, 5, 6, 7, 7, 8, 9, 10,
+    11, 12, 13, 14, 16, 17, 18, 19, 21, 22, 24, 25,
+    27, 29, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
+    51, 53, 56, 58, 61, 63, 66, 68, 71, 74, 77, 80,
+    83, 86, 89, 92, 96, 99, 102, 106, 109, 113, 116, 120,
+    124, 128, 132, 135, 139, 144, 148, 152, 156, 160, 165, 169,
+    174, 178, 183, 188, 193, 197, 202, 207, 212, 217, 223, 228,
+    233, 239, 244, 249, 255, 261, 266, 272, 278, 284, 290, 296,
+    302, 308, 315, 321, 327, 334, 340, 347, 354, 360, 367, 374,
+    381, 388, 395, 402, 409, 417, 424, 432, 439, 447, 454, 462,
+    470, 478, 486, 494, 502, 510, 518, 526, 535, 543, 552, 560,
+    569, 578, 586, 595, 604, 613, 622, 632, 641, 650, 659, 669,
+    678, 688, 698, 707, 717, 727, 737, 747, 757, 768, 778, 788,
+    799, 809, 820, 830, 841, 852, 863, 874, 885, 896, 907, 918,
+    929, 941, 952, 964, 976, 987, 999, 1011, 1023, 1035, 1047, 1059,
+    1071, 1084, 1096, 1108, 1121, 1134, 1146, 1159, 1172, 1185, 1198, 1211,
+    1224, 1237, 1251, 1264, 1278, 1291, 1305, 1318, 1332, 1346, 1360, 1374,
+    1388, 1402, 1417, 1431, 1445, 1460, 1474, 1489, 1504, 1519, 1533, 1548,
+    1564, 1579, 1594, 1609, 1624, 1640, 1655, 1671, 1687, 1703, 1718, 1734,
+    1750, 1766, 1783, 1799, 1815, 1832, 1848, 1865, 1881, 1898, 1915, 1932,
+    1949, 1966, 1983, 2000
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 134, 181, 245, 331, 446, 602, 813, 1098, 1482, 2000
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 104, 110, 115, 120, 126, 133, 139, 146, 153, 160, 168,
+    176, 185, 194, 203, 213, 224, 235, 246, 258, 271, 284, 298,
+    312, 327, 343, 360, 378, 396, 415, 436, 457, 479, 503, 527,
+    553, 580, 608, 638, 669, 702, 736, 772, 809, 849, 890, 934,
+    979, 1027, 1077, 1129, 1185, 1242, 1303, 1366, 1433, 1503, 1576, 1653,
+    1734, 1818, 1907, 2000
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 101, 102, 103, 104, 106, 107, 108, 109, 111, 112, 113,
+    115, 116, 117, 119, 120, 122, 123, 125, 126, 127, 129, 131,
+    132, 134, 135, 137, 138, 140, 142, 143, 145, 147, 149, 150,
+    152, 154, 156, 158, 159, 161, 163, 165, 167, 169, 171, 173,
+    175, 177, 179, 181, 184, 186, 188, 190, 192, 195, 197, 199,
+    202, 204, 207, 209, 211, 214, 216, 219, 222, 224, 227, 230,
+    232, 235, 238, 241, 243, 246, 249, 252, 255, 258, 261, 264,
+    268, 271, 274, 277, 280, 284, 287, 290, 294, 297, 301, 304,
+    308, 312, 315, 319, 323, 327, 331, 335, 338, 342, 347, 351,
+    355, 359, 363, 368, 372, 376, 381, 385, 390, 394, 399, 404,
+    409, 413, 418, 423, 428, 433, 438, 444, 449, 454, 460, 465,
+    471, 476, 482, 487, 493, 499, 505, 511, 517, 523, 529, 536,
+    542, 548, 555, 561, 568, 575, 581, 588, 595, 602, 610, 617,
+    624, 631, 639, 646, 654, 662, 670, 678, 686, 694, 702, 710,
+    719, 727, 736, 744, 753, 762, 771, 780, 790, 799, 808, 818,
+    828, 837, 847, 857, 867, 878, 888, 899, 909, 920, 931, 942,
+    953, 964, 976, 987, 999, 1011, 1023, 1035, 1047, 1060, 1072, 1085,
+    1098, 1111, 1124, 1137, 1151, 1164, 1178, 1192, 1206, 1220, 1235, 1249,
+    1264, 1279, 1294, 1309, 1325, 1341, 1357, 1373, 1389, 1405, 1422, 1439,
+    1456, 1473, 1490, 1508, 1526, 1544, 1562, 1581, 1599, 1618, 1637, 1657,
+    1676, 1696, 1716, 1737, 1757, 1778, 1799, 1820, 1842, 1864, 1886, 1908,
+    1931, 1953, 1977, 2000
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 23, 60, 125, 225, 368, 562, 815, 1134, 1526, 2000
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 4, 7, 11, 14, 18, 21, 26, 30, 36, 41, 48,
+    55, 63, 72, 81, 91, 102, 113, 126, 139, 154, 169, 185,
+    203, 221, 241, 261, 283, 306, 330, 355, 382, 410, 439, 469,
+    501, 535, 570, 606, 644, 683, 724, 766, 810, 856, 904, 953,
+    1004, 1057, 1111, 1168, 1226, 1286, 1348, 1412, 1479, 1547, 1617, 1689,
+    1764, 1840, 1919, 2000
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9, 10,
+    10, 11, 12, 13, 14, 15, 16, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 29, 30, 31, 32, 34,
+    35, 36, 38, 39, 41, 42, 44, 45, 47, 49, 51, 52,
+    54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 75, 77,
+    79, 82, 84, 86, 89, 92, 94, 97, 100, 102, 105, 108,
+    111, 114, 117, 120, 123, 126, 130, 133, 136, 140, 143, 147,
+    150, 154, 158, 161, 165, 169, 173, 177, 181, 185, 189, 194,
+    198, 202, 207, 211, 216, 220, 225, 230, 235, 240, 244, 249,
+    255, 260, 265, 270, 276, 281, 287, 292, 298, 304, 309, 315,
+    321, 327, 333, 340, 346, 352, 359, 365, 372, 378, 385, 392,
+    399, 406, 413, 420, 427, 434, 442, 449, 457, 464, 472, 480,
+    488, 496, 504, 512, 520, 528, 537, 545, 554, 562, 571, 580,
+    589, 598, 607, 616, 626, 635, 645, 654, 664, 674, 683, 693,
+    703, 714, 724, 734, 745, 755, 766, 777, 787, 798, 809, 821,
+    832, 843, 855, 866, 878, 890, 901, 913, 926, 938, 950, 962,
+    975, 988, 1000, 1013, 1026, 1039, 1052, 1066, 1079, 1092, 1106, 1120,
+    1134, 1148, 1162, 1176, 1190, 1205, 1219, 1234, 1248, 1263, 1278, 1293,
+    1309, 1324, 1339, 1355, 1371, 1387, 1403, 1419, 1435, 1451, 1468, 1484,
+    1501, 1518, 1535, 1552, 1569, 1586, 1604, 1621, 1639, 1657, 1675, 1693,
+    1711, 1729, 1748, 1766, 1785, 1804, 1823, 1842, 1861, 1881, 1900, 1920,
+    1940, 1960, 1980, 2000
+};
+
+
+#elif BRIGHTNESS_TOP == 3125
+
+static const uint16_t brightnessLinear11[11] = {
+    0, 312, 625, 938, 1250, 1562, 1875, 2188, 2500, 2812, 3125
+};
+
+static const uint16_t brightnessLinear64[64] = {
+    0, 50, 99, 149, 198, 248, 298, 347, 397, 446, 496, 546,
+    595, 645, 694, 744, 794, 843, 893, 942, 992, 1042, 1091, 1141,
+    1190, 1240, 1290, 1339, 1389, 1438, 1488, 1538, 1587, 1637, 1687, 1736,
+    1786, 1835, 1885, 1935, 1984, 2034, 2083, 2133, 2183, 2232, 2282, 2331,
+    2381, 2431, 2480, 2530, 2579, 2629, 2679, 2728, 2778, 2827, 2877, 2927,
+    2976, 3026, 3075, 3125
+};
+
+static const uint16_t brightnessLinear256[256] = {
+    0, 12, 25, 37, 49, 61, 74, 86, 98, 110, 123, 135,
+    147, 159, 172, 184, 196, 208, 221, 233, 245, 257, 270, 282,
+    294, 306, 319, 331, 343, 355, 368, 380, 392, 404, 417, 429,
+    441, 453, 466, 478, 490, 502, 515, 527, 539, 551, 564, 576,
+    588, 600, 613, 625, 637, 650, 662, 674, 686, 699, 711, 723,
+    735, 748, 760, 772, 784, 797, 809, 821, 833, 846, 858, 870,
+    882, 895, 907, 919, 931, 944, 956, 968, 980, 993, 1005, 1017,
+    1029, 1042, 1054, 1066, 1078, 1091, 1103, 1115, 1127, 1140, 1152, 1164,
+    1176, 1189, 1201, 1213, 1225, 1238, 1250, 1262, 1275, 1287, 1299, 1311,
+    1324, 1336, 1348, 1360, 1373, 1385, 1397, 1409, 1422, 1434, 1446, 1458,
+    1471, 1483, 1495, 1507, 1520, 1532, 1544, 1556, 1569, 1581, 1593, 1605,
+    1618, 1630, 1642, 1654, 1667, 1679, 1691, 1703, 1716, 1728, 1740, 1752,
+    1765, 1777, 1789, 1801, 1814, 1826, 1838, 1850, 1863, 1875, 1887, 1900,
+    1912, 1924, 1936, 1949, 1961, 1973, 1985, 1998, 2010, 2022, 2034, 2047,
+    2059, 2071, 2083, 2096, 2108, 2120, 2132, 2145, 2157, 2169, 2181, 2194,
+    2206, 2218, 2230, 2243, 2255, 2267, 2279, 2292, 2304, 2316, 2328, 2341,
+    2353, 2365, 2377, 2390, 2402, 2414, 2426, 2439, 2451, 2463, 2475, 2488,
+    2500, 2512, 2525, 2537, 2549, 2561, 2574, 2586, 2598, 2610, 2623, 2635,
+    2647, 2659, 2672, 2684, 2696, 2708, 2721, 2733, 2745, 2757, 2770, 2782,
+    2794, 2806, 2819, 2831, 2843, 2855, 2868, 2880, 2892, 2904, 2917, 2929,
+    2941, 2953, 2966, 2978, 2990, 3002, 3015, 3027, 3039, 3051, 3064, 3076,
+    3088, 3100, 3113, 3125
+};
+
+static const uint16_t brightnessGamma11[11] = {
+    0, 20, 91, 221, 416, 680, 1016, 1426, 1913, 2478, 3125
+};
+
+static const uint16_t brightnessGamma64[64] = {
+    0, 0, 2, 4, 7, 12, 18, 25, 33, 43, 54, 67,
+    81, 97, 114, 133, 153, 175, 199, 224, 250, 279, 309, 340,
+    374, 409, 446, 485, 525, 567, 611, 657, 704, 753, 805, 858,
+    912, 969, 1028, 1088, 1150, 1215, 1281, 1349, 1419, 1491, 1564, 1640,
+    1718, 1798, 1879, 1963, 2049, 2137, 2226, 2318, 2412, 2507, 2605, 2705,
+    2807, 2911, 3017, 3125
+};
+
+static const uint16_t brightnessGamma256[256] = {
+    0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 3,
+    4, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 16,
+    17, 19, 21, 22, 24, 26, 28, 30, 32, 35, 37, 40,
+    42, 45, 47, 50, 53, 56, 59, 62, 65, 69, 72, 76,
+    79, 83, 87, 91, 95, 99, 103, 107, 111, 116, 120, 125,
+    130, 134, 139, 144, 149, 154, 160, 165, 171, 176, 182, 188,
+    193, 199, 205, 212, 218, 224, 231, 237, 244, 251, 258, 265,
+    272, 279, 286, 293, 301, 308, 316, 324, 332, 340, 348, 356,
+    364, 373, 381, 390, 399, 407, 416, 425, 434, 444, 453, 462,
+    472, 482, 492, 501, 511, 521, 532, 542, 552, 563, 574, 584,
+    595, 606, 617, 628, 640, 651, 663, 674, 686, 698, 710, 722,
+    734, 746, 759, 771, 784, 797, 809, 822, 835, 849, 862, 875,
+    889, 903, 916, 930, 944, 958, 972, 987, 1001, 1016, 1030, 1045,
+    1060, 1075, 1090, 1105, 1121, 1136, 1152, 1168, 1183, 1199, 1215, 1232,
+    1248, 1264, 1281, 1297, 1314, 1331, 1348, 1365, 1382, 1400, 1417, 1435,
+    1452, 1470, 1488, 1506, 1524, 1543, 1561, 1579, 1598, 1617, 1636, 1655,
+    1674, 1693, 1712, 1732, 1752, 1771, 1791, 1811, 1831, 1851, 1872, 1892,
+    1913, 1933, 1954, 1975, 1996, 2017, 2039, 2060, 2082, 2103, 2125, 2147,
+    2169, 2191, 2213, 2236, 2258, 2281, 2304, 2327, 2350, 2373, 2396, 2419,
+    2443, 2467, 2490, 2514, 2538, 2562, 2587, 2611, 2636, 2660, 2685, 2710,
+    2735, 2760, 2785, 2811, 2836, 2862, 2887, 2913, 2939, 2966, 2992, 3018,
+    3045, 3071, 3098, 3125
+};
+
+static const uint16_t brightnessLog11[11] = {
+    0, 210, 283, 383, 517, 697, 941, 1271, 1715, 2315, 3125
+};
+
+static const uint16_t brightnessLog64[64] = {
+    0, 163, 171, 179, 188, 197, 207, 217, 228, 239, 250, 263,
+    276, 289, 303, 318, 333, 350, 367, 385, 403, 423, 444, 465,
+    488, 512, 537, 563, 590, 619, 649, 681, 714, 749, 785, 824,
+    864, 906, 950, 997, 1045, 1096, 1150, 1206, 1264, 1326, 1391, 1459,
+    1530, 1604, 1683, 1765, 1851, 1941, 2036, 2135, 2239, 2348, 2463, 2583,
+    2709, 2841, 2980, 3125
+};
+
+static const uint16_t brightnessLog256[256] = {
+    0, 157, 159, 161, 163, 165, 167, 169, 171, 173, 175, 177,
+    179, 181, 183, 186, 188, 190, 192, 195, 197, 199, 202, 204,
+    206, 209, 211, 214, 216, 219, 221, 224, 227, 229, 232, 235,
+    238, 240, 243, 246, 249, 252, 255, 258, 261, 264, 267, 270,
+    274, 277, 280, 283, 287, 290, 294, 297, 301, 304, 308, 311,
+    315, 319, 323, 326, 330, 334, 338, 342, 346, 350, 355, 359,
+    363, 367, 372, 376, 380, 385, 389, 394, 399, 403, 408, 413,
+    418, 423, 428, 433, 438, 443, 449, 454, 459, 465, 470, 476,
+    481, 487, 493, 499, 505, 511, 517, 523, 529, 535, 541, 548,
+    554, 561, 568, 574, 581, 588, 595, 602, 609, 616, 624, 631,
+    638, 646, 654, 661, 669, 677, 685, 693, 701, 710, 718, 727,
+    735, 744, 753, 762, 771, 780, 789, 798, 808, 817, 827, 837,
+    847, 857, 867, 877, 887, 898, 909, 919, 930, 941, 952, 964,
+    975, 987, 998, 1010, 1022, 1034, 1046, 1059, 1071, 1084, 1097, 1110,
+    1123, 1136, 1150, 1163, 1177, 1191, 1205, 1219, 1234, 1248, 1263, 1278,
+    1293, 1308, 1324, 1340, 1355, 1371, 1388, 1404, 1421, 1438, 1455, 1472,
+    1489, 1507, 1525, 1543, 1561, 1579, 1598, 1617, 1636, 1656, 1675, 1695,
+    1715, 1735, 1756, 1777, 1798, 1819, 1840, 1862, 1884, 1907, 1929, 1952,
+    1975, 1998, 2022, 2046, 2070, 2095, 2120, 2145, 2170, 2196, 2222, 2248,
+    2275, 2301, 2329, 2356, 2384, 2412, 2441, 2470, 2499, 2529, 2559, 2589,
+    2619, 2650, 2682, 2714, 2746, 2778, 2811, 2844, 2878, 2912, 2946, 2981,
+    3017, 3052, 3088, 3125
+};
+
+static const uint16_t brightnessCie11[11] = {
+    0, 35, 93, 195, 352, 576, 879, 1273, 1771, 2384, 3125
+};
+
+static const uint16_t brightnessCie64[64] = {
+    0, 5, 11, 16, 22, 27, 33, 40, 47, 56, 65, 75,
+    86, 98, 112, 126, 142, 159, 177, 197, 218, 240, 264, 290,
+    317, 346, 376, 408, 442, 478, 516, 555, 597, 640, 686, 734,
+    783, 836, 890, 947, 1006, 1067, 1131, 1197, 1266, 1338, 1412, 1489,
+    1569, 1651, 1736, 1825, 1916, 2010, 2107, 2207, 2310, 2417, 2526, 2639,
+    2756, 2875, 2998, 3125
+};
+
+static const uint16_t brightnessCie256[256] = {
+    0, 1, 3, 4, 5, 7, 8, 9, 11, 12, 14, 15,
+    16, 18, 19, 20, 22, 23, 24, 26, 27, 28, 30, 31,
+    33, 34, 36, 38, 39, 41, 43, 45, 47, 49, 51, 53,
+    55, 57, 59, 61, 64, 66, 69, 71, 74, 76, 79, 82,
+    85, 87, 90, 93, 96, 100, 103, 106, 110, 113, 116, 120,
+    124, 127, 131, 135, 139, 143, 147, 151, 156, 160, 164, 169,
+    173, 178, 183, 187, 192, 197, 202, 208, 213, 218, 224, 229,
+    235, 240, 246, 252, 258, 264, 270, 276, 283, 289, 296, 302,
+    309, 316, 323, 330, 337, 344, 352, 359, 367, 374, 382, 390,
+    398, 406, 414, 422, 431, 439, 448, 457, 465, 474, 484, 493,
+    502, 511, 521, 531, 540, 550, 560, 570, 581, 591, 602, 612,
+    623, 634, 645, 656, 667, 679, 690, 702, 714, 725, 738, 750,
+    762, 774, 787, 800, 813, 826, 839, 852, 865, 879, 893, 906,
+    920, 934, 949, 963, 978, 992, 1007, 1022, 1037, 1052, 1068, 1083,
+    1099, 1115, 1131, 1147, 1164, 1180, 1197, 1213, 1230, 1247, 1265, 1282,
+    1300, 1317, 1335, 1353, 1372, 1390, 1409, 1427, 1446, 1465, 1484, 1504,
+    1523, 1543, 1563, 1583, 1603, 1624, 1644, 1665, 1686, 1707, 1728, 1750,
+    1771, 1793, 1815, 1837, 1860, 1882, 1905, 1928, 1951, 1974, 1997, 2021,
+    2045, 2069, 2093, 2117, 2142, 2167, 2191, 2217, 2242, 2267, 2293, 2319,
+    2345, 2371, 2398, 2424, 2451, 2478, 2506, 2533, 2561, 2589, 2617, 2645,
+    2673, 2702, 2731, 2760, 2789, 2819, 2848, 2878, 2908, 2939, 2969, 3000,
+    3031, 3062, 3093, 3125
+};
+
+#else
+#error "no brightness tables for this BRIGHTNESS_TOP, rerun gen_brightness.py with it in --top"
+#endif
+
+#endif
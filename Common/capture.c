@@ -0,0 +1,198 @@
+// Capture-mode signal analyzer (see capture.h)
+
+#include "capture.h"
+
+#if HAL_CAP_IS_B
+#define CAP_CLR TBCLR
+#define CAP_IE TBIE
+#define CAP_IFG TBIFG
+#else
+#define CAP_CLR TACLR
+#define CAP_IE TAIE
+#define CAP_IFG TAIFG
+#endif
+
+// An edge this close after the count wraps can be taken before the overflow
+// interrupt, so its ISR looks at the overflow flag itself
+#define CAP_WRAP_TICKS 256
+
+typedef struct {
+    uint32_t outMin, outMax, outSum; // values outside the bins
+    uint16_t outliers;
+    uint16_t base; // ticks at the start of hist[0]
+    uint16_t hist[CAPTURE_BINS];
+} CaptureBins;
+
+static CaptureBins capPeriod, capHigh;
+static uint32_t capHighTicks; // high time of the period in progress
+static uint16_t capLast; // count at the last edge
+static uint16_t capWraps; // overflows since the last edge
+static uint16_t capPeriods, capMissed;
+static uint8_t capSync; // 0 no edge yet, 1 the last edge counts, 2 and so does this period's high time
+static uint8_t capLevel; // input level after the last edge, 2 before the first
+static volatile uint8_t capFull; // the window is complete, until captureRead()
+
+// Starts the capture timer continuously on p's clock source and dividers
+// (p->ccr0 is not used), with CCR1 capturing both edges of its input
+void captureInit(const PeriodConfig *p)
+{
+    HAL_CAP_TIMER(CTL) = CAP_CLR; // stopped
+    capSync = 0;
+    capLevel = 2;
+    capWraps = 0;
+    HAL_CAP_TIMER(CCTL1) = CM_3 + CCIS_0 + SCS + CAP + CCIE; // both edges of CCI1A, synchronised to the timer clock
+#if PERIOD_HAS_IDEX
+    HAL_CAP_TIMER(EX0) = p->ex; // expansion divider, latched by the clear below
+#endif
+    halCapturePin();
+    HAL_CAP_TIMER(CTL) = p->ctl + MC_2 + CAP_IE + CAP_CLR; // continuous, overflow interrupt
+}
+
+static void captureAdd(CaptureBins *b, uint32_t v)
+{
+    uint16_t bin;
+
+    if (v <= 0xFFFF) {
+        bin = (uint16_t)((uint16_t)v - b->base) >> CAPTURE_BIN_SHIFT;
+        if (bin < CAPTURE_BINS) {
+            b->hist[bin]++;
+            return;
+        }
+    }
+    if (!b->outliers || v < b->outMin)
+        b->outMin = v;
+    if (!b->outliers || v > b->outMax)
+        b->outMax = v;
+    b->outSum += v;
+    b->outliers++;
+}
+
+// Handles the capture timer's CCR1 and overflow interrupts. Returns 1 when
+// the window has just filled up and captureRead() has a result.
+uint8_t captureIrq(void)
+{
+    uint16_t cap, cctl;
+    uint32_t v;
+    uint8_t level;
+
+    switch (__even_in_range(HAL_CAP_TIMER(IV), 14)) {
+    case 2: // CCR1: an edge
+        cap = HAL_CAP_TIMER(CCR1);
+        cctl = HAL_CAP_TIMER(CCTL1);
+        level = (cctl & CCI) != 0; // the level after the edge, unless the next one came already
+
+        // Edges alternate: the same level twice, or a capture overwritten
+        // before it was read, means one went by unseen. Start over from here.
+        if ((cctl & COV) || level == capLevel) {
+            if (cctl & COV)
+                HAL_CAP_TIMER(CCTL1) = cctl & ~COV;
+            if (capSync && !capFull)
+                capMissed++;
+            capSync = 0;
+        }
+
+        if (capWraps || cap <= capLast || cap < CAP_WRAP_TICKS) {
+            // The count wrapped since the last edge, or may have just now
+            if ((HAL_CAP_TIMER(CTL) & CAP_IFG) && cap < 0x8000) {
+                HAL_CAP_TIMER(CTL) &= ~CAP_IFG; // the wrap came before this edge, count it here
+                capWraps++;
+            }
+            v = ((uint32_t)capWraps << 16) + cap - capLast;
+            capWraps = 0;
+        } else {
+            v = (uint16_t)(cap - capLast);
+        }
+        capLast = cap;
+        capLevel = level;
+
+        if (!level) { // falling: v was the high time
+            if (capSync) {
+                capHighTicks = v;
+                if (!capFull)
+                    captureAdd(&capHigh, v);
+                capSync = 2;
+            } else {
+                capSync = 1;
+            }
+        } else { // rising: v was the low time, and a period ends
+            if (capSync == 2 && !capFull) {
+                captureAdd(&capPeriod, capHighTicks + v);
+                if (++capPeriods == CAPTURE_WINDOW) {
+                    capFull = 1;
+                    return 1;
+                }
+            }
+            capSync = 1;
+        }
+        return 0;
+    case HAL_CAP_IV_OVERFLOW:
+        capWraps++;
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+// Sums up one quantity's bins, then empties them centred on the new mean
+static void captureStats(CaptureStats *s, CaptureBins *b)
+{
+    uint32_t n = b->outliers, sum = b->outSum, value;
+    uint8_t i;
+
+    s->min = b->outliers ? b->outMin : 0xFFFFFFFFUL;
+    s->max = b->outliers ? b->outMax : 0;
+    for (i = 0; i < CAPTURE_BINS; i++) {
+        s->hist[i] = b->hist[i];
+        if (!b->hist[i])
+            continue;
+        value = b->base + ((uint32_t)i << CAPTURE_BIN_SHIFT);
+        if (value < s->min)
+            s->min = value;
+        if (value + (1U << CAPTURE_BIN_SHIFT) - 1 > s->max)
+            s->max = value + (1U << CAPTURE_BIN_SHIFT) - 1;
+        n += b->hist[i];
+        sum += (value + ((1U << CAPTURE_BIN_SHIFT) >> 1)) * b->hist[i]; // bin middle
+        b->hist[i] = 0;
+    }
+    if (!n)
+        s->min = 0;
+    s->mean16 = n ? sum / n * 16 + sum % n * 16 / n : 0;
+    s->base = b->base;
+    s->outliers = b->outliers;
+
+    b->outliers = 0;
+    b->outSum = 0;
+    value = s->mean16 / 16;
+    if (n && value <= 0xFFFF)
+        b->base = value > (CAPTURE_BINS / 2 << CAPTURE_BIN_SHIFT) ?
+                  (uint16_t)(value - (CAPTURE_BINS / 2 << CAPTURE_BIN_SHIFT)) : 0;
+}
+
+// Fills r from the window that captureIrq() reported full and starts the
+// next one. Returns 0, leaving r alone, while the window is still filling.
+uint8_t captureRead(CaptureResult *r)
+{
+    uint32_t high, period;
+
+    if (!capFull)
+        return 0;
+    captureStats(&r->period, &capPeriod);
+    captureStats(&r->high, &capHigh);
+    r->periods = capPeriods;
+    r->missed = capMissed;
+    r->jitter = r->period.max - r->period.min > 0xFFFF ? 0xFFFF : (uint16_t)(r->period.max - r->period.min);
+
+    // Duty cycle in 0.1 %, the means scaled down until the product fits 32 bits
+    high = r->high.mean16;
+    period = r->period.mean16;
+    while (period > 0x3FFFFFUL) {
+        high >>= 1;
+        period >>= 1;
+    }
+    r->duty = period ? (uint16_t)((high * 1000 + period / 2) / period) : 0;
+
+    capPeriods = 0;
+    capMissed = 0;
+    capFull = 0; // the ISR collects again
+    return 1;
+}
@@ -0,0 +1,56 @@
+// Capture-mode signal analyzer on the capture timer of Common/hal.h
+//
+// captureInit() runs HAL_CAP_TIMER continuously (MC_2) and puts its CCR1 in
+// capture mode on both edges (CM_3, SCS) of the CCI1A pin, which
+// halCapturePin() routes. Each edge takes the time since the edge before: a
+// high time at a falling edge, a low time at a rising one, and high + low as
+// the period. Times are in timer ticks, extended past the 16-bit count by the
+// overflow interrupt, so periods up to 2^32 ticks measure correctly.
+//
+// The work per edge is a histogram increment. Each quantity has CAPTURE_BINS
+// bins of 2^CAPTURE_BIN_SHIFT ticks around its last mean; values outside them
+// keep an exact min, max and sum instead. After CAPTURE_WINDOW periods the
+// ISR stops collecting and captureIrq() returns 1, to wake main(), and
+// captureRead() turns the window into a CaptureResult, centres the bins on the
+// new means and starts the next window. The first window has no centre yet,
+// so its values all take the slower outlier path.
+//
+// Call captureIrq() from HAL_CAP_VECTOR. CCR0 stays free for compares at
+// times taken from HAL_CAP_TIMER(R), such as a debounce timeout.
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdint.h>
+#include "hal.h"
+#include "period.h"
+
+#define CAPTURE_BINS 16 // histogram bins per quantity
+#ifndef CAPTURE_BIN_SHIFT
+#define CAPTURE_BIN_SHIFT 0 // bins of one timer tick
+#endif
+#ifndef CAPTURE_WINDOW
+#define CAPTURE_WINDOW 1000 // periods per result
+#endif
+
+typedef struct {
+    uint32_t min, max; // timer ticks
+    uint32_t mean16; // mean, in 1/16 timer ticks
+    uint16_t base; // ticks at the start of hist[0]
+    uint16_t hist[CAPTURE_BINS]; // values per bin of 2^CAPTURE_BIN_SHIFT ticks
+    uint16_t outliers; // values outside the bins
+} CaptureStats;
+
+typedef struct {
+    CaptureStats period, high;
+    uint16_t periods; // periods in the window
+    uint16_t duty; // mean high time over mean period, in 0.1 %
+    uint16_t jitter; // period max - min, timer ticks
+    uint16_t missed; // edges out of step: a capture overwritten (COV) or read too late
+} CaptureResult;
+
+void captureInit(const PeriodConfig *p);
+uint8_t captureIrq(void);
+uint8_t captureRead(CaptureResult *r);
+
+#endif
@@ -0,0 +1,149 @@
+// Clock system bring-up, one clockInit() per clock system family (see clock.h)
+
+#include <msp430.h>
+#include "clock.h"
+
+#if defined(__MSP430G2553__)
+#if CLOCK_MHZ == 16
+#define CLOCK_CALBC1 CALBC1_16MHZ
+#define CLOCK_CALDCO CALDCO_16MHZ
+#elif CLOCK_MHZ == 12
+#define CLOCK_CALBC1 CALBC1_12MHZ
+#define CLOCK_CALDCO CALDCO_12MHZ
+#elif CLOCK_MHZ == 8
+#define CLOCK_CALBC1 CALBC1_8MHZ
+#define CLOCK_CALDCO CALDCO_8MHZ
+#else
+#define CLOCK_CALBC1 CALBC1_1MHZ
+#define CLOCK_CALDCO CALDCO_1MHZ
+#endif
+
+// Basic Clock Module+: load the factory DCO calibration for CLOCK_MHZ
+void clockInit(void)
+{
+    // The calibration lives in information segment A, which reads 0xFF once erased.
+    // Stop here rather than run every timer at an unknown rate.
+    if (CLOCK_CALBC1 == 0xFF)
+        while (1);
+
+    DCOCTL = 0; // Lowest DCOx and MODx while the range changes
+    BCSCTL1 = CLOCK_CALBC1; // Set range
+    DCOCTL = CLOCK_CALDCO; // Set DCO step and modulation
+    BCSCTL2 = 0; // MCLK = SMCLK = DCO, undivided
+    BCSCTL3 |= LFXT1S_2; // ACLK = VLO, the LaunchPad ships without the 32 kHz crystal
+}
+
+#elif defined(__MSP430F5529__)
+#if CLOCK_MHZ == 25
+#define CLOCK_VCORE 3
+#define CLOCK_DCORSEL DCORSEL_7 // DCOCLK = 2 x MCLK = 50 MHz
+#elif CLOCK_MHZ == 16
+#define CLOCK_VCORE 2
+#define CLOCK_DCORSEL DCORSEL_6 // DCOCLK = 32 MHz
+#else
+#define CLOCK_VCORE 0
+#define CLOCK_DCORSEL DCORSEL_5 // DCOCLK = 16 MHz
+#endif
+
+// Raises the core voltage by one level. Each level has to settle before the
+// next one, and MCLK may only go up once the core voltage supports it.
+static void clockSetVCoreUp(unsigned int level)
+{
+    PMMCTL0_H = PMMPW_H; // Open PMM registers for write
+    SVSMHCTL = SVSHE + SVSHRVL0 * level + SVMHE + SVSMHRRL0 * level; // High side SVS/SVM to the new level
+    SVSMLCTL = SVSLE + SVMLE + SVSMLRRL0 * level; // Low side SVM to the new level
+    while ((PMMIFG & SVSMLDLYIFG) == 0); // Wait for the SVM to settle
+    PMMIFG &= ~(SVMLVLRIFG + SVMLIFG);
+    PMMCTL0_L = PMMCOREV0 * level; // Set VCore
+    if (PMMIFG & SVMLIFG)
+        while ((PMMIFG & SVMLVLRIFG) == 0); // Wait until the new level is reached
+    SVSMLCTL = SVSLE + SVSLRVL0 * level + SVMLE + SVSMLRRL0 * level; // Low side SVS to the new level
+    PMMCTL0_H = 0x00; // Lock PMM registers
+}
+
+// Unified Clock System: FLL locked to REFO, MCLK = SMCLK = DCOCLKDIV
+void clockInit(void)
+{
+    unsigned int level;
+
+    for (level = 1; level <= CLOCK_VCORE; level++)
+        clockSetVCoreUp(level);
+
+    UCSCTL3 = SELREF_2; // FLL reference = REFO
+    UCSCTL4 = SELA_2 + SELS_4 + SELM_4; // ACLK = REFO, SMCLK = MCLK = DCOCLKDIV
+
+    __bis_SR_register(SCG0); // Disable the FLL control loop
+    UCSCTL0 = 0; // Lowest DCOx and MODx, the FLL moves them up
+    UCSCTL1 = CLOCK_DCORSEL;
+    UCSCTL2 = FLLD_1 + CLOCK_FLLN; // DCOCLKDIV = (N + 1) * 32768 Hz
+    __bic_SR_register(SCG0); // Enable the FLL control loop
+
+    // Worst-case DCO settling after a range change is
+    // 32 x 32 x f_MCLK / f_REFO MCLK cycles
+    __delay_cycles(CLOCK_MCLK_HZ / 32);
+
+    do {
+        UCSCTL7 &= ~(XT2OFFG + XT1LFOFFG + DCOFFG); // Clear fault flags
+        SFRIFG1 &= ~OFIFG;
+    } while (SFRIFG1 & OFIFG);
+}
+
+#elif defined(__MSP430FR5994__) || defined(__MSP430FR6989__)
+#if CLOCK_MHZ == 16
+#define CLOCK_DCOFSEL (DCORSEL + DCOFSEL_4)
+#else
+#define CLOCK_DCOFSEL DCOFSEL_6
+#endif
+
+// Clock System: MCLK = SMCLK = DCO, ACLK = LFXT
+void clockInit(void)
+{
+    PJSEL0 |= BIT4 + BIT5; // PJ.4/PJ.5 to the LFXT crystal
+
+#if CLOCK_MHZ > 8
+    FRCTL0 = FRCTLPW + NWAITS_1; // FRAM runs at 8 MHz at most, add a wait state first
+#endif
+
+    CSCTL0_H = CSKEY_H; // Unlock CS registers
+    CSCTL1 = DCOFSEL_0; // 1 MHz while the dividers change
+    CSCTL2 = SELA__LFXTCLK + SELS__DCOCLK + SELM__DCOCLK;
+    // Errata CS12: divide by 4 across the DCO change so the overshoot stays in spec
+    CSCTL3 = DIVA__4 + DIVS__4 + DIVM__4;
+    CSCTL1 = CLOCK_DCOFSEL;
+    __delay_cycles(60);
+    CSCTL3 = DIVA__1 + DIVS__1 + DIVM__1;
+
+    CSCTL4 &= ~LFXTOFF; // Start the crystal
+    do {
+        CSCTL5 &= ~LFXTOFFG; // Clear fault flags
+        SFRIFG1 &= ~OFIFG;
+    } while (SFRIFG1 & OFIFG);
+    CSCTL0_H = 0; // Lock CS registers
+}
+
+#elif defined(__MSP430FR2311__)
+#if CLOCK_MHZ == 16
+#define CLOCK_DCORSEL DCORSEL_5
+#else
+#define CLOCK_DCORSEL DCORSEL_3
+#endif
+
+// Clock System: FLL locked to REFO, MCLK = SMCLK = DCOCLKDIV, ACLK = REFO
+void clockInit(void)
+{
+#if CLOCK_MHZ > 8
+    FRCTL0 = FRCTLPW + NWAITS_1; // FRAM runs at 8 MHz at most, add a wait state first
+#endif
+
+    __bis_SR_register(SCG0); // Disable the FLL control loop
+    CSCTL3 |= SELREF__REFOCLK; // FLL reference = REFO
+    CSCTL0 = 0; // Lowest DCO tap and modulation, the FLL moves them up
+    CSCTL1 = (CSCTL1 & ~DCORSEL_7) | CLOCK_DCORSEL;
+    CSCTL2 = FLLD_0 + CLOCK_FLLN; // DCOCLKDIV = (N + 1) * 32768 Hz
+    __delay_cycles(3);
+    __bic_SR_register(SCG0); // Enable the FLL control loop
+    while (CSCTL7 & (FLLUNLOCK0 | FLLUNLOCK1)); // Wait for the FLL to lock
+
+    CSCTL4 = SELMS__DCOCLKDIV + SELA__REFOCLK;
+}
+#endif
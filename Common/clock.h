@@ -0,0 +1,70 @@
+// Clock system bring-up
+//
+// clockInit() moves MCLK and SMCLK from the ~1 MHz power-on DCO to CLOCK_MHZ and
+// selects a known ACLK. CLOCK_MCLK_HZ, CLOCK_SMCLK_HZ and CLOCK_ACLK_HZ are the
+// rates it produces; timer setup derives its constants from them.
+//
+// CLOCK_MHZ (default 16, override with -DCLOCK_MHZ=n) per board:
+//   MSP430G2553        1, 8, 12, 16  factory DCO calibration (CALBC1/CALDCO)
+//   MSP430F5529        8, 16, 25     UCS, FLL locked to REFO, VCore raised as needed
+//   MSP430FR5994/6989  8, 16         CS DCO, one FRAM wait state above 8 MHz
+//   MSP430FR2311       8, 16         CS, FLL locked to REFO, one FRAM wait state above 8 MHz
+//
+// CLOCK_LPM3 (default 0, override with -DCLOCK_LPM3=1) keeps the timers off
+// SMCLK. Programs solve their periods from CLOCK_TIMER_SMCLK_HZ, which is then
+// 0, so Common/period.h picks ACLK, and sleep in CLOCK_LPM_BITS, LPM3 instead
+// of LPM0. Between events only ACLK runs; the CPU, SMCLK and the DCO stop.
+
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#ifndef CLOCK_MHZ
+#define CLOCK_MHZ 16
+#endif
+
+#if defined(__MSP430G2553__)
+#if CLOCK_MHZ != 1 && CLOCK_MHZ != 8 && CLOCK_MHZ != 12 && CLOCK_MHZ != 16
+#error "MSP430G2553: CLOCK_MHZ must be 1, 8, 12 or 16 (calibrated DCO rates)"
+#endif
+#define CLOCK_MCLK_HZ (CLOCK_MHZ * 1000000UL) // calibrated to about +-1 %
+#define CLOCK_ACLK_HZ 12000UL // VLO, typical (4-20 kHz across parts and temperature)
+
+#elif defined(__MSP430F5529__) || defined(__MSP430FR2311__)
+#if defined(__MSP430F5529__) && CLOCK_MHZ != 8 && CLOCK_MHZ != 16 && CLOCK_MHZ != 25
+#error "MSP430F5529: CLOCK_MHZ must be 8, 16 or 25"
+#endif
+#if defined(__MSP430FR2311__) && CLOCK_MHZ != 8 && CLOCK_MHZ != 16
+#error "MSP430FR2311: CLOCK_MHZ must be 8 or 16"
+#endif
+// FLL multiplier: DCOCLKDIV = (CLOCK_FLLN + 1) * 32768 Hz, nearest to CLOCK_MHZ
+#define CLOCK_FLLN ((CLOCK_MHZ * 1000000UL + 16384) / 32768 - 1)
+#define CLOCK_MCLK_HZ ((CLOCK_FLLN + 1) * 32768UL)
+#define CLOCK_ACLK_HZ 32768UL // REFO
+
+#elif defined(__MSP430FR5994__) || defined(__MSP430FR6989__)
+#if CLOCK_MHZ != 8 && CLOCK_MHZ != 16
+#error "MSP430FR5994/FR6989: CLOCK_MHZ must be 8 or 16"
+#endif
+#define CLOCK_MCLK_HZ (CLOCK_MHZ * 1000000UL) // factory trimmed DCO
+#define CLOCK_ACLK_HZ 32768UL // LFXT crystal on the LaunchPad
+
+#else
+#error "clock.h: unsupported device"
+#endif
+
+#define CLOCK_SMCLK_HZ CLOCK_MCLK_HZ // SMCLK runs undivided from the same source
+
+#ifndef CLOCK_LPM3
+#define CLOCK_LPM3 0
+#endif
+#if CLOCK_LPM3
+#define CLOCK_TIMER_SMCLK_HZ 0UL // timers on ACLK only
+#define CLOCK_LPM_BITS LPM3_bits
+#else
+#define CLOCK_TIMER_SMCLK_HZ CLOCK_SMCLK_HZ
+#define CLOCK_LPM_BITS LPM0_bits
+#endif
+
+void clockInit(void);
+
+#endif
@@ -0,0 +1,33 @@
+// ISR-to-main event queue (see event_queue.h)
+
+#include <msp430.h>
+#include "event_queue.h"
+
+volatile Event eventRing[EVENT_QUEUE_SIZE];
+volatile uint8_t eventHead = 0;
+volatile uint8_t eventTail = 0;
+volatile uint8_t eventHighWater = 0;
+volatile uint8_t eventDropped = 0;
+
+// Empties the ring and clears the statistics, before interrupts are enabled
+void eventInit(void)
+{
+    eventHead = 0;
+    eventTail = 0;
+    eventHighWater = 0;
+    eventDropped = 0;
+}
+
+// Sleeps in LPM0 until an event is waiting, returns with interrupts enabled
+//
+// The check runs with interrupts off, and LPM0 and GIE are set by the same
+// instruction, so a post that lands between the check and the sleep still
+// wakes the CPU. The posting ISR has to clear LPM0 on exit.
+void eventWait(void)
+{
+    __disable_interrupt();
+    if (eventHead == eventTail)
+        __bis_SR_register(LPM0_bits + GIE);
+    else
+        __enable_interrupt();
+}
@@ -0,0 +1,89 @@
+// ISR-to-main event queue
+//
+// A single-producer/single-consumer ring of small timestamped events. ISRs
+// post, main() takes them out and goes back to LPM when the ring is empty.
+// On the MSP430 interrupts do not nest unless an ISR sets GIE again, so all
+// ISRs together form the one producer.
+//
+// The producer only writes eventHead and the consumer only writes eventTail.
+// Both are bytes, which the CPU loads and stores in one instruction, and the
+// slot is written before eventHead moves on, so neither side ever disables
+// interrupts. The indices run freely and are masked with EVENT_QUEUE_SIZE - 1,
+// which needs a power of two and no division.
+//
+// eventHighWater keeps the most events that were ever waiting at once and
+// eventDropped counts posts that found the ring full. Read them from the
+// debugger to size EVENT_QUEUE_SIZE.
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <stdint.h>
+
+// Slots in the ring, a power of two up to 128
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 8
+#endif
+#if EVENT_QUEUE_SIZE < 2 || EVENT_QUEUE_SIZE > 128 || (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1))
+#error "EVENT_QUEUE_SIZE must be a power of two from 2 to 128"
+#endif
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE - 1)
+
+// Event types
+#define EVENT_PRESS   1 // debounced press, data is the button
+#define EVENT_RELEASE 2 // debounced release, data is the button
+#define EVENT_PERIOD  3 // a timer period completed, data is up to the program
+
+typedef struct {
+    uint8_t type;
+    uint8_t data;
+    uint16_t time; // in the program's time base, see its eventPost() calls
+} Event;
+
+extern volatile Event eventRing[EVENT_QUEUE_SIZE];
+extern volatile uint8_t eventHead; // next slot to write, producer only
+extern volatile uint8_t eventTail; // next slot to read, consumer only
+extern volatile uint8_t eventHighWater;
+extern volatile uint8_t eventDropped;
+
+// Called from an ISR: returns 0 and drops the event when the ring is full
+static inline uint8_t eventPost(uint8_t type, uint8_t data, uint16_t time)
+{
+    uint8_t head = eventHead;
+    uint8_t used = (uint8_t)(head - eventTail);
+    volatile Event *e;
+
+    if (used == EVENT_QUEUE_SIZE) {
+        eventDropped++;
+        return 0;
+    }
+    e = &eventRing[head & EVENT_QUEUE_MASK];
+    e->type = type;
+    e->data = data;
+    e->time = time;
+    eventHead = head + 1; // publishes the slot
+    if (++used > eventHighWater)
+        eventHighWater = used;
+    return 1;
+}
+
+// Called from main(): copies the oldest event to *e, returns 0 when empty
+static inline uint8_t eventGet(Event *e)
+{
+    uint8_t tail = eventTail;
+    volatile Event *slot;
+
+    if (tail == eventHead)
+        return 0;
+    slot = &eventRing[tail & EVENT_QUEUE_MASK];
+    e->type = slot->type;
+    e->data = slot->data;
+    e->time = slot->time;
+    eventTail = tail + 1; // frees the slot
+    return 1;
+}
+
+void eventInit(void);
+void eventWait(void);
+
+#endif
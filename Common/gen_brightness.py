@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Generates the perceptual brightness tables in brightness_tables.h.
+
+Every table maps a step index (0 .. steps-1) to a PWM compare value
+(0 .. top). Index 0 is always fully off and the last index always equals
+top, so stepping through a table goes from dark to full brightness.
+
+Curves:
+  Linear  y = x
+  Gamma   y = x ^ gamma                    (gamma 2.2 by default)
+  Log     y = e^(k (x - 1))                (k = 3, the model used in extra.c)
+  Cie     inverse CIE 1931 lightness L* -> relative luminance Y
+
+Every --top gets its own set of tables, already in the units of that PWM
+resolution, under #if BRIGHTNESS_TOP == top. The program defines
+BRIGHTNESS_TOP before including brightness.h, so stepping the brightness is
+one indexed load with no scaling, and a resolution without tables fails to
+build. The checked-in header covers the Software PWM modes: the bitmask
+slots (100), the BAM levels (255) and the duty timer ticks at every
+CLOCK_MHZ (SMCLK / 8 / 1 kHz).
+
+Run from the Common directory, for example:
+  python3 gen_brightness.py --top 100,125,255,999,1000,1500,1998,2000,3125 > brightness_tables.h
+"""
+
+import argparse
+import math
+
+CURVES = ["Linear", "Gamma", "Log", "Cie"]
+
+
+def curve(name, x, gamma, k):
+    if x <= 0.0:
+        return 0.0
+    if name == "Linear":
+        return x
+    if name == "Gamma":
+        return x ** gamma
+    if name == "Log":
+        return math.exp(k * (x - 1.0))
+    if name == "Cie":
+        lightness = 100.0 * x
+        if lightness <= 8.0:
+            return lightness / 903.3
+        return ((lightness + 16.0) / 116.0) ** 3
+    raise ValueError(name)
+
+
+def table(name, steps, top, gamma, k):
+    values = []
+    for i in range(steps):
+        x = i / (steps - 1)
+        values.append(int(round(curve(name, x, gamma, k) * top)))
+    values[0] = 0
+    values[-1] = top
+    return values
+
+
+def emit(name, steps, values):
+    lines = ["static const uint16_t brightness%s%d[%d] = {" % (name, steps, steps)]
+    for i in range(0, steps, 12):
+        row = ", ".join("%d" % v for v in values[i:i + 12])
+        lines.append("    " + row + ("," if i + 12 < steps else ""))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--top", default="100",
+                        help="comma separated PWM compare values for full brightness")
+    parser.add_argument("--steps", default="11,64,256",
+                        help="comma separated step counts")
+    parser.add_argument("--curves", default=",".join(CURVES),
+                        help="comma separated subset of " + ", ".join(CURVES))
+    parser.add_argument("--gamma", type=float, default=2.2)
+    parser.add_argument("--k", type=float, default=3.0,
+                        help="steepness of the Log curve")
+    args = parser.parse_args()
+
+    tops = [int(t) for t in args.top.split(",")]
+    steps = [int(s) for s in args.steps.split(",")]
+    curves = args.curves.split(",")
+    for top in tops:
+        if not 0 < top <= 0xFFFF:
+            parser.error("a top must fit 16 bits")
+    for name in curves:
+        if name not in CURVES:
+            parser.error("unknown curve " + name)
+    for n in steps:
+        if n < 2:
+            parser.error("a table needs at least 2 steps")
+
+    print("// Generated by gen_brightness.py --top %s --steps %s --curves %s "
+          "--gamma %g --k %g" % (args.top, args.steps, args.curves, args.gamma, args.k))
+    print("// Do not edit by hand, rerun the generator instead.")
+    print()
+    print("#ifndef BRIGHTNESS_TABLES_H")
+    print("#define BRIGHTNESS_TABLES_H")
+    print()
+    print("#include <stdint.h>")
+    for i, top in enumerate(tops):
+        print()
+        print("#%s BRIGHTNESS_TOP == %d" % ("if" if i == 0 else "elif", top))
+        for name in curves:
+            for n in steps:
+                print()
+                print(emit(name, n, table(name, n, top, args.gamma, args.k)))
+        print()
+    print("#else")
+    print('#error "no brightness tables for this BRIGHTNESS_TOP, rerun gen_brightness.py with it in --top"')
+    print("#endif")
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,70 @@
+// Button gesture recognizer (see gesture.h)
+
+#include "event_queue.h"
+#include "gesture.h"
+
+// States; the top bit marks the ones with a deadline
+#define GESTURE_IDLE     0x00 // released
+#define GESTURE_DOWN     0x81 // first press, long press at the deadline
+#define GESTURE_GAP      0x82 // released after a short press, click at the deadline
+#define GESTURE_DOWN2    0x03 // second press of a double-click
+#define GESTURE_HELD     0x84 // long press reported, repeat at the deadline
+
+// Wraparound-safe "time has reached the deadline"
+#define GESTURE_DUE(g, t) ((int16_t)((uint16_t)(t) - (g)->deadline) >= 0)
+
+void gestureInit(Gesture *g, uint16_t longTicks, uint16_t doubleTicks, uint16_t repeatTicks)
+{
+    g->state = GESTURE_IDLE;
+    g->deadline = 0;
+    g->longTicks = longTicks;
+    g->doubleTicks = doubleTicks;
+    g->repeatTicks = repeatTicks;
+}
+
+// Feeds one event: EVENT_PRESS, EVENT_RELEASE, or EVENT_PERIOD once time has
+// moved on. Returns the gesture it completes, GESTURE_NONE if there is none yet.
+//
+// An EVENT_PERIOD before the deadline is ignored. One that comes late still
+// keeps the repeat cadence, because the next deadline counts from the last one.
+uint8_t gestureInput(Gesture *g, uint8_t type, uint16_t time)
+{
+    switch (type) {
+    case EVENT_PRESS:
+        if (g->state == GESTURE_GAP) {
+            g->state = GESTURE_DOWN2;
+            return GESTURE_DOUBLE;
+        }
+        g->state = GESTURE_DOWN;
+        g->deadline = time + g->longTicks;
+        break;
+
+    case EVENT_RELEASE:
+        if (g->state == GESTURE_DOWN) {
+            if (g->doubleTicks == 0) {
+                g->state = GESTURE_IDLE;
+                return GESTURE_CLICK;
+            }
+            g->state = GESTURE_GAP;
+            g->deadline = time + g->doubleTicks;
+            break;
+        }
+        g->state = GESTURE_IDLE; // end of a long press or of a double-click
+        break;
+
+    case EVENT_PERIOD:
+        if (!gestureWaiting(g) || !GESTURE_DUE(g, time))
+            break;
+        if (g->state == GESTURE_GAP) {
+            g->state = GESTURE_IDLE;
+            return GESTURE_CLICK;
+        }
+        g->deadline += g->repeatTicks;
+        if (g->state == GESTURE_DOWN) {
+            g->state = GESTURE_HELD;
+            return GESTURE_LONG;
+        }
+        return GESTURE_REPEAT;
+    }
+    return GESTURE_NONE;
+}
@@ -0,0 +1,47 @@
+// Button gesture recognizer: click, double-click, long press and auto-repeat
+//
+// Runs on the debounced press and release events of event_queue.h and on their
+// time stamps. A gesture that depends on time passing (a long press, the end of
+// the double-click window, the next repeat) sets `deadline`. The program wakes
+// up once at that time, from a timer it already has, and feeds an EVENT_PERIOD.
+// No time is busy-waited and no timer is started per gesture, so the CPU sleeps
+// between events. Every call is a few compares, the same for every event.
+//
+//   click         press and release, then no second press within `doubleTicks`
+//   double-click  a second press within `doubleTicks` of the first release
+//   long press    held for `longTicks`
+//   repeat        still held, every `repeatTicks` after the long press
+//
+// A click is reported when the double-click window ends. Setting doubleTicks to
+// 0 reports it on the release instead and turns double-click off.
+//
+// Times are 16-bit counts in the caller's time base and may wrap. Deadlines must
+// stay less than half the range ahead.
+
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <stdint.h>
+
+// Gestures returned by gestureInput()
+#define GESTURE_NONE   0
+#define GESTURE_CLICK  1
+#define GESTURE_DOUBLE 2
+#define GESTURE_LONG   3
+#define GESTURE_REPEAT 4
+
+typedef struct {
+    uint8_t state;
+    uint16_t deadline;    // when the next time-driven step is due, see gestureWaiting()
+    uint16_t longTicks;   // hold time of a long press
+    uint16_t doubleTicks; // gap that still makes a double-click, 0 = no double-click
+    uint16_t repeatTicks; // repeat interval while held after a long press
+} Gesture;
+
+void gestureInit(Gesture *g, uint16_t longTicks, uint16_t doubleTicks, uint16_t repeatTicks);
+uint8_t gestureInput(Gesture *g, uint8_t type, uint16_t time);
+
+// Nonzero while g->deadline is pending
+#define gestureWaiting(g) ((g)->state & 0x80)
+
+#endif
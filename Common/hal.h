@@ -0,0 +1,472 @@
+// Board abstraction for the lab programs
+//
+// Maps the LEDs, the button, the two general purpose timers and the spare pins
+// of each LaunchPad onto one set of names, selected by the device define the
+// compiler sets (-mmcu=msp430g2553, or the device chosen in the CCS project).
+// Everything here is a macro or a static inline function that reduces to the
+// same register access the board-specific code used to spell out, so a program
+// written against these names compiles to the same instructions.
+//
+// halLedInit() takes the other P1 outputs of the program so they are set in
+// the same store as the LED pins.
+//
+// HAL_PWMCH_TIMER(reg) is the timer whose outputs Common/pwm.c drives as PWM
+// channels, HAL_PWMCH_COUNT of them, and halPwmChannelPins() routes their pins.
+// HAL_CAP_TIMER(reg) is the timer whose CCR1 Common/capture.c uses to capture
+// an input signal, and halCapturePin() routes its CCI1A pin.
+//
+// HAL_BTN_PORT and HAL_BTN_PIN give the button's port and pin as numbers for
+// Common/portirq.h, and HAL_PORT_IV says whether the ports have PxIV.
+//
+// HAL_TIMER0(reg)/HAL_TIMER1(reg) paste the register name onto the timer, so
+// HAL_TIMER0(CTL) is TA0CTL on most boards and TB0CTL on the MSP430FR2311,
+// which has no Timer_A. TIMER0 is the debounce timer in every lab.
+
+#ifndef HAL_H
+#define HAL_H
+
+#include <msp430.h>
+
+#if defined(__MSP430G2553__)
+
+#define HAL_FRAM 0
+#define HAL_PORT_IV 0 // the 2xx ports have no PxIV, Common/portirq.h scans PxIFG
+
+// LED1 red P1.0, LED2 green P1.6, button S2 P1.3
+#define HAL_LED1_DIR P1DIR
+#define HAL_LED1_OUT P1OUT
+#define HAL_LED1_BIT BIT0
+#define HAL_LED2_DIR P1DIR
+#define HAL_LED2_OUT P1OUT
+#define HAL_LED2_BIT BIT6
+#define HAL_LED2_ON_P1 1
+
+#define HAL_BTN_IN P1IN
+#define HAL_BTN_OUT P1OUT
+#define HAL_BTN_REN P1REN
+#define HAL_BTN_IE P1IE
+#define HAL_BTN_IES P1IES
+#define HAL_BTN_IFG P1IFG
+#define HAL_BTN_BIT BIT3
+#define HAL_BTN_VECTOR PORT1_VECTOR
+#define HAL_BTN_PORT 1 // port and pin number, for PORT_DISPATCH
+#define HAL_BTN_PIN 3
+#define HAL_BTN_ON_P1 1
+
+// Hardware PWM output: TA0.1 on P1.6 (LED2)
+#define HAL_PWM_TIMER_IS_1 0
+#define HAL_PWM_DIR P1DIR
+#define HAL_PWM_SEL P1SEL
+#define HAL_PWM_BIT BIT6
+#define HAL_PWM_LED 2 // LED the output drives, 0 for none
+
+// PWM channels (Common/pwm.c): channel n is output n + 1 of the channel timer.
+// The 20-pin part brings out TA0.1 only (P1.6, LED2).
+#define HAL_PWMCH_TIMER(reg) TA0##reg
+#define HAL_PWMCH_VECTOR TIMER0_A0_VECTOR
+#define HAL_PWMCH_IS_B 0
+#define HAL_PWMCH_COUNT 1
+
+static inline void halPwmChannelPins(void)
+{
+    P1DIR |= BIT6;
+    P1SEL |= BIT6; // TA0.1
+}
+
+// Capture input (Common/capture.c): CCR1 of TA1, which times the button in
+// Hardware PWM, with CCI1A on P2.1
+#define HAL_CAP_TIMER(reg) TA1##reg
+#define HAL_CAP_VECTOR TIMER1_A1_VECTOR
+#define HAL_CAP_IS_B 0
+#define HAL_CAP_IV_OVERFLOW 10 // TAIFG in TA1IV, right after CCR2 on the Timer_A3
+
+static inline void halCapturePin(void)
+{
+    P2DIR &= ~BIT1;
+    P2SEL |= BIT1; // TA1.1 CCI1A
+}
+
+// Spare 8-bit port (scheduler channels 0-7) and P1 pins free for PWM channels
+#define HAL_SPARE_OUT P2OUT
+#define HAL_SPARE_DIR P2DIR
+#define HAL_SPARE_PINS 0xFF
+#define HAL_P1_PWM_PINS (BIT0 + BIT4 + BIT5 + BIT7) // P1.1/P1.2 are the UART, P1.3 the button
+
+static inline void halLedInit(unsigned char p1Outputs)
+{
+    P1DIR = BIT0 + BIT6 + p1Outputs; // Set P1.0, P1.6 and any other P1 outputs
+}
+
+static inline void halSpareInit(void)
+{
+    P2SEL &= ~(BIT6 + BIT7); // P2.6 and P2.7 default to the crystal pins
+}
+
+#elif defined(__MSP430F5529__)
+
+#define HAL_FRAM 0
+#define HAL_PORT_IV 1 // PxIV names the highest-priority pending pin
+
+// LED1 red P1.0, LED2 green P4.7, button S2 P1.1
+#define HAL_LED1_DIR P1DIR
+#define HAL_LED1_OUT P1OUT
+#define HAL_LED1_BIT BIT0
+#define HAL_LED2_DIR P4DIR
+#define HAL_LED2_OUT P4OUT
+#define HAL_LED2_BIT BIT7
+#define HAL_LED2_ON_P1 0
+
+#define HAL_BTN_IN P1IN
+#define HAL_BTN_OUT P1OUT
+#define HAL_BTN_REN P1REN
+#define HAL_BTN_IE P1IE
+#define HAL_BTN_IES P1IES
+#define HAL_BTN_IFG P1IFG
+#define HAL_BTN_BIT BIT1
+#define HAL_BTN_VECTOR PORT1_VECTOR
+#define HAL_BTN_PORT 1 // port and pin number, for PORT_DISPATCH
+#define HAL_BTN_PIN 1
+#define HAL_BTN_ON_P1 1
+
+// Hardware PWM output: TA0.1 on P1.2 (header pin, no LED)
+#define HAL_PWM_TIMER_IS_1 0
+#define HAL_PWM_DIR P1DIR
+#define HAL_PWM_SEL P1SEL
+#define HAL_PWM_BIT BIT2
+#define HAL_PWM_LED 0 // LED the output drives, 0 for none
+
+// PWM channels (Common/pwm.c): channel n is output n + 1 of the channel timer,
+// TA0.1-TA0.4 on the header pins P1.2-P1.5
+#define HAL_PWMCH_TIMER(reg) TA0##reg
+#define HAL_PWMCH_VECTOR TIMER0_A0_VECTOR
+#define HAL_PWMCH_IS_B 0
+#define HAL_PWMCH_COUNT 4
+
+static inline void halPwmChannelPins(void)
+{
+    P1DIR |= BIT2 + BIT3 + BIT4 + BIT5;
+    P1SEL |= BIT2 + BIT3 + BIT4 + BIT5; // TA0.1-TA0.4
+}
+
+// Capture input (Common/capture.c): CCR1 of TA1, which times the button in
+// Hardware PWM, with CCI1A on P2.0
+#define HAL_CAP_TIMER(reg) TA1##reg
+#define HAL_CAP_VECTOR TIMER1_A1_VECTOR
+#define HAL_CAP_IS_B 0
+#define HAL_CAP_IV_OVERFLOW 14 // TAIFG in TA1IV
+
+static inline void halCapturePin(void)
+{
+    P2DIR &= ~BIT0;
+    P2SEL |= BIT0; // TA1.1 CCI1A
+}
+
+#define HAL_SPARE_OUT P6OUT
+#define HAL_SPARE_DIR P6DIR
+#define HAL_SPARE_PINS 0xFF
+#define HAL_P1_PWM_PINS (0xFF & ~BIT1) // every P1 pin except the button
+
+static inline void halLedInit(unsigned char p1Outputs)
+{
+    P1DIR = BIT0 + p1Outputs; // Set P1.0 and any other P1 outputs
+    P4DIR = BIT7; // Set P4.7 as output
+}
+
+static inline void halSpareInit(void)
+{
+}
+
+#elif defined(__MSP430FR2311__)
+
+#define HAL_FRAM 1
+#define HAL_PORT_IV 1 // PxIV names the highest-priority pending pin
+
+// LED1 red P1.0, LED2 green P2.0, button S1 P1.1
+#define HAL_LED1_DIR P1DIR
+#define HAL_LED1_OUT P1OUT
+#define HAL_LED1_BIT BIT0
+#define HAL_LED2_DIR P2DIR
+#define HAL_LED2_OUT P2OUT
+#define HAL_LED2_BIT BIT0
+#define HAL_LED2_ON_P1 0
+
+#define HAL_BTN_IN P1IN
+#define HAL_BTN_OUT P1OUT
+#define HAL_BTN_REN P1REN
+#define HAL_BTN_IE P1IE
+#define HAL_BTN_IES P1IES
+#define HAL_BTN_IFG P1IFG
+#define HAL_BTN_BIT BIT1
+#define HAL_BTN_VECTOR PORT1_VECTOR
+#define HAL_BTN_PORT 1 // port and pin number, for PORT_DISPATCH
+#define HAL_BTN_PIN 1
+#define HAL_BTN_ON_P1 1
+
+// Hardware PWM output: TB1.1 on P2.0 (LED2)
+#define HAL_PWM_TIMER_IS_1 1
+#define HAL_PWM_DIR P2DIR
+#define HAL_PWM_SEL P2SEL0
+#define HAL_PWM_BIT BIT0
+#define HAL_PWM_LED 2 // LED the output drives, 0 for none
+
+// PWM channels (Common/pwm.c): channel n is output n + 1 of the channel timer,
+// TB1.1 on P2.0 (LED2) and TB1.2 on P2.1. TBCLGRP_1 loads CCR1 and CCR2 together.
+#define HAL_PWMCH_TIMER(reg) TB1##reg
+#define HAL_PWMCH_VECTOR TIMER1_B0_VECTOR
+#define HAL_PWMCH_IS_B 1
+#define HAL_PWMCH_CLGRP TBCLGRP_1
+#define HAL_PWMCH_COUNT 2
+
+static inline void halPwmChannelPins(void)
+{
+    P2DIR |= BIT0 + BIT1;
+    P2SEL1 &= ~(BIT0 + BIT1);
+    P2SEL0 |= BIT0 + BIT1; // TB1.1, TB1.2
+}
+
+// Capture input (Common/capture.c): CCR1 of TB0, which times the button in
+// Hardware PWM, with CCI1A on P1.6
+#define HAL_CAP_TIMER(reg) TB0##reg
+#define HAL_CAP_VECTOR TIMER0_B1_VECTOR
+#define HAL_CAP_IS_B 1
+#define HAL_CAP_IV_OVERFLOW 14 // TBIFG in TB0IV
+
+static inline void halCapturePin(void)
+{
+    P1DIR &= ~BIT6;
+    P1SEL0 &= ~BIT6;
+    P1SEL1 |= BIT6; // TB0.1 CCI1A, the secondary function
+}
+
+#define HAL_SPARE_OUT P2OUT
+#define HAL_SPARE_DIR P2DIR
+#define HAL_SPARE_PINS 0xFE // P2.0 is LED2
+#define HAL_P1_PWM_PINS (0xFF & ~BIT1) // every P1 pin except the button
+
+static inline void halLedInit(unsigned char p1Outputs)
+{
+    P1DIR = BIT0 + p1Outputs; // Set P1.0 and any other P1 outputs
+    P2DIR = BIT0; // Set P2.0 as output
+}
+
+static inline void halSpareInit(void)
+{
+}
+
+#elif defined(__MSP430FR5994__)
+
+#define HAL_FRAM 1
+#define HAL_PORT_IV 1 // PxIV names the highest-priority pending pin
+
+// LED1 red P1.0, LED2 green P1.1, button S2 P5.5
+#define HAL_LED1_DIR P1DIR
+#define HAL_LED1_OUT P1OUT
+#define HAL_LED1_BIT BIT0
+#define HAL_LED2_DIR P1DIR
+#define HAL_LED2_OUT P1OUT
+#define HAL_LED2_BIT BIT1
+#define HAL_LED2_ON_P1 1
+
+#define HAL_BTN_IN P5IN
+#define HAL_BTN_OUT P5OUT
+#define HAL_BTN_REN P5REN
+#define HAL_BTN_IE P5IE
+#define HAL_BTN_IES P5IES
+#define HAL_BTN_IFG P5IFG
+#define HAL_BTN_BIT BIT5
+#define HAL_BTN_VECTOR PORT5_VECTOR
+#define HAL_BTN_PORT 5 // port and pin number, for PORT_DISPATCH
+#define HAL_BTN_PIN 5
+#define HAL_BTN_ON_P1 0
+
+// Hardware PWM output: TA0.1 on P1.0 (LED1)
+#define HAL_PWM_TIMER_IS_1 0
+#define HAL_PWM_DIR P1DIR
+#define HAL_PWM_SEL P1SEL0
+#define HAL_PWM_BIT BIT0
+#define HAL_PWM_LED 1 // LED the output drives, 0 for none
+
+// PWM channels (Common/pwm.c): channel n is output n + 1 of the channel timer,
+// TB0.1/TB0.2 on P1.4/P1.5 and TB0.3-TB0.6 on P3.4-P3.7. TA0, the LED PWM, is
+// not started in channel mode, so LED1 stays dark. TBCLGRP_3 loads every latch together.
+#define HAL_PWMCH_TIMER(reg) TB0##reg
+#define HAL_PWMCH_VECTOR TIMER0_B0_VECTOR
+#define HAL_PWMCH_IS_B 1
+#define HAL_PWMCH_CLGRP TBCLGRP_3
+#define HAL_PWMCH_COUNT 6
+
+static inline void halPwmChannelPins(void)
+{
+    P1DIR |= BIT4 + BIT5;
+    P1SEL1 &= ~(BIT4 + BIT5);
+    P1SEL0 |= BIT4 + BIT5; // TB0.1, TB0.2: primary function
+    P3DIR |= BIT4 + BIT5 + BIT6 + BIT7;
+    P3SEL0 &= ~(BIT4 + BIT5 + BIT6 + BIT7);
+    P3SEL1 |= BIT4 + BIT5 + BIT6 + BIT7; // TB0.3-TB0.6: secondary function
+}
+
+// Capture input (Common/capture.c): CCR1 of TA1, which times the button in
+// Hardware PWM, with CCI1A on P1.2
+#define HAL_CAP_TIMER(reg) TA1##reg
+#define HAL_CAP_VECTOR TIMER1_A1_VECTOR
+#define HAL_CAP_IS_B 0
+#define HAL_CAP_IV_OVERFLOW 14 // TAIFG in TA1IV
+
+static inline void halCapturePin(void)
+{
+    P1DIR &= ~BIT2;
+    P1SEL1 &= ~BIT2;
+    P1SEL0 |= BIT2; // TA1.1 CCI1A
+}
+
+#define HAL_SPARE_OUT P3OUT
+#define HAL_SPARE_DIR P3DIR
+#define HAL_SPARE_PINS 0xFF
+#define HAL_P1_PWM_PINS (0xFF & ~BIT1) // every P1 pin except LED2
+
+static inline void halLedInit(unsigned char p1Outputs)
+{
+    P1DIR = BIT0 + BIT1 + p1Outputs; // Set P1.0, P1.1 and any other P1 outputs
+}
+
+static inline void halSpareInit(void)
+{
+}
+
+#elif defined(__MSP430FR6989__)
+
+#define HAL_FRAM 1
+#define HAL_PORT_IV 1 // PxIV names the highest-priority pending pin
+
+// LED1 red P1.0, LED2 green P9.7, button S1 P1.1
+#define HAL_LED1_DIR P1DIR
+#define HAL_LED1_OUT P1OUT
+#define HAL_LED1_BIT BIT0
+#define HAL_LED2_DIR P9DIR
+#define HAL_LED2_OUT P9OUT
+#define HAL_LED2_BIT BIT7
+#define HAL_LED2_ON_P1 0
+
+#define HAL_BTN_IN P1IN
+#define HAL_BTN_OUT P1OUT
+#define HAL_BTN_REN P1REN
+#define HAL_BTN_IE P1IE
+#define HAL_BTN_IES P1IES
+#define HAL_BTN_IFG P1IFG
+#define HAL_BTN_BIT BIT1
+#define HAL_BTN_VECTOR PORT1_VECTOR
+#define HAL_BTN_PORT 1 // port and pin number, for PORT_DISPATCH
+#define HAL_BTN_PIN 1
+#define HAL_BTN_ON_P1 1
+
+// Hardware PWM output: TA0.1 on P1.0 (LED1)
+#define HAL_PWM_TIMER_IS_1 0
+#define HAL_PWM_DIR P1DIR
+#define HAL_PWM_SEL P1SEL0
+#define HAL_PWM_BIT BIT0
+#define HAL_PWM_LED 1 // LED the output drives, 0 for none
+
+// PWM channels (Common/pwm.c): channel n is output n + 1 of the channel timer.
+// TA0.2 is the S1 button pin, so only TA0.1 (P1.0, LED1) is a channel. TB0 is
+// free, but the LaunchPad wires its output pins to the segment LCD, so one
+// channel is the ceiling on this board.
+#define HAL_PWMCH_TIMER(reg) TA0##reg
+#define HAL_PWMCH_VECTOR TIMER0_A0_VECTOR
+#define HAL_PWMCH_IS_B 0
+#define HAL_PWMCH_COUNT 1
+
+static inline void halPwmChannelPins(void)
+{
+    P1DIR |= BIT0;
+    P1SEL1 &= ~BIT0;
+    P1SEL0 |= BIT0; // TA0.1
+}
+
+// Capture input (Common/capture.c): CCR1 of TA1, which times the button in
+// Hardware PWM, with CCI1A on P1.2. That is button S2 of the LaunchPad, which
+// must stay released while a signal is wired to it.
+#define HAL_CAP_TIMER(reg) TA1##reg
+#define HAL_CAP_VECTOR TIMER1_A1_VECTOR
+#define HAL_CAP_IS_B 0
+#define HAL_CAP_IV_OVERFLOW 14 // TAIFG in TA1IV
+
+static inline void halCapturePin(void)
+{
+    P1DIR &= ~BIT2;
+    P1SEL1 &= ~BIT2;
+    P1SEL0 |= BIT2; // TA1.1 CCI1A
+}
+
+#define HAL_SPARE_OUT P3OUT
+#define HAL_SPARE_DIR P3DIR
+#define HAL_SPARE_PINS 0xFF
+#define HAL_P1_PWM_PINS (0xFF & ~(BIT1 + BIT2)) // every P1 pin except the S1 and S2 buttons
+
+static inline void halLedInit(unsigned char p1Outputs)
+{
+    P1DIR = BIT0 + p1Outputs; // Set P1.0 and any other P1 outputs
+    P9DIR = BIT7; // Set P9.7 as output
+}
+
+static inline void halSpareInit(void)
+{
+}
+
+#else
+#error "hal.h: unsupported device"
+#endif
+
+// Timers: Timer_A everywhere except the MSP430FR2311
+#if defined(__MSP430FR2311__)
+#define HAL_TIMER0(reg) TB0##reg
+#define HAL_TIMER1(reg) TB1##reg
+#define HAL_TIMER0_VECTOR TIMER0_B0_VECTOR // CCR0
+#define HAL_TIMER0_IV_VECTOR TIMER0_B1_VECTOR // CCR1-CCRn and overflow, read TB0IV
+#define HAL_TIMER1_VECTOR TIMER1_B0_VECTOR
+#define HAL_TIMER1_IV_VECTOR TIMER1_B1_VECTOR
+#define HAL_TIMER_SMCLK TBSSEL_2
+#define HAL_TIMER_CLR TBCLR
+#define HAL_TIMER_IS_B 1 // compare latches: TBxCCRn writes load through CLLD
+#else
+#define HAL_TIMER0(reg) TA0##reg
+#define HAL_TIMER1(reg) TA1##reg
+#define HAL_TIMER0_VECTOR TIMER0_A0_VECTOR
+#define HAL_TIMER0_IV_VECTOR TIMER0_A1_VECTOR
+#define HAL_TIMER1_VECTOR TIMER1_A0_VECTOR
+#define HAL_TIMER1_IV_VECTOR TIMER1_A1_VECTOR
+#define HAL_TIMER_SMCLK TASSEL_2
+#define HAL_TIMER_CLR TACLR
+#define HAL_TIMER_IS_B 0
+#endif
+
+// DMA: the F5529, FR5994 and FR6989 have a DMA controller with the same timer
+// triggers (DMA trigger tables of their datasheets). Timer 2 is a third Timer_A
+// that no lab uses otherwise.
+#if defined(__MSP430F5529__) || defined(__MSP430FR5994__) || defined(__MSP430FR6989__)
+#define HAL_DMA 1
+#define HAL_TIMER2(reg) TA2##reg
+#define HAL_DMA0TSEL_TIMER0 DMA0TSEL_1 // channel 0 on TA0CCR0 CCIFG
+#define HAL_DMA1TSEL_TIMER2 DMA1TSEL_5 // channel 1 on TA2CCR0 CCIFG
+#else
+#define HAL_DMA 0
+#endif
+
+// LED1 is on P1 on every board
+#define HAL_LED1_ON_P1 1
+
+// Pull-ups that P1OUT must keep when a program writes the whole port
+#if HAL_BTN_ON_P1
+#define HAL_P1_PULLUPS HAL_BTN_BIT
+#else
+#define HAL_P1_PULLUPS 0
+#endif
+
+// FRAM parts power up with the pins locked in high-impedance mode
+static inline void halUnlockPins(void)
+{
+#if HAL_FRAM
+    PM5CTL0 &= ~LOCKLPM5; // Disables default high-impedance mode
+#endif
+}
+
+#endif
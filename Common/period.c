@@ -0,0 +1,65 @@
+// Timer period solver, run-time version (see period.h)
+
+#include <msp430.h>
+#include "period.h"
+
+// Smallest usable divider for clk at rate hz, 0 if even the largest is too small
+static uint16_t periodDivider(uint32_t clk, uint32_t hz)
+{
+    uint32_t cycles = clk / hz + (clk % hz != 0);
+    uint32_t d = (cycles + 0xFFFFUL) >> 16;
+
+    return (uint16_t)PERIOD_ROUND_DIV(d);
+}
+
+// Fills in cfg for an up mode timer interrupting at hz
+//
+// Returns 1 on success. Returns 0 and clears cfg when neither clock can reach
+// the rate. cfg->actualMilliHz reports the rate the timer really produces.
+int periodSolve(PeriodConfig *cfg, uint32_t smclk, uint32_t aclk, uint32_t hz)
+{
+    uint32_t clk = smclk;
+    uint32_t den, ticks, q, r;
+    uint16_t div, id;
+
+    cfg->ctl = 0;
+    cfg->ex = 0;
+    cfg->ccr0 = 0;
+    cfg->actualMilliHz = 0;
+    if (hz == 0)
+        return 0;
+
+    div = clk ? periodDivider(clk, hz) : 0;
+    cfg->ctl = PERIOD_SEL_SMCLK;
+    if (div == 0) {
+        clk = aclk;
+        div = periodDivider(clk, hz);
+        cfg->ctl = PERIOD_SEL_ACLK;
+    }
+    if (div == 0 || clk == 0) {
+        cfg->ctl = 0;
+        return 0;
+    }
+
+    den = (uint32_t)div * hz;
+    ticks = (clk + den / 2) / den;
+    if (ticks < 2) {
+        cfg->ctl = 0; // CCR0 of 0 never produces an interrupt rate
+        return 0;
+    }
+    cfg->ccr0 = (uint16_t)(ticks - 1);
+
+    id = PERIOD_ID_OF(div);
+    cfg->ctl += PERIOD_ID_BITS(id);
+#if PERIOD_HAS_IDEX
+    cfg->ex = div / id - 1;
+#endif
+
+    // clk / (div * ticks) in mHz without overflowing 32 bits:
+    // den is at most 64 * 65536, so r * 1000 stays below 2^32
+    den = (uint32_t)div * ticks;
+    q = clk / den;
+    r = clk % den;
+    cfg->actualMilliHz = q * 1000 + (r * 1000 + den / 2) / den;
+    return 1;
+}
@@ -0,0 +1,125 @@
+// Timer period solver
+//
+// Turns a target interrupt rate and the real source clocks into the clock
+// source, input divider (ID), expansion divider (TAIDEX/TBIDEX on the parts
+// that have TAxEX0/TBxEX0) and CCR0 value for a timer in up mode.
+//
+// The smallest total divider that still fits the period into 16 bits is used.
+// That keeps the most ticks per period, so the rounding error of CCR0 is at
+// most half a tick. If SMCLK cannot reach the rate even fully divided, ACLK is
+// used instead. An SMCLK rate of 0 means the timer may not use SMCLK at all
+// (CLOCK_TIMER_SMCLK_HZ with CLOCK_LPM3, see clock.h), so ACLK is always used.
+//
+// PERIOD_CONFIG() is an integer constant expression: with constant arguments
+// it resolves entirely at compile time and emits no division (the MSP430 has
+// no hardware divider). periodSolve() does the same work at run time with
+// 32-bit math, for rates that are only known while running.
+
+#ifndef PERIOD_H
+#define PERIOD_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint16_t ctl;           // clock source and ID bits for TAxCTL/TBxCTL (add MC_x)
+    uint16_t ex;            // TAxEX0/TBxEX0 value (0 on parts without one)
+    uint16_t ccr0;          // CCR0 value, one less than the ticks per period
+    uint32_t actualMilliHz; // rate actually produced, 0 if it cannot be reached
+} PeriodConfig;
+
+// Clock source bits, the same for Timer_A and Timer_B (the FR2311 only has Timer_B)
+#ifdef TASSEL_2
+#define PERIOD_SEL_ACLK TASSEL_1
+#define PERIOD_SEL_SMCLK TASSEL_2
+#else
+#define PERIOD_SEL_ACLK TBSSEL_1
+#define PERIOD_SEL_SMCLK TBSSEL_2
+#endif
+
+#if defined(TAIDEX_7) || defined(TBIDEX_7)
+#define PERIOD_HAS_IDEX 1
+#else
+#define PERIOD_HAS_IDEX 0
+#endif
+
+// ceil(clk / hz): exact number of clock cycles per period, rounded up
+#define PERIOD_CYCLES(clk, hz) (((uint32_t)(clk) + (uint32_t)(hz) - 1) / (uint32_t)(hz))
+
+// Smallest divider that brings the period down to 65536 ticks or fewer
+#define PERIOD_MIN_DIV(clk, hz) ((PERIOD_CYCLES(clk, hz) + 0xFFFFUL) >> 16)
+
+// Rounds a divider up to one the timer can produce, 0 if there is none.
+// With TAIDEX: 1-8 directly, then ID /2, /4, /8 times TAIDEX 1-8.
+#if PERIOD_HAS_IDEX
+#define PERIOD_ROUND_DIV(d) \
+    ((d) <= 8 ? ((d) ? (d) : 1) : \
+     (d) <= 16 ? (((d) + 1) & ~1UL) : \
+     (d) <= 32 ? (((d) + 3) & ~3UL) : \
+     (d) <= 64 ? (((d) + 7) & ~7UL) : 0)
+#else
+#define PERIOD_ROUND_DIV(d) \
+    ((d) <= 1 ? 1 : (d) <= 2 ? 2 : (d) <= 4 ? 4 : (d) <= 8 ? 8 : 0)
+#endif
+
+#define PERIOD_DIV(clk, hz) PERIOD_ROUND_DIV(PERIOD_MIN_DIV(clk, hz))
+
+// SMCLK when it can reach the rate, ACLK otherwise
+#define PERIOD_USE_ACLK(smclk, hz) ((smclk) == 0 || PERIOD_DIV(smclk, hz) == 0)
+#define PERIOD_CLK(smclk, aclk, hz) (PERIOD_USE_ACLK(smclk, hz) ? (uint32_t)(aclk) : (uint32_t)(smclk))
+#define PERIOD_DIVIDER(smclk, aclk, hz) PERIOD_DIV(PERIOD_CLK(smclk, aclk, hz), hz)
+
+// Ticks per period, rounded to the nearest tick
+#define PERIOD_TICKS_DIV(clk, hz, div) \
+    (((uint32_t)(clk) + (uint32_t)(div) * (hz) / 2) / ((uint32_t)(div) * (hz)))
+#define PERIOD_TICKS(smclk, aclk, hz) \
+    PERIOD_TICKS_DIV(PERIOD_CLK(smclk, aclk, hz), hz, PERIOD_DIVIDER(smclk, aclk, hz))
+
+// Split of the total divider into ID (1, 2, 4, 8) and TAIDEX (1-8)
+#if PERIOD_HAS_IDEX
+#define PERIOD_ID_OF(d) ((d) <= 8 ? 1 : (d) <= 16 ? 2 : (d) <= 32 ? 4 : 8)
+#else
+#define PERIOD_ID_OF(d) ((d) ? (d) : 1)
+#endif
+#define PERIOD_ID_BITS(id) ((id) == 1 ? ID_0 : (id) == 2 ? ID_1 : (id) == 4 ? ID_2 : ID_3)
+
+#define PERIOD_CTL(smclk, aclk, hz) \
+    ((PERIOD_USE_ACLK(smclk, hz) ? PERIOD_SEL_ACLK : PERIOD_SEL_SMCLK) + \
+     PERIOD_ID_BITS(PERIOD_ID_OF(PERIOD_DIVIDER(smclk, aclk, hz))))
+
+#if PERIOD_HAS_IDEX
+#define PERIOD_EX(smclk, aclk, hz) \
+    (PERIOD_DIVIDER(smclk, aclk, hz) ? \
+     PERIOD_DIVIDER(smclk, aclk, hz) / PERIOD_ID_OF(PERIOD_DIVIDER(smclk, aclk, hz)) - 1 : 0)
+#else
+#define PERIOD_EX(smclk, aclk, hz) 0
+#endif
+
+// Reachable: some divider fits, and the period is at least two ticks
+#define PERIOD_OK(smclk, aclk, hz) \
+    (PERIOD_DIVIDER(smclk, aclk, hz) != 0 && PERIOD_TICKS(smclk, aclk, hz) >= 2)
+
+#define PERIOD_CCR0(smclk, aclk, hz) \
+    (PERIOD_OK(smclk, aclk, hz) ? PERIOD_TICKS(smclk, aclk, hz) - 1 : 0)
+
+#define PERIOD_ACTUAL_MILLIHZ(smclk, aclk, hz) \
+    (PERIOD_OK(smclk, aclk, hz) ? \
+     (uint32_t)(((unsigned long long)PERIOD_CLK(smclk, aclk, hz) * 1000 + \
+                 (unsigned long long)PERIOD_DIVIDER(smclk, aclk, hz) * PERIOD_TICKS(smclk, aclk, hz) / 2) / \
+                ((unsigned long long)PERIOD_DIVIDER(smclk, aclk, hz) * PERIOD_TICKS(smclk, aclk, hz))) : 0)
+
+// Initializer for a PeriodConfig, resolved at compile time for constant arguments
+#define PERIOD_CONFIG(smclk, aclk, hz) { \
+    PERIOD_CTL(smclk, aclk, hz), \
+    PERIOD_EX(smclk, aclk, hz), \
+    PERIOD_CCR0(smclk, aclk, hz), \
+    PERIOD_ACTUAL_MILLIHZ(smclk, aclk, hz) }
+
+// Fails the build when a constant rate cannot be produced by the timer
+#define PERIOD_ASSERT_NAME(line) periodAssert##line
+#define PERIOD_ASSERT_LINE(line) PERIOD_ASSERT_NAME(line)
+#define PERIOD_ASSERT(smclk, aclk, hz) \
+    typedef char PERIOD_ASSERT_LINE(__LINE__)[PERIOD_OK(smclk, aclk, hz) ? 1 : -1]
+
+int periodSolve(PeriodConfig *cfg, uint32_t smclk, uint32_t aclk, uint32_t hz);
+
+#endif
@@ -0,0 +1,60 @@
+// Port interrupt dispatch
+//
+// One vector serves all eight pins of a port. PORT_DISPATCH(port, handlers),
+// called from that vector's ISR, finds the pending pin of the highest priority
+// (pin 0 first, the order of PxIV), clears its flag and calls handlers[pin]
+// from a table of eight PortHandler. Entries for pins whose interrupt is not
+// enabled may be 0, they are never called. port is the port number, so
+// PORT_DISPATCH(HAL_BTN_PORT, pins) reads P1IV on most boards and P5IV on the
+// MSP430FR5994.
+//
+// The F5529 and the FR parts read PxIV (HAL_PORT_IV), which returns
+// 2 * (pin + 1) and clears that pin's flag in the same read: one read, and one
+// indexed call. The G2553's 2xx ports have no PxIV, so PxIFG & PxIE goes
+// through a 16-entry table of the lowest set bit, for the low nibble or else
+// the high one, and a single BIC clears the lowest set bit. Either way the
+// time does not depend on which pin, or how many, are pending.
+//
+// One pin is served per interrupt. Flags still set keep the vector requested,
+// so the ISR runs again right after RETI for the next pin: no edge is lost,
+// and no single pass runs longer than the dispatch and one handler. The flag
+// is cleared before the handler runs, so an edge during the handler sets it
+// again, and a handler that sets its own flag (as a debounce timer does to
+// replay an edge) is called once more.
+
+#ifndef PORTIRQ_H
+#define PORTIRQ_H
+
+#include <stdint.h>
+#include "hal.h"
+
+typedef void (*PortHandler)(void);
+
+#if HAL_PORT_IV
+#define PORT_DISPATCH_PASTE(port, handlers) do { \
+    uint8_t pin_ = __even_in_range(P##port##IV, 16) >> 1; \
+    if (pin_) \
+        (handlers)[pin_ - 1](); \
+} while (0)
+#else
+// Pin 0-7 of the lowest bit set in pending, which must not be 0
+static inline uint8_t portFirstPin(uint8_t pending)
+{
+    static const uint8_t lowest[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+
+    return (pending & 0x0F) ? lowest[pending & 0x0F] : lowest[pending >> 4] + 4;
+}
+
+#define PORT_DISPATCH_PASTE(port, handlers) do { \
+    uint8_t pending_ = P##port##IFG & P##port##IE; \
+    if (pending_) { \
+        P##port##IFG &= ~(pending_ & -pending_); /* the lowest flag only */ \
+        (handlers)[portFirstPin(pending_)](); \
+    } \
+} while (0)
+#endif
+
+// Expands port first, so it can be HAL_BTN_PORT
+#define PORT_DISPATCH(port, handlers) PORT_DISPATCH_PASTE(port, handlers)
+
+#endif
@@ -0,0 +1,173 @@
+// Multi-channel hardware PWM (see pwm.h)
+
+#include "pwm.h"
+
+#if HAL_PWMCH_IS_B
+#define PWM_CLR TBCLR
+#else
+#define PWM_CLR TACLR
+#endif
+
+// Timer_A: ticks a channel coming on needs ahead of its compare to be set by
+// hand, or the compare could come while it is still in OUTMOD_0 and be missed
+#define PWM_SET_MARGIN 16
+
+static uint16_t pwmDuty[PWM_CHANNELS]; // duty cycles of the coming periods, in timer ticks
+#if !HAL_PWMCH_IS_B
+static uint16_t pwmLoaded[PWM_CHANNELS]; // duty cycles in the CCRs
+#endif
+static uint16_t pwmPeriodCcr0;
+
+// The CCRs are written by name, not indexed from CCR1, so every access stays
+// a plain register access on every header (and in the simulator).
+static void pwmCcr(uint8_t channel, uint16_t value)
+{
+    switch (channel) {
+    case 0: HAL_PWMCH_TIMER(CCR1) = value; break;
+#if PWM_CHANNELS > 1
+    case 1: HAL_PWMCH_TIMER(CCR2) = value; break;
+#endif
+#if PWM_CHANNELS > 2
+    case 2: HAL_PWMCH_TIMER(CCR3) = value; break;
+#endif
+#if PWM_CHANNELS > 3
+    case 3: HAL_PWMCH_TIMER(CCR4) = value; break;
+#endif
+#if PWM_CHANNELS > 4
+    case 4: HAL_PWMCH_TIMER(CCR5) = value; break;
+#endif
+#if PWM_CHANNELS > 5
+    case 5: HAL_PWMCH_TIMER(CCR6) = value; break;
+#endif
+    }
+}
+
+static void pwmCctl(uint8_t channel, uint16_t value)
+{
+    switch (channel) {
+    case 0: HAL_PWMCH_TIMER(CCTL1) = value; break;
+#if PWM_CHANNELS > 1
+    case 1: HAL_PWMCH_TIMER(CCTL2) = value; break;
+#endif
+#if PWM_CHANNELS > 2
+    case 2: HAL_PWMCH_TIMER(CCTL3) = value; break;
+#endif
+#if PWM_CHANNELS > 3
+    case 3: HAL_PWMCH_TIMER(CCTL4) = value; break;
+#endif
+#if PWM_CHANNELS > 4
+    case 4: HAL_PWMCH_TIMER(CCTL5) = value; break;
+#endif
+#if PWM_CHANNELS > 5
+    case 5: HAL_PWMCH_TIMER(CCTL6) = value; break;
+#endif
+    }
+}
+
+// Starts the channel timer in up mode at p's rate with every channel off.
+// The duty cycles are in ticks of that period, p->ccr0 + 1 for always on.
+void pwmInit(const PeriodConfig *p)
+{
+    uint8_t ch;
+
+    pwmPeriodCcr0 = p->ccr0;
+    HAL_PWMCH_TIMER(CTL) = PWM_CLR; // stopped, latches ungrouped while they load
+    for (ch = 0; ch < PWM_CHANNELS; ch++) {
+        pwmDuty[ch] = 0;
+#if HAL_PWMCH_IS_B
+        pwmCctl(ch, OUTMOD_7); // CLLD_0: the latch loads at once
+#else
+        pwmLoaded[ch] = 0;
+        pwmCctl(ch, OUTMOD_0); // off, see pwmCommit()
+#endif
+        pwmCcr(ch, 0);
+    }
+    HAL_PWMCH_TIMER(CCR0) = p->ccr0;
+#if PERIOD_HAS_IDEX
+    HAL_PWMCH_TIMER(EX0) = p->ex; // expansion divider, latched by the clear below
+#endif
+#if HAL_PWMCH_IS_B
+    for (ch = 0; ch < PWM_CHANNELS; ch++)
+        pwmCctl(ch, OUTMOD_7 + CLLD_1); // later writes load at the wrap (the group's first CCR rules)
+    HAL_PWMCH_TIMER(CCTL0) = CLLD_1;
+    HAL_PWMCH_TIMER(CTL) = p->ctl + MC_1 + HAL_PWMCH_CLGRP + PWM_CLR;
+#else
+    HAL_PWMCH_TIMER(CCTL0) = 0;
+    HAL_PWMCH_TIMER(CTL) = p->ctl + MC_1 + PWM_CLR;
+#endif
+
+    halPwmChannelPins();
+}
+
+// Hands the staged values to the timer
+static void pwmStage(void)
+{
+#if HAL_PWMCH_IS_B
+    uint8_t ch;
+
+    // A group loads only when all of its CCRs have been written, so one that
+    // the wrap catches halfway loads whole in the next period instead
+    for (ch = 0; ch < PWM_CHANNELS; ch++)
+        pwmCcr(ch, pwmDuty[ch]);
+    HAL_PWMCH_TIMER(CCR0) = pwmPeriodCcr0; // unchanged, completes TBCLGRP_3's group
+#else
+    HAL_PWMCH_TIMER(CCTL0) = CCIE; // pwmCommit() at the end of this period, also drops the stale flag
+#endif
+}
+
+// Stages one channel's duty cycle for the next period
+void pwmSet(uint8_t channel, uint16_t duty)
+{
+    if (channel >= PWM_CHANNELS)
+        return;
+    pwmDuty[channel] = duty;
+    pwmStage();
+}
+
+// Stages count duty cycles from channel first on, all for the same period
+void pwmSetMany(uint8_t first, uint8_t count, const uint16_t *duty)
+{
+    while (count-- && first < PWM_CHANNELS)
+        pwmDuty[first++] = *duty++;
+    pwmStage();
+}
+
+// Timer_A: loads the staged duty cycles. Call it from the channel timer's CCR0
+// ISR; it turns the interrupt off again. Does nothing on Timer_B.
+void pwmCommit(void)
+{
+#if !HAL_PWMCH_IS_B
+    uint16_t count, duty, old;
+    uint8_t ch, wrapped;
+
+    for (ch = 0; ch < PWM_CHANNELS; ch++)
+        pwmCcr(ch, pwmDuty[ch]);
+    HAL_PWMCH_TIMER(CCTL0) = 0; // committed, no more interrupts until the next update
+
+    // The count restarts from 0 while this runs, and the compares below it have
+    // been passed already. Each output is put where its new duty cycle has it by
+    // now, so the channels change in this same period. A pulse that should have
+    // ended is reset (it ends late by the commit time). A channel coming on from
+    // 0 is set by hand (it starts late by it); 0 is OUTMOD_0 with OUT = 0, so an
+    // off channel has no one-tick pulse at the wrap that this would cut in two.
+    // A channel coming up from a duty cycle shorter than the commit time keeps
+    // its short pulse for this period and changes in the next.
+    count = HAL_PWMCH_TIMER(R);
+    wrapped = count != pwmPeriodCcr0;
+    for (ch = 0; ch < PWM_CHANNELS; ch++) {
+        duty = pwmDuty[ch];
+        old = pwmLoaded[ch];
+        pwmLoaded[ch] = duty;
+        if (!duty) {
+            pwmCctl(ch, OUTMOD_0); // OUT = 0 holds the output low
+        } else if (!old) {
+            if (wrapped && count + PWM_SET_MARGIN < duty)
+                pwmCctl(ch, OUTMOD_0 + OUT); // OUT = 1 drives the output high
+            pwmCctl(ch, OUTMOD_7); // CCR1-6 resets it, CCR0 sets it
+        } else if (wrapped && count >= duty) {
+            pwmCctl(ch, OUTMOD_0); // OUT = 0 drives the output low
+            pwmCctl(ch, OUTMOD_7); // holds it until CCR0 sets it
+        }
+    }
+#endif
+}
@@ -0,0 +1,37 @@
+// Multi-channel hardware PWM on the channel timer of Common/hal.h
+//
+// Channel n is output n + 1 of HAL_PWMCH_TIMER, in OUTMOD_7 against CCR0:
+// set when the period starts, reset after duty timer ticks. pwmInit() routes
+// the pins (halPwmChannelPins()) and starts the timer with every channel off.
+//
+// pwmSet() and pwmSetMany() stage duty cycles for the next period. A period
+// never ends early or runs on with an output set, and the values of one
+// pwmSetMany() call all take effect in the same period, so the components of
+// a colour change together:
+//
+// - Timer_B (FR2311 TB1, FR5994 TB0) compares with the TBxCLn latches. The
+//   channels are grouped with HAL_PWMCH_CLGRP and load with CLLD_1 when the
+//   count wraps to 0, and a group only loads once all of its TBxCCRn have been
+//   written. Every update writes all of them, CCR0 last.
+// - Timer_A has no latches. The values wait in RAM and pwmCommit() loads
+//   them; call it from the channel timer's CCR0 ISR (HAL_PWMCH_VECTOR). The
+//   CCR0 interrupt is only enabled while values are waiting.
+//
+// Call pwmSet() and pwmSetMany() from ISRs, or with interrupts disabled, so
+// pwmCommit() cannot run halfway through.
+
+#ifndef PWM_H
+#define PWM_H
+
+#include <stdint.h>
+#include "hal.h"
+#include "period.h"
+
+#define PWM_CHANNELS HAL_PWMCH_COUNT
+
+void pwmInit(const PeriodConfig *p);
+void pwmSet(uint8_t channel, uint16_t duty);
+void pwmSetMany(uint8_t first, uint8_t count, const uint16_t *duty);
+void pwmCommit(void);
+
+#endif
@@ -0,0 +1,146 @@
+// Hashed timer wheel (see timer_wheel.h)
+
+#include "timer_wheel.h"
+
+static WheelTimer *wheelSlot[WHEEL_SLOTS]; // one list per slot
+static WheelTimer *wheelDue;               // timers taken out of a slot to fire
+static uint32_t wheelBusy;                 // bit n set while slot n is not empty
+static uint16_t wheelLast;                 // last tick wheelExpire() has handled
+
+// Links t in at the head of a list
+static void wheelLink(WheelTimer **head, WheelTimer *t)
+{
+    t->next = *head;
+    if (t->next)
+        t->next->pprev = &t->next;
+    t->pprev = head;
+    *head = t;
+}
+
+// Unlinks t from whatever list it is in, and marks its slot empty when it was the last
+static void wheelUnlink(WheelTimer *t)
+{
+    uint8_t slot = t->expires & WHEEL_MASK;
+
+    *t->pprev = t->next;
+    if (t->next)
+        t->next->pprev = t->pprev;
+    if (t->pprev == &wheelSlot[slot] && !t->next)
+        wheelBusy &= ~(1UL << slot);
+    t->next = 0;
+    t->pprev = 0;
+}
+
+// Puts t into the slot of its expiry tick
+static void wheelInsert(WheelTimer *t)
+{
+    uint8_t slot = t->expires & WHEEL_MASK;
+
+    wheelLink(&wheelSlot[slot], t);
+    wheelBusy |= 1UL << slot;
+}
+
+// Ticks from `from` to the next busy slot, 1 to WHEEL_SLOTS, or 0 if all are empty
+static uint8_t wheelGap(uint16_t from)
+{
+    uint8_t slot = (from + 1) & WHEEL_MASK;
+    uint32_t bit = 1UL << slot;
+    uint8_t d;
+
+    if (!wheelBusy)
+        return 0;
+    for (d = 1; d <= WHEEL_SLOTS; d++) {
+        if (wheelBusy & bit)
+            return d;
+        if (++slot == WHEEL_SLOTS) {
+            slot = 0;
+            bit = 1;
+        }
+        else
+            bit <<= 1;
+    }
+    return 0;
+}
+
+void wheelInit(uint16_t now)
+{
+    uint8_t i;
+
+    for (i = 0; i < WHEEL_SLOTS; i++)
+        wheelSlot[i] = 0;
+    wheelDue = 0;
+    wheelBusy = 0;
+    wheelLast = now;
+}
+
+// Fires t `delay` ticks (at least 1) after `now`, then every `period` ticks if
+// that is not 0. Arming an armed timer moves it.
+void wheelArm(WheelTimer *t, uint16_t now, uint16_t delay, uint16_t period, WheelCallback fn)
+{
+    if (t->pprev)
+        wheelUnlink(t);
+    t->expires = now + (delay ? delay : 1);
+    t->period = period;
+    t->fn = fn;
+    wheelInsert(t);
+}
+
+void wheelCancel(WheelTimer *t)
+{
+    if (t->pprev)
+        wheelUnlink(t);
+}
+
+// Fires every timer that is due up to tick `now`
+//
+// Only busy slots are visited. The timers of a slot that are due move to a
+// list of their own first, so a callback can cancel or re-arm any timer,
+// including one that was due at the same tick.
+void wheelExpire(uint16_t now)
+{
+    WheelTimer *t, *next;
+    uint8_t d;
+
+    while ((int16_t)(now - wheelLast) > 0) {
+        d = wheelGap(wheelLast);
+        if (d == 0 || d > (uint16_t)(now - wheelLast)) {
+            wheelLast = now;
+            break;
+        }
+        wheelLast += d;
+
+        for (t = wheelSlot[wheelLast & WHEEL_MASK]; t; t = next) {
+            next = t->next;
+            if (t->expires == wheelLast) {
+                wheelUnlink(t);
+                wheelLink(&wheelDue, t);
+            }
+        }
+        while ((t = wheelDue) != 0) {
+            wheelUnlink(t);
+            if (t->period) {
+                t->expires += t->period;
+                wheelInsert(t);
+            }
+            t->fn(t);
+        }
+    }
+}
+
+// Finds the tick to program the compare for: the next busy slot after the
+// ticks already handled, but no earlier than now + 1 and no later than
+// now + limit. Returns 0 when no timer is armed.
+uint8_t wheelNext(uint16_t now, uint16_t limit, uint16_t *when)
+{
+    uint8_t d = wheelGap(wheelLast);
+    uint16_t t = wheelLast + d;
+
+    if (d == 0)
+        return 0;
+    if ((int16_t)(t - now) <= 0)
+        t = now + 1;
+    else if ((uint16_t)(t - now) > limit)
+        t = now + limit;
+    *when = t;
+    return 1;
+}
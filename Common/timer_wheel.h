@@ -0,0 +1,52 @@
+// Hashed timer wheel: many one-shot and periodic timeouts on one timer compare
+//
+// Each WheelTimer is owned by the caller and linked into one of WHEEL_SLOTS
+// lists, picked by its expiry tick modulo WHEEL_SLOTS. Arming and cancelling
+// link or unlink one node, whatever the number of timers. A timer more than
+// one revolution ahead shares a slot with nearer ones and is skipped until its
+// tick comes round.
+//
+// The wheel does not count ticks itself. The program keeps the tick count from
+// a free-running hardware timer, and wheelNext() tells it which tick to program
+// the compare register for: the next one whose slot holds a timer. Empty ticks
+// never wake the CPU. With no timers armed the compare can be turned off.
+//
+// Callbacks run from wheelExpire(), normally in the timer ISR. They may arm and
+// cancel timers, their own included. The lists are not locked: call everything
+// from ISRs (which do not nest), or with interrupts disabled.
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>
+
+// Slots per revolution, a power of two up to 32
+#ifndef WHEEL_SLOTS
+#define WHEEL_SLOTS 32
+#endif
+#if WHEEL_SLOTS < 2 || WHEEL_SLOTS > 32 || (WHEEL_SLOTS & (WHEEL_SLOTS - 1))
+#error "WHEEL_SLOTS must be a power of two from 2 to 32"
+#endif
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+
+typedef struct WheelTimer WheelTimer;
+typedef void (*WheelCallback)(WheelTimer *t);
+
+struct WheelTimer {
+    WheelTimer *next;     // next timer in the same list
+    WheelTimer **pprev;   // the pointer that points here, 0 when not armed
+    uint16_t expires;     // tick it fires at
+    uint16_t period;      // ticks between firings, 0 for one-shot
+    WheelCallback fn;
+};
+
+void wheelInit(uint16_t now);
+void wheelArm(WheelTimer *t, uint16_t now, uint16_t delay, uint16_t period, WheelCallback fn);
+void wheelCancel(WheelTimer *t);
+void wheelExpire(uint16_t now);
+uint8_t wheelNext(uint16_t now, uint16_t limit, uint16_t *when);
+
+// Nonzero while t is armed
+#define wheelArmed(t) ((t)->pprev != 0)
+
+#endif
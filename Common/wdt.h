@@ -0,0 +1,111 @@
+// Watchdog interval timer
+//
+// With WDTTMSEL the watchdog does not reset the device; it raises WDT_VECTOR at
+// the end of every interval instead, like a timer with one fixed compare. The
+// interval is 64, 512, 8192 or 32768 clocks of SMCLK or ACLK: the WDT+ of the
+// G2553 has only these four, and the longer ones of the WDT_A are not used.
+// A delay is then counted in whole intervals by the ISR.
+//
+// WDT_CONFIG(smclk, aclk, hz) picks the longest interval that still fits four
+// times into 1/hz, so the delay is off by at most an eighth, and the number of
+// intervals nearest to it. Like Common/period.h it takes SMCLK unless its rate
+// is 0 (CLOCK_TIMER_SMCLK_HZ with CLOCK_LPM3), and resolves at compile time.
+// When even 64 clocks do not fit four times, as with the G2553's 12 kHz VLO at
+// 100 Hz, the shortest interval is used and the error can be larger.
+//
+// wdtStart() clears the count, so the first interval is a whole one, and
+// wdtStop() holds the watchdog again. Both write WDTCTL with the password. The
+// interval flag clears itself when WDT_VECTOR is accepted.
+
+#ifndef WDT_H
+#define WDT_H
+
+#include <stdint.h>
+#include <msp430.h>
+
+typedef struct {
+    uint16_t ctl;           // WDTCTL value that starts the interval timer
+    uint16_t intervals;     // intervals per delay
+    uint32_t actualMilliHz; // 1 / delay actually produced, in mHz
+} WdtConfig;
+
+// Clock source and interval bits, WDT+ (G2553) and WDT_A (the others)
+#ifdef WDTSSEL_1
+#define WDT_SEL_ACLK WDTSSEL_1
+#define WDT_SEL_SMCLK WDTSSEL_0
+#define WDT_IS_32768 WDTIS_4
+#define WDT_IS_8192 WDTIS_5
+#define WDT_IS_512 WDTIS_6
+#define WDT_IS_64 WDTIS_7
+#define WDT_IE_REG SFRIE1
+#else
+#define WDT_SEL_ACLK WDTSSEL
+#define WDT_SEL_SMCLK 0
+#define WDT_IS_32768 0
+#define WDT_IS_8192 WDTIS0
+#define WDT_IS_512 WDTIS1
+#define WDT_IS_64 (WDTIS1 + WDTIS0)
+#define WDT_IE_REG IE1
+#endif
+
+#define WDT_MIN_INTERVALS 4 // intervals a delay is cut into at least, when the clock allows
+
+#define WDT_CLK(smclk, aclk) ((smclk) ? (uint32_t)(smclk) : (uint32_t)(aclk))
+
+// Longest interval, in source clocks, that fits WDT_MIN_INTERVALS times into 1/hz
+#define WDT_FITS(clk, hz, n) ((uint32_t)(clk) >= (n) * WDT_MIN_INTERVALS * (uint32_t)(hz))
+#define WDT_DIV(clk, hz) \
+    (WDT_FITS(clk, hz, 32768UL) ? 32768UL : WDT_FITS(clk, hz, 8192UL) ? 8192UL : \
+     WDT_FITS(clk, hz, 512UL) ? 512UL : 64UL)
+
+// Intervals per delay, rounded to the nearest
+#define WDT_INTERVALS_DIV(clk, hz, div) \
+    (((uint32_t)(clk) + (div) * (uint32_t)(hz) / 2) / ((div) * (uint32_t)(hz)))
+#define WDT_INTERVALS(smclk, aclk, hz) \
+    WDT_INTERVALS_DIV(WDT_CLK(smclk, aclk), hz, WDT_DIV(WDT_CLK(smclk, aclk), hz))
+
+#define WDT_IS_BITS(div) \
+    ((div) == 32768UL ? WDT_IS_32768 : (div) == 8192UL ? WDT_IS_8192 : (div) == 512UL ? WDT_IS_512 : WDT_IS_64)
+
+#define WDT_CTL(smclk, aclk, hz) \
+    (WDTPW + WDTTMSEL + WDTCNTCL + ((smclk) ? WDT_SEL_SMCLK : WDT_SEL_ACLK) + \
+     WDT_IS_BITS(WDT_DIV(WDT_CLK(smclk, aclk), hz)))
+
+// Reachable: at least one interval, and the count fits 16 bits
+#define WDT_OK(smclk, aclk, hz) \
+    (WDT_INTERVALS(smclk, aclk, hz) >= 1 && WDT_INTERVALS(smclk, aclk, hz) <= 0xFFFF)
+
+#define WDT_ACTUAL_MILLIHZ(smclk, aclk, hz) \
+    (WDT_OK(smclk, aclk, hz) ? \
+     (uint32_t)((unsigned long long)WDT_CLK(smclk, aclk) * 1000 / \
+                ((unsigned long long)WDT_DIV(WDT_CLK(smclk, aclk), hz) * WDT_INTERVALS(smclk, aclk, hz))) : 0)
+
+// Initializer for a WdtConfig, resolved at compile time for constant arguments
+#define WDT_CONFIG(smclk, aclk, hz) { \
+    WDT_CTL(smclk, aclk, hz), \
+    WDT_OK(smclk, aclk, hz) ? WDT_INTERVALS(smclk, aclk, hz) : 1, \
+    WDT_ACTUAL_MILLIHZ(smclk, aclk, hz) }
+
+// Fails the build when a constant delay cannot be counted in intervals
+#define WDT_ASSERT_NAME(line) wdtAssert##line
+#define WDT_ASSERT_LINE(line) WDT_ASSERT_NAME(line)
+#define WDT_ASSERT(smclk, aclk, hz) \
+    typedef char WDT_ASSERT_LINE(__LINE__)[WDT_OK(smclk, aclk, hz) ? 1 : -1]
+
+// Lets the interval flag through to WDT_VECTOR
+static inline void wdtEnable(void)
+{
+    WDT_IE_REG |= WDTIE;
+}
+
+static inline void wdtStart(const WdtConfig *w)
+{
+    WDTCTL = w->ctl; // interval mode, count cleared
+}
+
+static inline void wdtStop(void)
+{
+    WDTCTL = WDTPW + WDTHOLD;
+}
+
+#endif
@@ -0,0 +1,401 @@
+// Debouncing, one source for every board
+// The board is picked by the device define through Common/hal.h
+#include "../Common/hal.h"
+#include "../Common/clock.h"
+#include "../Common/period.h"
+#include "../Common/portirq.h"
+
+// Debounce engine
+// DEBOUNCE_MODE_TIMEOUT:    the port interrupt starts a one-shot timer, the timer ISR moves on to the other edge
+// DEBOUNCE_MODE_INTEGRATOR: a periodic tick samples every button through debounce_integrator.c
+// DEBOUNCE_MODE_VERTICAL:   a periodic tick debounces the whole button port at once through debounce_vertical.c
+// DEBOUNCE_MODE_EAGER:      the port interrupt acts on the first edge, the timer then locks out the bounce
+// DEBOUNCE_MODE_ADAPTIVE:   bounce edges are timestamped and the window follows the switch's settle time
+#define DEBOUNCE_MODE_TIMEOUT    0
+#define DEBOUNCE_MODE_INTEGRATOR 1
+#define DEBOUNCE_MODE_VERTICAL   2
+#define DEBOUNCE_MODE_EAGER      3
+#define DEBOUNCE_MODE_ADAPTIVE   4
+
+#ifndef DEBOUNCE_MODE
+#define DEBOUNCE_MODE DEBOUNCE_MODE_TIMEOUT
+#endif
+
+// Integrator and vertical modes sample on a fixed tick, the others run from the pin interrupt
+#define DEBOUNCE_PERIODIC (DEBOUNCE_MODE == DEBOUNCE_MODE_INTEGRATOR || DEBOUNCE_MODE == DEBOUNCE_MODE_VERTICAL)
+
+// Debounce timer
+// DEBOUNCE_TIMER_TIMER0: timer 0 of Common/hal.h
+// DEBOUNCE_TIMER_WDT:    the watchdog in interval mode through Common/wdt.h, both timers stay free
+#define DEBOUNCE_TIMER_TIMER0 0
+#define DEBOUNCE_TIMER_WDT    1
+
+#ifndef DEBOUNCE_TIMER
+#define DEBOUNCE_TIMER DEBOUNCE_TIMER_TIMER0
+#endif
+
+void frequencyCalc(const PeriodConfig *p);
+
+#ifndef DEBOUNCE_HZ
+#define DEBOUNCE_HZ 100 // 100 Hz --> 10 ms intervals
+#endif
+
+#if DEBOUNCE_MODE == DEBOUNCE_MODE_INTEGRATOR
+#include "debounce_integrator.h"
+
+#define DEBOUNCE_PINS HAL_BTN_BIT // buttons on the button port, pulled up, pressed reads 0
+#define TICK_HZ 1000 // integrator sample rate
+#define INTEGRATOR_TICKS (TICK_HZ / DEBOUNCE_HZ) // net samples a level needs, one debounce interval
+#if INTEGRATOR_TICKS < 1 || INTEGRATOR_TICKS > 255
+#error "DEBOUNCE_HZ must give 1 to 255 integrator ticks"
+#endif
+#elif DEBOUNCE_MODE == DEBOUNCE_MODE_VERTICAL
+#include "debounce_vertical.h"
+
+#define DEBOUNCE_PINS HAL_BTN_BIT // buttons on the button port, pulled up, pressed reads 0
+#define TICK_HZ (DEBOUNCE_HZ * VERTICAL_SAMPLES) // VERTICAL_SAMPLES ticks make one debounce interval
+
+#ifdef DEBOUNCE_BENCHMARK
+#include "debounce_integrator.h"
+
+unsigned int debounceCycles[2]; // MCLK cycles for 16 ticks of 8 pins: vertical counter, per-pin integrator
+
+void debounceBenchmark(void);
+#endif
+#endif
+
+#if DEBOUNCE_PERIODIC
+// Sample tick settings, solved at compile time
+static const PeriodConfig debouncePeriod = PERIOD_CONFIG(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, TICK_HZ);
+PERIOD_ASSERT(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, TICK_HZ);
+#elif DEBOUNCE_MODE == DEBOUNCE_MODE_ADAPTIVE
+#include "debounce_adaptive.h"
+
+#define DEBOUNCE_PINS HAL_BTN_BIT
+
+#ifndef ADAPTIVE_QUIET_US
+#define ADAPTIVE_QUIET_US 1000 // least quiet time after the last bounce edge, and the shortest window
+#endif
+#define ADAPTIVE_MAX_US 25000 // longest window, short of one wrap of the timestamp timer
+#define ADAPTIVE_SPAN_HZ 32 // the timestamp timer wraps about every 31 ms
+#define ADAPTIVE_SPAN_US (1000000UL / ADAPTIVE_SPAN_HZ)
+
+// Free-running timestamp timer, the divider that fits one span into 16 bits
+static const PeriodConfig debouncePeriod = PERIOD_CONFIG(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, ADAPTIVE_SPAN_HZ);
+PERIOD_ASSERT(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, ADAPTIVE_SPAN_HZ);
+
+// Microseconds to timestamp ticks, at compile time
+#define ADAPTIVE_TICKS_US(us) \
+    ((uint16_t)(PERIOD_TICKS(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, ADAPTIVE_SPAN_HZ) * (uint32_t)(us) / ADAPTIVE_SPAN_US))
+
+#if 1000000UL / DEBOUNCE_HZ > ADAPTIVE_MAX_US || ADAPTIVE_QUIET_US > ADAPTIVE_MAX_US
+#error "the starting window (DEBOUNCE_HZ) and ADAPTIVE_QUIET_US must fit in ADAPTIVE_MAX_US"
+#endif
+
+AdaptiveSwitch button; // learned settle time and window, in timestamp ticks
+int state = 0; // debounced, 1 while pressed
+#else
+#define DEBOUNCE_PINS HAL_BTN_BIT
+
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+#include "../Common/wdt.h"
+
+#ifndef WDT_ACLK
+#define WDT_ACLK 0 // 1: the intervals come from ACLK, as they do anyway with CLOCK_LPM3
+#endif
+#define WDT_SMCLK_HZ (WDT_ACLK ? 0 : CLOCK_TIMER_SMCLK_HZ)
+
+// Watchdog interval and the intervals in one debounce delay, solved at compile time
+static const WdtConfig debounceWdt = WDT_CONFIG(WDT_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+WDT_ASSERT(WDT_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+
+uint16_t wdtLeft; // intervals to the end of the delay
+#define DEBOUNCE_VECTOR WDT_VECTOR
+#else
+// Debounce timer settings, solved at compile time
+static const PeriodConfig debouncePeriod = PERIOD_CONFIG(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+PERIOD_ASSERT(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+#endif
+
+int state = 0; // eager mode: 1 while the button is pressed
+#endif
+
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+#if DEBOUNCE_MODE != DEBOUNCE_MODE_TIMEOUT && DEBOUNCE_MODE != DEBOUNCE_MODE_EAGER
+#error "the watchdog times one-shot delays only: the timeout and eager modes"
+#endif
+#else
+#define DEBOUNCE_VECTOR HAL_TIMER0_VECTOR
+#endif
+
+int main(void)
+{
+    WDTCTL = WDTPW | WDTHOLD;   // Stop watchdog timer
+	halUnlockPins(); // FRAM parts: release the pins from high-impedance mode
+
+	// Button configuration
+    HAL_LED1_DIR = HAL_LED1_BIT; // Set LED1 as output
+    HAL_BTN_REN |= DEBOUNCE_PINS; // Connects the on-board resistor to the buttons
+    HAL_BTN_OUT = DEBOUNCE_PINS; // Sets up the buttons as pull-up resistors
+    
+#if DEBOUNCE_MODE == DEBOUNCE_MODE_INTEGRATOR
+    integratorInit(DEBOUNCE_PINS, INTEGRATOR_TICKS); // all buttons start released
+#elif DEBOUNCE_MODE == DEBOUNCE_MODE_VERTICAL
+    verticalInit(); // all buttons start released
+#else
+	// Interrupt Configuration
+    HAL_BTN_IES |= HAL_BTN_BIT; // Interrupts on button release LO TO HI
+    HAL_BTN_IE |= HAL_BTN_BIT; // Enable interrupt on button pin
+    HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear interrupt flag
+#endif
+    
+#if DEBOUNCE_MODE == DEBOUNCE_MODE_ADAPTIVE
+    // Starts with the DEBOUNCE_HZ window until the first press has been timed
+    adaptiveInit(&button, ADAPTIVE_TICKS_US(1000000UL / DEBOUNCE_HZ),
+                 ADAPTIVE_TICKS_US(ADAPTIVE_QUIET_US), ADAPTIVE_TICKS_US(ADAPTIVE_MAX_US));
+#elif DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+    wdtEnable(); // watchdog interval interrupt enabled, the watchdog stays held until a press
+#else
+    HAL_TIMER0(CCTL0) = CCIE; // CCR0 interrupt enabled
+#endif
+
+    clockInit(); // MCLK = SMCLK = CLOCK_MHZ (see Common/clock.h)
+
+#if DEBOUNCE_TIMER != DEBOUNCE_TIMER_WDT
+	// Timer frequency of 100 Hz --> 10 ms intervals
+    frequencyCalc(&debouncePeriod);    // initialize timer to 100Hz
+#endif
+#if defined(DEBOUNCE_BENCHMARK) && DEBOUNCE_MODE == DEBOUNCE_MODE_VERTICAL
+    debounceBenchmark();
+#endif
+#if DEBOUNCE_PERIODIC
+    HAL_TIMER0(CTL) = debouncePeriod.ctl + MC_1 + HAL_TIMER_CLR; // the sample tick runs for good
+#elif DEBOUNCE_MODE == DEBOUNCE_MODE_ADAPTIVE
+    HAL_TIMER0(CTL) = debouncePeriod.ctl + MC_2 + HAL_TIMER_CLR; // free-running timestamps, CCR0 marks the window end
+#endif
+
+    __enable_interrupt(); // MUST BE ENABLED IN ADDITION TO GIE
+    __bis_SR_register(CLOCK_LPM_BITS + GIE); // enable interrupts in LPM0, or LPM3 with CLOCK_LPM3
+
+}
+
+// Sets up the timer compare value to 
+void frequencyCalc(const PeriodConfig *p)
+{
+    HAL_TIMER0(CCR0) = p->ccr0; // ex. 100 Hz at 16 MHz --> 160000 cycles, /3 --> CCR0 = 53332
+#if PERIOD_HAS_IDEX
+    HAL_TIMER0(EX0) = p->ex; // expansion divider, latched by the next TACLR/TBCLR
+#endif
+}
+
+#if DEBOUNCE_PERIODIC
+#if defined(DEBOUNCE_BENCHMARK) && DEBOUNCE_MODE == DEBOUNCE_MODE_VERTICAL
+// Times 16 ticks of both engines on all 8 pins, with the debounce timer counting MCLK cycles
+void debounceBenchmark(void)
+{
+	// A bouncing press and release, one byte per tick, the same for every pin
+	static const uint8_t samples[16] = {
+		0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00
+	};
+	uint16_t start;
+	uint8_t i;
+
+	HAL_TIMER0(CTL) = HAL_TIMER_SMCLK + MC_2 + HAL_TIMER_CLR;
+
+	verticalInit();
+	start = HAL_TIMER0(R);
+	for (i = 0; i < 16; i++)
+		verticalSample(samples[i]);
+	debounceCycles[0] = HAL_TIMER0(R) - start;
+
+	integratorInit(0xFF, VERTICAL_SAMPLES);
+	start = HAL_TIMER0(R);
+	for (i = 0; i < 16; i++)
+		integratorSample(samples[i]);
+	debounceCycles[1] = HAL_TIMER0(R) - start;
+
+	HAL_TIMER0(CTL) = 0; // Stop timer
+	verticalInit();
+}
+#endif
+
+// Interrupt subroutine
+// Called on every sample tick
+#pragma vector = HAL_TIMER0_VECTOR
+__interrupt void Timer_Debounce(void)
+{
+	// Pressed buttons pull their pin low
+#if DEBOUNCE_MODE == DEBOUNCE_MODE_INTEGRATOR
+	uint8_t changed = integratorSample(~HAL_BTN_IN & DEBOUNCE_PINS);
+	uint8_t pressed = integratorState;
+#else
+	uint8_t changed = verticalSample(~HAL_BTN_IN & DEBOUNCE_PINS);
+	uint8_t pressed = verticalState;
+#endif
+
+	if (changed & pressed & HAL_BTN_BIT)
+		HAL_LED1_OUT ^= HAL_LED1_BIT; // Blink LED on every debounced press
+}
+#elif DEBOUNCE_MODE == DEBOUNCE_MODE_EAGER
+// Button pin handler, run by PORT_Button
+// Called on the first edge after a lockout window, acts on it right away
+static void buttonEdge(void)
+{
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	wdtLeft = debounceWdt.intervals;
+	wdtStart(&debounceWdt); // Start the lockout window
+#else
+	HAL_TIMER0(CTL) = debouncePeriod.ctl + MC_1 + HAL_TIMER_CLR; // Start the lockout window
+#endif
+	HAL_BTN_IE &= ~HAL_BTN_BIT; // Ignore the bounce that follows, the dispatch cleared the flag
+
+	if (state == 0)
+		HAL_LED1_OUT ^= HAL_LED1_BIT; // Blink LED on the press edge, no waiting
+	state ^= 1;
+}
+
+// Interrupt subroutine
+// Called when the lockout window ends
+#pragma vector = DEBOUNCE_VECTOR
+__interrupt void Timer_Debounce(void)
+{
+	int pressed;
+
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	if (--wdtLeft)
+		return; // Window still open
+	wdtStop();
+#else
+	HAL_TIMER0(CTL) &= ~MC_3; // Stop timer
+	HAL_TIMER0(CTL) |= HAL_TIMER_CLR; // Clear Timer
+#endif
+
+	// Arm the opposite edge, then drop the flags the bounce and the IES change left
+	if (state)
+		HAL_BTN_IES &= ~HAL_BTN_BIT; // Next edge: release, LO to HI
+	else
+		HAL_BTN_IES |= HAL_BTN_BIT; // Next edge: press, HI to LO
+	HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear flag
+
+	// The opposite edge may already have happened inside the window,
+	// a flag set by software runs PORT_Button as soon as it is enabled
+	pressed = (HAL_BTN_IN & HAL_BTN_BIT) ? 0 : 1;
+	if (pressed != state)
+		HAL_BTN_IFG |= HAL_BTN_BIT;
+
+	HAL_BTN_IE |= HAL_BTN_BIT; // Reenable interrupts
+}
+#elif DEBOUNCE_MODE == DEBOUNCE_MODE_ADAPTIVE
+// Button pin handler, run by PORT_Button
+// Called on every edge, bounce included: opens the window or pushes it out
+static void buttonEdge(void)
+{
+	uint16_t now = HAL_TIMER0(R); // Timestamp of this edge, the dispatch ahead of it takes a fixed time
+
+	HAL_BTN_IES ^= HAL_BTN_BIT; // Catch the opposite edge next
+
+	if (HAL_TIMER0(CCTL0) & CCIE)
+		HAL_TIMER0(CCR0) = adaptiveEdge(&button, now); // Bounce inside the window
+	else
+		HAL_TIMER0(CCR0) = adaptiveOpen(&button, now); // First edge
+	HAL_TIMER0(CCTL0) = CCIE; // Enable the window end, drop a stale flag
+}
+
+// Interrupt subroutine
+// Called when the window ends: the pin has been quiet, its level is the new state
+#pragma vector = HAL_TIMER0_VECTOR
+__interrupt void Timer_Debounce(void)
+{
+	int pressed = (HAL_BTN_IN & HAL_BTN_BIT) ? 0 : 1;
+
+	HAL_TIMER0(CCTL0) = 0; // Close the window
+
+	// Edges may have come faster than the interrupt, arm the edge from the level
+	if (pressed)
+		HAL_BTN_IES &= ~HAL_BTN_BIT; // Next edge: release, LO to HI
+	else
+		HAL_BTN_IES |= HAL_BTN_BIT; // Next edge: press, HI to LO
+	HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear flag
+	if (((HAL_BTN_IN & HAL_BTN_BIT) ? 0 : 1) != pressed)
+		HAL_BTN_IFG |= HAL_BTN_BIT; // Moved again while re-arming
+
+	if (pressed != state) {
+		adaptiveSettled(&button); // A real change: learn how long it bounced
+		state = pressed;
+		if (pressed)
+			HAL_LED1_OUT ^= HAL_LED1_BIT; // Blink LED on every debounced press
+	}
+}
+#else
+// Button pin handler, run by PORT_Button
+// Called whenever button is pressed
+static void buttonEdge(void)
+{
+
+    // HAL_TIMER0(CTL) = Timer A0 (Timer B0 on the FR2311) chosen for use
+    // debouncePeriod.ctl selects the clock source and ID divider
+    // MC_1 Count-up mode
+	// HAL_TIMER_CLR clears the timer register
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	wdtLeft = debounceWdt.intervals;
+	wdtStart(&debounceWdt); // Begin the delay right away, from a cleared watchdog count
+#else
+	HAL_TIMER0(CTL) = debouncePeriod.ctl + MC_1 + HAL_TIMER_CLR; // Begin timer right away
+#endif
+	
+    HAL_BTN_IE &= ~HAL_BTN_BIT;  // Disable interrupts to prevent false alarm, the dispatch cleared the flag
+
+
+}
+
+// Interrupt subroutine
+// Called when timer reaches CCR0, or at every watchdog interval
+#pragma vector = DEBOUNCE_VECTOR
+__interrupt void Timer_Debounce(void)
+{
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	if (--wdtLeft)
+		return; // Delay not over yet
+#endif
+
+	// This switch is the logic for determining the status of the button
+	// On press, the case 0 loop is entered, and on release the case 1 loop is entered
+	
+	switch(state) {
+	
+	case 0:
+		HAL_BTN_IES &= ~HAL_BTN_BIT; // Set edge HI to LO
+		state = 1;
+		break;
+	case 1:
+		HAL_LED1_OUT ^= HAL_LED1_BIT; // Blink LED
+		HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear flag
+		HAL_BTN_IES |= HAL_BTN_BIT; // Set Edge LO to HI
+		state = 0;
+		break;
+	}
+	
+	HAL_BTN_IE |= HAL_BTN_BIT; // Reenable interrupts
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	wdtStop(); // Hold the watchdog
+#else
+	HAL_TIMER0(CTL) &= ~MC_3; // Stop timer
+	HAL_TIMER0(CTL) |= HAL_TIMER_CLR; // Clear Timer
+#endif
+	
+}
+#endif
+
+#if !DEBOUNCE_PERIODIC
+// Handlers of the button port's pins, more buttons or encoder lines on the port add theirs
+static const PortHandler buttonPins[8] = { [HAL_BTN_PIN] = buttonEdge };
+
+// Interrupt subroutine
+// Called while a pin of the button port is pending, one pin per call (see Common/portirq.h)
+#pragma vector = HAL_BTN_VECTOR
+__interrupt void PORT_Button(void)
+{
+	PORT_DISPATCH(HAL_BTN_PORT, buttonPins);
+}
+#endif
@@ -0,0 +1,63 @@
+// Self-calibrating debounce window (see debounce_adaptive.h)
+
+#include "debounce_adaptive.h"
+
+// Starts with a fixed window until the first settle time is known
+void adaptiveInit(AdaptiveSwitch *s, uint16_t window, uint16_t quiet, uint16_t max)
+{
+    s->first = 0;
+    s->last = 0;
+    s->settle = 0;
+    s->dev = 0;
+    s->window = window;
+    s->quiet = quiet;
+    s->max = max;
+    s->samples = 0;
+}
+
+// Called on the edge that opens a window, returns the timestamp it ends at
+uint16_t adaptiveOpen(AdaptiveSwitch *s, uint16_t now)
+{
+    s->first = now;
+    s->last = now;
+    return now + s->window;
+}
+
+// Called on every further edge inside the window, returns the new end
+//
+// Timestamps are compared as offsets from the first edge, so the 16-bit
+// timer may wrap inside the window.
+uint16_t adaptiveEdge(AdaptiveSwitch *s, uint16_t now)
+{
+    uint16_t elapsed = now - s->first;
+
+    s->last = now;
+    if (elapsed + s->quiet > s->window)
+        return now + s->quiet; // still bouncing near the end, wait for it to stop
+    return s->first + s->window;
+}
+
+// Called when a window ended with a changed state: learns the settle time
+void adaptiveSettled(AdaptiveSwitch *s)
+{
+    uint16_t sample = s->last - s->first;
+    int32_t err;
+    uint32_t window;
+
+    if (s->samples == 0) {
+        s->settle = sample;
+        s->dev = sample >> 1;
+    }
+    else {
+        err = (int32_t)sample - s->settle;
+        s->settle += err >> 3; // mean += err / 8
+        if (err < 0)
+            err = -err;
+        s->dev += (err - s->dev) >> 2; // deviation += (|err| - deviation) / 4
+    }
+    if (s->samples < 255)
+        s->samples++;
+
+    window = (uint32_t)s->settle + 4UL * s->dev + s->quiet;
+    s->window = window > s->max ? s->max : (uint16_t)window;
+}
@@ -0,0 +1,39 @@
+// Self-calibrating debounce window
+//
+// The pin interrupt stays on for both edges, and every edge is timestamped
+// with a free-running timer. The first edge opens a lockout window. The edges
+// that follow are bounce: they are timestamped too, and the window is pushed
+// out so that it never ends less than `quiet` ticks after the last of them.
+// When the window closes, the pin level is the new state. If the state
+// changed, the time from the first to the last edge is one settle-time sample.
+//
+// The samples feed a running mean and mean deviation, updated the way TCP
+// tracks round-trip time (gains of 1/8 and 1/4, shifts only). The next window
+// is mean + 4 * deviation + quiet, clamped to `max`. A switch that settles in
+// 1 ms gets a window of a few ms, a worn one that bounces longer grows its own.
+//
+// All times are in ticks of the caller's free-running 16-bit timer, so the
+// window must stay well under one timer wrap.
+
+#ifndef DEBOUNCE_ADAPTIVE_H
+#define DEBOUNCE_ADAPTIVE_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint16_t first;   // timestamp of the edge that opened the window
+    uint16_t last;    // timestamp of the latest edge in the window
+    uint16_t settle;  // running mean of the settle time
+    uint16_t dev;     // running mean deviation of the settle time
+    uint16_t window;  // lockout the next window starts with
+    uint16_t quiet;   // least time between the last edge and the end of a window
+    uint16_t max;     // longest window
+    uint8_t samples;  // settle times learned, stops counting at 255
+} AdaptiveSwitch;
+
+void adaptiveInit(AdaptiveSwitch *s, uint16_t window, uint16_t quiet, uint16_t max);
+uint16_t adaptiveOpen(AdaptiveSwitch *s, uint16_t now);
+uint16_t adaptiveEdge(AdaptiveSwitch *s, uint16_t now);
+void adaptiveSettled(AdaptiveSwitch *s);
+
+#endif
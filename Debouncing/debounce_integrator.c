@@ -0,0 +1,53 @@
+// Periodic-sampling integrator debouncer (see debounce_integrator.h)
+
+#include "debounce_integrator.h"
+
+volatile uint8_t integratorState = 0;
+
+static uint8_t integratorPins;
+static uint8_t integratorTop;
+static uint8_t integratorCount[8];
+
+// Starts every pin released; ticks (1-255) is how many net samples a change needs
+void integratorInit(uint8_t pins, uint8_t ticks)
+{
+    uint8_t i;
+
+    for (i = 0; i < 8; i++)
+        integratorCount[i] = 0;
+    integratorPins = pins;
+    integratorTop = ticks;
+    integratorState = 0;
+}
+
+// Called once per tick with the pins that read pressed
+//
+// Returns the pins whose debounced state changed on this tick: the ones also
+// set in integratorState were pressed, the others were released.
+uint8_t integratorSample(uint8_t pressed)
+{
+    uint8_t state = integratorState;
+    uint8_t bit = 1;
+    uint8_t changed;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++, bit <<= 1) {
+        if (!(integratorPins & bit))
+            continue;
+        if (pressed & bit) {
+            if (integratorCount[i] < integratorTop)
+                integratorCount[i]++;
+        }
+        else if (integratorCount[i])
+            integratorCount[i]--;
+
+        if (integratorCount[i] == integratorTop)
+            state |= bit;
+        else if (integratorCount[i] == 0)
+            state &= ~bit;
+    }
+
+    changed = state ^ integratorState;
+    integratorState = state;
+    return changed;
+}
@@ -0,0 +1,22 @@
+// Periodic-sampling integrator debouncer
+//
+// A fixed-rate tick samples every button pin of one port at once. Each pin has a
+// saturating counter that counts up while the pin reads pressed and down while
+// it reads released. The debounced state only changes when the counter reaches
+// the top (pressed) or zero (released), so a level has to win for
+// INTEGRATOR_TICKS samples in a row, net of bounce, before it is reported.
+//
+// The work per tick is the same whether the switches bounce or not, it needs
+// no pin interrupts, and the timer is never reconfigured per press.
+
+#ifndef DEBOUNCE_INTEGRATOR_H
+#define DEBOUNCE_INTEGRATOR_H
+
+#include <stdint.h>
+
+extern volatile uint8_t integratorState; // debounced pins, 1 = pressed
+
+void integratorInit(uint8_t pins, uint8_t ticks);
+uint8_t integratorSample(uint8_t pressed);
+
+#endif
@@ -0,0 +1,16 @@
+// Vertical-counter debouncer for a whole 8-bit port (see debounce_vertical.h)
+
+#include "debounce_vertical.h"
+
+uint8_t verticalPlane[VERTICAL_PLANES];
+volatile uint8_t verticalState = 0;
+
+// Starts every pin released with its counter reloaded
+void verticalInit(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < VERTICAL_PLANES; i++)
+        verticalPlane[i] = 0xFF;
+    verticalState = 0;
+}
@@ -0,0 +1,62 @@
+// Vertical-counter debouncer for a whole 8-bit port
+//
+// Each pin has a small counter whose bits are spread over VERTICAL_PLANES
+// bytes: bit n of every plane belongs to pin n. One bitwise operation on a
+// plane therefore steps the counters of all 8 pins at once, like SIMD within a
+// register. A pin whose sample differs from its debounced state counts down,
+// a sample that agrees resets its counter. After VERTICAL_SAMPLES differing
+// samples in a row the counter wraps and the debounced state of the pin flips.
+//
+// verticalSample() is straight-line code, the same for 1 or 8 pins and the
+// same however much the switches bounce.
+
+#ifndef DEBOUNCE_VERTICAL_H
+#define DEBOUNCE_VERTICAL_H
+
+#include <stdint.h>
+
+// Counter bits per pin, 2 to 4
+#ifndef VERTICAL_PLANES
+#define VERTICAL_PLANES 3
+#endif
+#if VERTICAL_PLANES < 2 || VERTICAL_PLANES > 4
+#error "VERTICAL_PLANES must be 2, 3 or 4"
+#endif
+
+#define VERTICAL_SAMPLES (1 << VERTICAL_PLANES) // differing samples in a row that flip a pin
+
+extern uint8_t verticalPlane[VERTICAL_PLANES];
+extern volatile uint8_t verticalState; // debounced pins, 1 = pressed
+
+void verticalInit(void);
+
+// One plane of the down-counters: counts where delta is set, reloads all ones where it is not
+#define VERTICAL_STEP(n) \
+    old = verticalPlane[n]; \
+    verticalPlane[n] = (old ^ borrow) | ~delta; \
+    borrow &= ~old
+
+// Called once per tick with the pins that read pressed
+//
+// Returns the pins whose debounced state changed on this tick: the ones also
+// set in verticalState were pressed, the others were released.
+static inline uint8_t verticalSample(uint8_t pressed)
+{
+    uint8_t delta = pressed ^ verticalState; // pins that disagree with their debounced state
+    uint8_t borrow = delta; // a pin borrows past every plane once its counter wraps
+    uint8_t old;
+
+    VERTICAL_STEP(0);
+    VERTICAL_STEP(1);
+#if VERTICAL_PLANES > 2
+    VERTICAL_STEP(2);
+#endif
+#if VERTICAL_PLANES > 3
+    VERTICAL_STEP(3);
+#endif
+
+    verticalState ^= borrow;
+    return borrow;
+}
+
+#endif
@@ -0,0 +1,894 @@
+// Hardware PWM, one source for every board
+// The board is picked by the device define through Common/hal.h
+#include "../Common/hal.h"
+#include "../Common/clock.h"
+#include "../Common/period.h"
+#include "../Common/portirq.h"
+
+// The PWM pin hangs off timer 0 on most boards and timer 1 on the FR2311,
+// the other timer of the pair times the button
+#if HAL_PWM_TIMER_IS_1
+#define PWM_TIMER HAL_TIMER1
+#define PWM_TIMER_VECTOR HAL_TIMER1_VECTOR
+#define BUTTON_TIMER HAL_TIMER0
+#define BUTTON_TIMER_VECTOR HAL_TIMER0_VECTOR
+#else
+#define PWM_TIMER HAL_TIMER0
+#define PWM_TIMER_VECTOR HAL_TIMER0_VECTOR
+#define BUTTON_TIMER HAL_TIMER1
+#define BUTTON_TIMER_VECTOR HAL_TIMER1_VECTOR
+#endif
+
+// Status LED: whichever LED the PWM output does not drive
+#if HAL_PWM_LED == 1
+#define STATUS_OUT HAL_LED2_OUT
+#define STATUS_BIT HAL_LED2_BIT
+#else
+#define STATUS_OUT HAL_LED1_OUT
+#define STATUS_BIT HAL_LED1_BIT
+#endif
+
+// Button timing
+// TIMING_MODE_ONESHOT: the button timer runs one debounce interval per press
+// TIMING_MODE_WHEEL:   debounce, duty fade and status flash share the button timer through Common/timer_wheel.c
+// TIMING_MODE_WDT:     the watchdog in interval mode times the debounce interval (Common/wdt.h), the button timer stays free
+#define TIMING_MODE_ONESHOT 0
+#define TIMING_MODE_WHEEL   1
+#define TIMING_MODE_WDT     2
+
+#ifndef TIMING_MODE
+#define TIMING_MODE TIMING_MODE_ONESHOT
+#endif
+
+void timerSetup(const PeriodConfig *p);
+
+#define DEBOUNCE_HZ 100 // 100 Hz --> 10 ms intervals
+
+#if TIMING_MODE == TIMING_MODE_WHEEL
+#include "../Common/timer_wheel.h"
+
+// Wheel ticks are 2^WHEEL_SHIFT counts of the button timer at SMCLK / 8, 0.5 to 1 ms
+#define WHEEL_TIMER_HZ (CLOCK_SMCLK_HZ / 8)
+#define WHEEL_SHIFT (WHEEL_TIMER_HZ >= 2048000 ? 11 : WHEEL_TIMER_HZ >= 1024000 ? 10 : \
+                     WHEEL_TIMER_HZ >= 512000 ? 9 : WHEEL_TIMER_HZ >= 256000 ? 8 : 7)
+#define WHEEL_MS(ms) ((uint16_t)(((uint32_t)(ms) * (WHEEL_TIMER_HZ / 1000) + \
+                                  (1UL << WHEEL_SHIFT) - 1) >> WHEEL_SHIFT)) // rounded up
+
+// Farthest the compare is programmed ahead, inside one wrap of the 16-bit count
+#define WHEEL_WRAP_TICKS (1U << (16 - WHEEL_SHIFT))
+#define WHEEL_SLEEP (WHEEL_WRAP_TICKS - 1 < WHEEL_SLOTS ? WHEEL_WRAP_TICKS - 1 : WHEEL_SLOTS)
+
+#define FADE_MS 2 // the duty cycle moves one FADE_STEP per FADE_MS
+#define FLASH_MS 100 // status LED on time per press
+
+void timerWheel(void);
+#if CLOCK_LPM3
+#error "the wheel counts SMCLK / 8, which stops in LPM3"
+#endif
+#elif TIMING_MODE == TIMING_MODE_WDT
+#include "../Common/wdt.h"
+
+#ifndef WDT_ACLK
+#define WDT_ACLK 0 // 1: the intervals come from ACLK, as they do anyway with CLOCK_LPM3
+#endif
+#define WDT_SMCLK_HZ (WDT_ACLK ? 0 : CLOCK_TIMER_SMCLK_HZ)
+
+// Watchdog interval and the intervals in one debounce delay, solved at compile time
+static const WdtConfig debounceWdt = WDT_CONFIG(WDT_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+WDT_ASSERT(WDT_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+
+uint16_t wdtLeft; // intervals to the end of the delay
+#define BUTTON_VECTOR WDT_VECTOR
+#else
+// Debounce timer settings, solved at compile time
+static const PeriodConfig debouncePeriod = PERIOD_CONFIG(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+PERIOD_ASSERT(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+#endif
+
+#ifndef BUTTON_VECTOR
+#define BUTTON_VECTOR BUTTON_TIMER_VECTOR
+#endif
+
+#ifndef PWM_HZ
+#if CLOCK_LPM3
+#define PWM_HZ 128 // LED PWM rate, from ACLK: 256 ticks at 32768 Hz, 94 from the G2553's VLO
+#else
+#define PWM_HZ 10000 // LED PWM rate
+#endif
+#endif
+#define PWM_TICKS (PERIOD_CCR0(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, PWM_HZ) + 1) // timer ticks per PWM period
+#define PWM_STEP (PWM_TICKS / 10) // one button press adds 10 % duty cycle
+#define FADE_STEP (PWM_STEP / 32 + 1) // a 10 % step fades in about 64 ms
+
+// PWM timer settings, solved at compile time
+static const PeriodConfig pwmPeriod = PERIOD_CONFIG(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, PWM_HZ);
+PERIOD_ASSERT(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, PWM_HZ);
+
+// Duty cycle updates
+// dutySet() stages a new CCR1 value, which takes effect when the next PWM period
+// starts. A period never ends early or runs on with the output set, whatever
+// point of the period the update comes at. Timer_B buffers CCR1 itself: with
+// CLLD_1 the compare latch loads when the count wraps to 0. Timer_A compares
+// with CCR1 directly, so the value waits in dutyStaged and Timer_Commit loads
+// it from the CCR0 interrupt, which is only enabled while a value is waiting.
+uint16_t dutyStaged = PWM_TICKS / 2; // duty cycle of the coming periods, in PWM timer ticks
+
+void dutySet(uint16_t duty);
+
+// Duty cycle playback
+// PLAYBACK_MODE_OFF: the button steps the duty cycle
+// PLAYBACK_MODE_DMA: DMA plays an envelope from envelopes.h into CCR1 while the CPU sleeps (F5529, FR5994, FR6989)
+// PLAYBACK_MODE_ISR: the PWM timer's CCR0 interrupt plays it, on every board
+// In both playback modes the button picks the next envelope. Boards without DMA fall back to the ISR.
+#define PLAYBACK_MODE_OFF 0
+#define PLAYBACK_MODE_DMA 1
+#define PLAYBACK_MODE_ISR 2
+
+#ifndef PLAYBACK_MODE
+#define PLAYBACK_MODE PLAYBACK_MODE_OFF
+#endif
+#if PLAYBACK_MODE == PLAYBACK_MODE_DMA && !HAL_DMA
+#undef PLAYBACK_MODE
+#define PLAYBACK_MODE PLAYBACK_MODE_ISR // no DMA controller on this board
+#endif
+
+#if PLAYBACK_MODE != PLAYBACK_MODE_OFF
+#if TIMING_MODE == TIMING_MODE_WHEEL
+#error "playback runs with the one-shot button timing, the wheel's fades would fight it"
+#endif
+
+#define PLAY_STEP_HZ 64 // envelope steps per second: the 128-step Breathe takes 2 s
+// Darkest duty cycle in ticks. Each period's value is written just after the
+// count restarts, a few cycles by DMA, about 25 by the ISR; a shorter duty cycle
+// would already be passed and leave the output set for the whole period.
+#if CLOCK_LPM3
+#define PLAY_FLOOR 2 // an ACLK tick outlasts the write, and the wake-up from LPM3
+#else
+#define PLAY_FLOOR 32
+#endif
+#define ENVELOPE(v) ((uint16_t)(PLAY_FLOOR + (uint32_t)(v) * (PWM_TICKS - PLAY_FLOOR) / ENVELOPE_TOP))
+#include "envelopes.h"
+
+typedef struct {
+	const uint16_t *table;
+	uint16_t steps;
+} Envelope;
+
+static const Envelope envelopes[] = {
+	{ envelopeBreathe, sizeof(envelopeBreathe) / sizeof(envelopeBreathe[0]) },
+	{ envelopeHeartbeat, sizeof(envelopeHeartbeat) / sizeof(envelopeHeartbeat[0]) },
+	{ envelopeRamp, sizeof(envelopeRamp) / sizeof(envelopeRamp[0]) },
+};
+#define ENVELOPES (sizeof(envelopes) / sizeof(envelopes[0]))
+
+uint8_t playEnvelope; // index into envelopes[]
+
+#if PLAYBACK_MODE == PLAYBACK_MODE_DMA
+// Channel 1 copies the next step into playDuty on every step timer period,
+// channel 0 copies playDuty into CCR1 on every PWM period, so a step never
+// lands in the middle of a period
+static const PeriodConfig playPeriod = PERIOD_CONFIG(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, PLAY_STEP_HZ);
+PERIOD_ASSERT(CLOCK_TIMER_SMCLK_HZ, CLOCK_ACLK_HZ, PLAY_STEP_HZ);
+
+uint16_t playDuty = PWM_TICKS / 2; // duty cycle of the current step
+#else
+#define PLAY_PERIODS (PWM_HZ / PLAY_STEP_HZ) // PWM periods per envelope step
+#if PLAY_PERIODS > 255
+#error "PLAY_PERIODS does not fit playWait"
+#endif
+
+const uint16_t *playNext; // step loaded at the next countdown
+const uint16_t *playEnd; // one past the envelope's last step
+uint8_t playWait = 1; // PWM periods to the next step
+#endif
+
+void playSetup(void);
+void playSelect(uint8_t e);
+#endif
+
+// Outputs
+// OUTPUT_MODE_LED:      one output on the PWM LED pin
+// OUTPUT_MODE_CHANNELS: every channel of Common/pwm.c (RGB LEDs, motor drivers), the button steps through colors
+// OUTPUT_MODE_BRIDGE:   channels 1 and 2 as a complementary, center-aligned pair with dead time (half-bridge gates)
+#define OUTPUT_MODE_LED      0
+#define OUTPUT_MODE_CHANNELS 1
+#define OUTPUT_MODE_BRIDGE   2
+
+#ifndef OUTPUT_MODE
+#define OUTPUT_MODE OUTPUT_MODE_LED
+#endif
+
+#if OUTPUT_MODE == OUTPUT_MODE_CHANNELS
+#if TIMING_MODE == TIMING_MODE_WHEEL || PLAYBACK_MODE != PLAYBACK_MODE_OFF
+#error "the channel outputs run with the one-shot button timing and without playback"
+#endif
+#include "../Common/pwm.h"
+
+#define PWM_PERCENT(p) ((uint16_t)((uint32_t)(p) * PWM_TICKS / 100))
+#define COLOR(r, g, b) { PWM_PERCENT(r), PWM_PERCENT(g), PWM_PERCENT(b) }
+
+// Colors the button steps through, red, green and blue in percent. Channel n
+// shows component n % 3, so six channels drive two RGB LEDs.
+static const uint16_t colors[][3] = {
+	COLOR(100, 0, 0), COLOR(100, 50, 0), COLOR(100, 100, 0), COLOR(0, 100, 0),
+	COLOR(0, 100, 100), COLOR(0, 0, 100), COLOR(50, 0, 100), COLOR(100, 100, 100), COLOR(0, 0, 0),
+};
+#define COLORS (sizeof(colors) / sizeof(colors[0]))
+
+uint8_t color = COLORS - 1; // index into colors[], starts dark
+
+void colorShow(uint8_t c);
+#endif
+
+#if OUTPUT_MODE == OUTPUT_MODE_BRIDGE
+#if TIMING_MODE == TIMING_MODE_WHEEL || PLAYBACK_MODE != PLAYBACK_MODE_OFF
+#error "the bridge outputs run with the one-shot button timing and without playback"
+#endif
+#if HAL_PWMCH_COUNT < 2
+#error "the bridge needs two channel outputs, HAL_PWMCH_COUNT in Common/hal.h"
+#endif
+#if CLOCK_LPM3
+#error "the bridge's dead time needs SMCLK ticks, ACLK would make it tens of us"
+#endif
+
+// Center-aligned complementary PWM on the channel timer (HAL_PWMCH_TIMER)
+// The timer counts up to BRIDGE_TOP and back down (MC_3), one PWM period per
+// round trip. The high side, CCR1 in OUTMOD_2 (toggle/reset), is on while the
+// count is below CCR1: a pulse centred on the turn at 0. The low side, CCR2 in
+// OUTMOD_6 (toggle/set), is on while the count is above CCR2: a pulse centred
+// on the turn at the top. CCR2 = CCR1 + BRIDGE_DEAD, so whichever side goes off,
+// both stay off for BRIDGE_DEAD ticks before the other comes on.
+#define BRIDGE_HZ 10000 // bridge PWM rate
+#define BRIDGE_TOP (PERIOD_CCR0(CLOCK_SMCLK_HZ, CLOCK_ACLK_HZ, 2 * BRIDGE_HZ) + 1) // CCR0, half a period in ticks
+#ifndef BRIDGE_DEAD
+#define BRIDGE_DEAD 16 // dead time in channel timer ticks, 1 us at 16 MHz
+#endif
+#define BRIDGE_MARGIN 32 // ticks both compares keep from the turns, see Timer_Bridge
+#define BRIDGE_MIN BRIDGE_MARGIN // high side duty cycle range, CCR1 values
+#define BRIDGE_MAX (BRIDGE_TOP - BRIDGE_MARGIN - BRIDGE_DEAD)
+#define BRIDGE_STEP (BRIDGE_TOP / 10) // one button press adds 10 % to the high side
+#if HAL_PWMCH_IS_B
+#define BRIDGE_CLR TBCLR // the channel timer's clear bit, it can differ from HAL_TIMER's
+#else
+#define BRIDGE_CLR TACLR
+#endif
+
+// Channel timer settings for the half period, solved at compile time
+static const PeriodConfig bridgePeriod = PERIOD_CONFIG(CLOCK_SMCLK_HZ, CLOCK_ACLK_HZ, 2 * BRIDGE_HZ);
+PERIOD_ASSERT(CLOCK_SMCLK_HZ, CLOCK_ACLK_HZ, 2 * BRIDGE_HZ);
+typedef char bridgeDeadAssert[BRIDGE_MIN < BRIDGE_MAX ? 1 : -1]; // the dead time leaves a duty cycle range
+
+// Duty cycle updates load at a turn, while both outputs are held by the count
+// being past every compare. Timer_B loads its latches there itself (CLLD_2, with
+// CCR1 and CCR2 grouped so they load together). Timer_A compares with the CCRs
+// directly, so the value waits in bridgeDuty and Timer_Bridge writes it at the top.
+uint16_t bridgeDuty = BRIDGE_MIN; // high side CCR1, in channel timer ticks
+
+void bridgeSet(uint16_t duty);
+#endif
+
+// Input capture
+// CAPTURE_MODE_OFF:      the button timer only runs for a debounce interval
+// CAPTURE_MODE_LOOPBACK: the button timer runs on as the timebase of Common/capture.c, which measures the
+//                        frequency and duty cycle on the capture pin of Common/hal.h: wire the PWM output to it
+#define CAPTURE_MODE_OFF      0
+#define CAPTURE_MODE_LOOPBACK 1
+
+#ifndef CAPTURE_MODE
+#define CAPTURE_MODE CAPTURE_MODE_OFF
+#endif
+
+#if CAPTURE_MODE != CAPTURE_MODE_OFF
+#if TIMING_MODE == TIMING_MODE_WHEEL
+#error "capture runs with the one-shot button timing, the wheel has the button timer to itself"
+#endif
+#if CLOCK_LPM3
+#error "capture counts SMCLK, which stops in LPM3"
+#endif
+#include "../Common/capture.h"
+
+// Capture timebase, the button timer (HAL_CAP_TIMER is the same timer): SMCLK
+// through the least power-of-two divider that fits a debounce interval into 16
+// bits, so a PWM period is a whole number of ticks. The debounce interval is a
+// CCR0 compare this many ticks after the press.
+#define CAPTURE_CYCLES (CLOCK_SMCLK_HZ / DEBOUNCE_HZ)
+#define CAPTURE_ID (CAPTURE_CYCLES <= 0x10000UL ? 1 : CAPTURE_CYCLES <= 0x20000UL ? 2 : \
+                    CAPTURE_CYCLES <= 0x40000UL ? 4 : 8)
+static const PeriodConfig capturePeriod = {
+    PERIOD_SEL_SMCLK + PERIOD_ID_BITS(CAPTURE_ID), 0, (uint16_t)(CAPTURE_CYCLES / CAPTURE_ID - 1),
+    DEBOUNCE_HZ * 1000UL };
+
+CaptureResult captureResult; // the last full window, see Common/capture.h
+#endif
+
+// Button input
+// BUTTON_MODE_STEP:    every press adds PWM_STEP, back to 0 after full
+// BUTTON_MODE_GESTURE: clicks, double-clicks, long presses and repeats (Common/gesture.h) step the duty cycle
+#define BUTTON_MODE_STEP    0
+#define BUTTON_MODE_GESTURE 1
+
+#ifndef BUTTON_MODE
+#define BUTTON_MODE BUTTON_MODE_STEP
+#endif
+
+#if BUTTON_MODE == BUTTON_MODE_GESTURE
+#if TIMING_MODE != TIMING_MODE_ONESHOT || OUTPUT_MODE != OUTPUT_MODE_LED || \
+    PLAYBACK_MODE != PLAYBACK_MODE_OFF || CAPTURE_MODE != CAPTURE_MODE_OFF
+#error "gestures run with the one-shot button timing, on the LED output, without playback or capture"
+#endif
+#include "../Common/event_queue.h"
+#include "../Common/gesture.h"
+
+// The button timer goes on running while a gesture waits, one tick per debounce
+// interval. The ticks are the time stamps of the gestures.
+#define BUTTON_TICKS_MS(ms) ((uint16_t)((uint32_t)(ms) * DEBOUNCE_HZ / 1000))
+
+#ifndef GESTURE_LONG_MS
+#define GESTURE_LONG_MS 600 // hold for a long press: start ramping to full or off
+#endif
+#ifndef GESTURE_DOUBLE_MS
+#define GESTURE_DOUBLE_MS 0 // 0: a click steps up on release; e.g. 300: the gap for a double-click, one step down
+#endif
+#ifndef GESTURE_REPEAT_MS
+#define GESTURE_REPEAT_MS 100 // ramp step while held after a long press
+#endif
+
+Gesture button;
+uint16_t buttonTicks; // button timer ticks while a gesture is under way
+int buttonState = 0; // debounced, 1 while pressed
+int rampDown = 0; // direction of the ramp a long press starts
+
+void gestureAction(uint8_t gesture);
+#endif
+
+int main(void)
+{
+    WDTCTL = WDTPW | WDTHOLD;   // Stop watchdog timer
+	halUnlockPins(); // FRAM parts: release the pins from high-impedance mode
+
+	// LEDs
+#if HAL_PWM_LED == 0
+    halLedInit(HAL_PWM_BIT); // Set both LEDs and the PWM pin (on P1 on such boards) as output
+#else
+    halLedInit(0); // Set both LEDs as output, one of them is the PWM pin
+#endif
+#if OUTPUT_MODE == OUTPUT_MODE_LED
+	HAL_PWM_SEL |= HAL_PWM_BIT; //Tied to the specific peripheral connected to pin, not general I/O
+#endif
+    
+	// Button and Interrupt Configuration
+	HAL_BTN_REN |= HAL_BTN_BIT; // Connects the on-board resistor to the button
+    HAL_BTN_OUT = HAL_BTN_BIT; // Sets up the button as pull-up resistor
+#if BUTTON_MODE == BUTTON_MODE_GESTURE
+    HAL_BTN_IES |= HAL_BTN_BIT; // Both edges are debounced, the press (HI to LO) first
+    gestureInit(&button, BUTTON_TICKS_MS(GESTURE_LONG_MS), BUTTON_TICKS_MS(GESTURE_DOUBLE_MS),
+                BUTTON_TICKS_MS(GESTURE_REPEAT_MS));
+#endif
+    HAL_BTN_IE |= HAL_BTN_BIT; // Enable interrupt on button pin
+    HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear interrupt flag
+
+    clockInit(); // MCLK = SMCLK = CLOCK_MHZ (see Common/clock.h)
+
+#if TIMING_MODE == TIMING_MODE_WHEEL
+    timerSetup(0); // PWM timer only, there is no debounce period in this mode
+    timerWheel(); // button timer free-running, the wheel wakes it only for armed timers
+#elif CAPTURE_MODE != CAPTURE_MODE_OFF
+    timerSetup(&capturePeriod); // button timer running, capturing
+#elif TIMING_MODE == TIMING_MODE_WDT
+    timerSetup(0); // PWM timer only, the watchdog times the button
+#else
+	// Timer frequency of 100 Hz --> 10 ms intervals
+    timerSetup(&debouncePeriod);    // initialize timer to 100Hz
+#endif
+#if OUTPUT_MODE == OUTPUT_MODE_CHANNELS
+    pwmInit(&pwmPeriod); // channel timer and pins, every channel off
+#endif
+#if PLAYBACK_MODE != PLAYBACK_MODE_OFF
+    playSetup(); // envelope playback on the PWM timer
+#endif
+
+    __enable_interrupt(); // MUST BE ENABLED IN ADDITION TO GIE
+    __bis_SR_register(GIE); // enable global interrupts
+#if CAPTURE_MODE != CAPTURE_MODE_OFF
+    for (;;) {
+        __bis_SR_register(LPM0_bits); // sleep, Timer_Capture wakes it with a full window
+        captureRead(&captureResult); // the statistics, and the next window starts
+    }
+#else
+    __bis_SR_register(CLOCK_LPM_BITS); // sleep, LPM0 or with CLOCK_LPM3 LPM3: the timers (and the DMA) run on
+#endif
+
+}
+
+// Sets up the timer compare value to 
+void timerSetup(const PeriodConfig *p)
+{
+#if CAPTURE_MODE != CAPTURE_MODE_OFF
+    BUTTON_TIMER(CCTL0) = 0; // no debounce compare until a press
+    captureInit(p); // starts the button timer for good
+#elif TIMING_MODE == TIMING_MODE_ONESHOT
+    BUTTON_TIMER(CCR0) = p->ccr0; // ex. 100 Hz at 16 MHz --> 160000 cycles, /3 --> CCR0 = 53332
+#if PERIOD_HAS_IDEX
+    BUTTON_TIMER(EX0) = p->ex; // expansion divider, latched by the clear below
+#endif
+    BUTTON_TIMER(CTL) = HAL_TIMER_CLR; // stopped at 0, the press only sets the mode
+    BUTTON_TIMER(CCTL0) = CCIE; // capture compare interrupt enabled
+#endif
+#if TIMING_MODE == TIMING_MODE_WDT
+    wdtEnable(); // watchdog interval interrupt enabled, the watchdog stays held until a press
+#endif
+#if OUTPUT_MODE == OUTPUT_MODE_LED
+    
+    // DUTY CYCLE Timer
+    PWM_TIMER(CCR1) = dutyStaged; //initialization of duty cycle 50% (variable), loads at once
+#if HAL_TIMER_IS_B
+	PWM_TIMER(CCTL1) = OUTMOD_7 + CLLD_1; // sets and resets the capture compare, later CCR1 writes load at the wrap
+#else
+	PWM_TIMER(CCTL1) = OUTMOD_7; // sets and resets the capture compare
+#endif
+	PWM_TIMER(CCR0) = pwmPeriod.ccr0; // PWM period (fixed)
+#if PERIOD_HAS_IDEX
+    PWM_TIMER(EX0) = pwmPeriod.ex; // expansion divider, latched by the clear below
+#endif
+    PWM_TIMER(CTL) = pwmPeriod.ctl + MC_1 + HAL_TIMER_CLR;
+#elif OUTPUT_MODE == OUTPUT_MODE_BRIDGE
+
+    // Bridge timer, counting up from 0 with the high side on and the low side off
+    HAL_PWMCH_TIMER(CTL) = BRIDGE_CLR; // stopped, latches ungrouped while they load
+    HAL_PWMCH_TIMER(CCTL1) = OUTMOD_0 + OUT; // high side on
+    HAL_PWMCH_TIMER(CCTL2) = OUTMOD_0; // low side off
+    HAL_PWMCH_TIMER(CCR1) = bridgeDuty;
+    HAL_PWMCH_TIMER(CCR2) = bridgeDuty + BRIDGE_DEAD;
+    HAL_PWMCH_TIMER(CCR0) = BRIDGE_TOP; // the turn, half a period
+#if PERIOD_HAS_IDEX
+    HAL_PWMCH_TIMER(EX0) = bridgePeriod.ex; // expansion divider, latched by the clear below
+#endif
+#if HAL_PWMCH_IS_B
+	HAL_PWMCH_TIMER(CCTL1) = OUTMOD_2 + CLLD_2; // toggle/reset, later writes load at 0 or the top
+	HAL_PWMCH_TIMER(CCTL2) = OUTMOD_6 + CLLD_2; // toggle/set
+    HAL_PWMCH_TIMER(CTL) = bridgePeriod.ctl + MC_3 + TBCLGRP_1 + BRIDGE_CLR; // CCR1 and CCR2 load together
+#else
+	HAL_PWMCH_TIMER(CCTL1) = OUTMOD_2; // toggle/reset
+	HAL_PWMCH_TIMER(CCTL2) = OUTMOD_6; // toggle/set
+    HAL_PWMCH_TIMER(CTL) = bridgePeriod.ctl + MC_3 + BRIDGE_CLR;
+#endif
+
+    halPwmChannelPins();
+#endif
+}
+
+// Stages a new duty cycle for the next period. Call it from an ISR, or with
+// interrupts disabled, so Timer_Commit cannot run halfway through.
+void dutySet(uint16_t duty)
+{
+	dutyStaged = duty;
+#if HAL_TIMER_IS_B
+	PWM_TIMER(CCR1) = duty; // TBxCCR1 is the buffer, TBxCL1 loads it when the count wraps
+#else
+	PWM_TIMER(CCTL0) = CCIE; // Timer_Commit at the end of this period, also drops the stale flag
+#endif
+}
+
+#if PLAYBACK_MODE == PLAYBACK_MODE_DMA
+// Sets up both DMA channels and starts the step timer
+void playSetup(void)
+{
+	DMACTL0 = HAL_DMA0TSEL_TIMER0 + HAL_DMA1TSEL_TIMER2; // channel 0 on the PWM period, channel 1 on the step
+	DMACTL4 = DMARMWDIS; // no transfer in the middle of a CPU read-modify-write
+
+	// Channel 0: playDuty into CCR1, one word per PWM period, forever
+	__data16_write_addr((unsigned long)&DMA0SA, (unsigned long)&playDuty);
+	__data16_write_addr((unsigned long)&DMA0DA, (unsigned long)&PWM_TIMER(CCR1));
+	DMA0SZ = 1;
+	DMA0CTL = DMADT_4 + DMASRCINCR_0 + DMADSTINCR_0 + DMAEN; // repeated single transfer, fixed addresses
+
+	// Channel 1: the envelope into playDuty, one step per step timer period
+	__data16_write_addr((unsigned long)&DMA1DA, (unsigned long)&playDuty);
+	playSelect(0);
+
+	// Step timer: the CCR0 flag requests channel 1, no interrupt
+	HAL_TIMER2(CCR0) = playPeriod.ccr0;
+#if PERIOD_HAS_IDEX
+	HAL_TIMER2(EX0) = playPeriod.ex; // expansion divider, latched by the clear below
+#endif
+	HAL_TIMER2(CCTL0) = 0;
+	HAL_TIMER2(CTL) = playPeriod.ctl + MC_1 + HAL_TIMER_CLR;
+}
+
+// Restarts channel 1 on the first step of envelope e
+void playSelect(uint8_t e)
+{
+	playEnvelope = e;
+	DMA1CTL = 0; // stop it while the table changes
+	__data16_write_addr((unsigned long)&DMA1SA, (unsigned long)envelopes[e].table);
+	DMA1SZ = envelopes[e].steps;
+	DMA1CTL = DMADT_4 + DMASRCINCR_3 + DMADSTINCR_0 + DMAEN; // repeated single transfer, source walks the table
+}
+#elif PLAYBACK_MODE == PLAYBACK_MODE_ISR
+void playSetup(void)
+{
+	playSelect(0);
+	PWM_TIMER(CCTL0) = CCIE; // Timer_Play at the end of every period
+}
+
+// Restarts the playback on the first step of envelope e. Call it from an ISR,
+// or with interrupts disabled, so Timer_Play cannot run halfway through.
+void playSelect(uint8_t e)
+{
+	playEnvelope = e;
+	playNext = envelopes[e].table;
+	playEnd = playNext + envelopes[e].steps;
+	playWait = 1; // first step from the next period
+}
+
+// Interrupt subroutine
+// Called when the PWM timer reaches CCR0, the end of every period
+#pragma vector = PWM_TIMER_VECTOR
+__interrupt void Timer_Play(void)
+{
+	if (--playWait)
+		return; // most periods: the step goes on
+	playWait = PLAY_PERIODS;
+
+	PWM_TIMER(CCR1) = *playNext; // the count has just restarted, see PLAY_FLOOR
+	if (++playNext == playEnd)
+		playNext = envelopes[playEnvelope].table;
+}
+#endif
+
+#if OUTPUT_MODE == OUTPUT_MODE_CHANNELS
+// Shows color c on every channel, all from the same PWM period on
+void colorShow(uint8_t c)
+{
+	uint16_t duty[PWM_CHANNELS];
+	uint8_t ch;
+
+	color = c;
+	for (ch = 0; ch < PWM_CHANNELS; ch++)
+		duty[ch] = colors[c][ch % 3];
+	pwmSetMany(0, PWM_CHANNELS, duty);
+}
+
+#if !HAL_PWMCH_IS_B
+// Interrupt subroutine
+// Called when the channel timer reaches CCR0, the end of a period, while duty cycles are staged
+#pragma vector = HAL_PWMCH_VECTOR
+__interrupt void Timer_Channels(void)
+{
+	pwmCommit();
+}
+#endif
+#endif
+
+#if OUTPUT_MODE == OUTPUT_MODE_BRIDGE
+// Stages a new high side duty cycle, BRIDGE_MIN to BRIDGE_MAX, for the next
+// turn. The low side follows it at BRIDGE_DEAD ticks. Call it from an ISR.
+void bridgeSet(uint16_t duty)
+{
+	bridgeDuty = duty;
+#if HAL_PWMCH_IS_B
+	HAL_PWMCH_TIMER(CCR1) = duty; // buffered, the group loads once both are written
+	HAL_PWMCH_TIMER(CCR2) = duty + BRIDGE_DEAD;
+#else
+	HAL_PWMCH_TIMER(CCTL0) = CCIE; // Timer_Bridge at the next top, also drops the stale flag
+#endif
+}
+
+#if !HAL_PWMCH_IS_B
+// Interrupt subroutine
+// Called when the bridge timer turns at the top while a duty cycle is staged
+#pragma vector = HAL_PWMCH_VECTOR
+__interrupt void Timer_Bridge(void)
+{
+	// Near the top the high side is off and the low side on, and both new
+	// compares are still ahead on the way down. Later, a compare the count has
+	// already passed would miss its toggle and turn that output over for the
+	// rest of the period, into the other one: wait for the next top instead.
+	if (HAL_PWMCH_TIMER(R) < BRIDGE_TOP - BRIDGE_MARGIN / 2)
+		return;
+	HAL_PWMCH_TIMER(CCR1) = bridgeDuty;
+	HAL_PWMCH_TIMER(CCR2) = bridgeDuty + BRIDGE_DEAD;
+	HAL_PWMCH_TIMER(CCTL0) = 0; // loaded, no more interrupts until the next bridgeSet()
+}
+#endif
+#endif
+
+#if !HAL_TIMER_IS_B && PLAYBACK_MODE == PLAYBACK_MODE_OFF && OUTPUT_MODE == OUTPUT_MODE_LED
+// Interrupt subroutine
+// Called when the PWM timer reaches CCR0, the end of a period, while a duty cycle is staged
+#pragma vector = PWM_TIMER_VECTOR
+__interrupt void Timer_Commit(void)
+{
+	uint16_t count;
+
+	PWM_TIMER(CCR1) = dutyStaged;
+	PWM_TIMER(CCTL0) = 0; // committed, no more interrupts until the next dutySet()
+
+	// The count restarts from 0 while this runs. A duty cycle shorter than that
+	// has already been passed and would leave the output set for one more whole
+	// period, so reset it now: the pulse ends late by the commit time instead.
+	count = PWM_TIMER(R);
+	if (count >= dutyStaged && count != pwmPeriod.ccr0) {
+		PWM_TIMER(CCTL1) = OUTMOD_0; // OUT = 0 drives the output low
+		PWM_TIMER(CCTL1) = OUTMOD_7; // holds it until CCR0 sets it
+	}
+}
+#endif
+
+#if TIMING_MODE == TIMING_MODE_WHEEL
+WheelTimer debounceTimer; // one-shot, the debounce interval after a press
+WheelTimer fadeTimer; // periodic while the duty cycle moves to dutyTarget
+WheelTimer flashTimer; // one-shot, turns the status LED off
+uint16_t dutyTarget = PWM_TICKS / 2;
+
+static uint16_t wheelTick; // button timer time in wheel ticks
+static uint16_t wheelCount; // button timer count of the last wheelClock(), in wheel ticks
+static uint16_t wheelRaw; // and in timer counts
+
+// Reads the button timer and brings wheelTick up to date. The wheel keeps a
+// timer armed within every wrap, so no wrap is lost while one is pending.
+static uint16_t wheelClock(void)
+{
+	uint16_t count;
+
+	wheelRaw = BUTTON_TIMER(R);
+	count = wheelRaw >> WHEEL_SHIFT;
+	wheelTick += (count - wheelCount) & (WHEEL_WRAP_TICKS - 1);
+	wheelCount = count;
+	return wheelTick;
+}
+
+// Programs CCR0 for the next tick that has a timer, or turns it off when none is armed
+static void wheelProgram(uint16_t now)
+{
+	uint16_t when, ccr;
+
+	if (!wheelNext(now, WHEEL_SLEEP, &when)) {
+		BUTTON_TIMER(CCTL0) = 0; // tickless: no wake-ups at all
+		return;
+	}
+	ccr = (uint16_t)((wheelCount + (when - now)) << WHEEL_SHIFT);
+	BUTTON_TIMER(CCR0) = ccr;
+	BUTTON_TIMER(CCTL0) = CCIE; // also drops a stale flag
+	if ((uint16_t)(BUTTON_TIMER(R) - wheelRaw) >= (uint16_t)(ccr - wheelRaw))
+		BUTTON_TIMER(CCTL0) |= CCIFG; // the count passed it while programming
+}
+
+// Starts the button timer free-running at SMCLK / 8
+void timerWheel(void)
+{
+	wheelInit(0);
+#if PERIOD_HAS_IDEX
+	BUTTON_TIMER(EX0) = 0; // no expansion divider
+#endif
+	BUTTON_TIMER(CTL) = HAL_TIMER_SMCLK + ID_3 + MC_2 + HAL_TIMER_CLR; // continuous mode
+}
+
+// Fade: moves the duty cycle one FADE_STEP towards dutyTarget
+static void fadeStep(WheelTimer *t)
+{
+	uint16_t duty = dutyStaged;
+
+	if (duty + FADE_STEP < dutyTarget)
+		duty += FADE_STEP;
+	else if (duty > dutyTarget + FADE_STEP)
+		duty -= FADE_STEP;
+	else {
+		duty = dutyTarget;
+		wheelCancel(t); // there, no more wake-ups
+	}
+	dutySet(duty);
+}
+
+static void flashDone(WheelTimer *t)
+{
+	STATUS_OUT &= ~STATUS_BIT; // turn off status LED
+}
+
+// Debounce interval over: the press counts
+static void debounceDone(WheelTimer *t)
+{
+	// Increment duty cycle, the fade gets there
+	if (dutyTarget < PWM_TICKS)
+		dutyTarget += PWM_STEP;
+	else dutyTarget = 0;
+	wheelArm(&fadeTimer, wheelTick, WHEEL_MS(FADE_MS), WHEEL_MS(FADE_MS), fadeStep);
+
+	HAL_BTN_IE |= HAL_BTN_BIT; // Reenable interrupts
+}
+
+// Button pin handler, run by PORT_Button
+// Called whenever button is pressed
+static void buttonEdge(void)
+{
+	uint16_t now = wheelClock();
+
+	wheelArm(&debounceTimer, now, WHEEL_MS(1000 / DEBOUNCE_HZ), 0, debounceDone);
+	wheelArm(&flashTimer, now, WHEEL_MS(FLASH_MS), 0, flashDone);
+	wheelProgram(now);
+
+    HAL_BTN_IES &= ~HAL_BTN_BIT;  // Disable interrupt by toggling edge, the dispatch cleared the flag
+	
+	STATUS_OUT |= STATUS_BIT; // turn on status LED
+}
+
+// Interrupt subroutine
+// Called when CCR0 reaches the next tick that has a timer
+#pragma vector = BUTTON_TIMER_VECTOR
+__interrupt void Timer_Wheel(void)
+{
+	uint16_t now = wheelClock();
+
+	wheelExpire(now); // runs the callbacks
+	wheelProgram(now);
+}
+#elif BUTTON_MODE == BUTTON_MODE_GESTURE
+// Runs in Timer_Button for every gesture of the button
+// Click: one step up, back to 0 after full. Double-click: one step down.
+// Long press: start ramping to full, or to 0 from half and above. Repeat: one more
+// step of that ramp, until it reaches the end; it stays there until the release.
+void gestureAction(uint8_t gesture)
+{
+	uint16_t duty = dutyStaged;
+
+	switch (gesture) {
+	case GESTURE_CLICK:
+		duty = duty < PWM_TICKS ? duty + PWM_STEP : 0;
+		break;
+	case GESTURE_DOUBLE:
+		duty = duty > PWM_STEP ? duty - PWM_STEP : 0;
+		break;
+	case GESTURE_LONG:
+		rampDown = duty >= PWM_TICKS / 2;
+		// fall through: the long press is the first step of the ramp
+	case GESTURE_REPEAT:
+		if (rampDown && duty > 0)
+			duty = duty > PWM_STEP ? duty - PWM_STEP : 0;
+		else if (!rampDown && duty < PWM_TICKS)
+			duty += PWM_STEP;
+		else
+			return; // at the end of the ramp, nothing changes
+		break;
+	default:
+		return;
+	}
+	dutySet(duty); // from the next PWM period on
+}
+
+// Button pin handler, run by PORT_Button
+// Called on a press or a release edge
+static void buttonEdge(void)
+{
+	// The clear restarts a tick that is under way, so the edge is confirmed one
+	// whole debounce interval from now. The bounce cannot restart it again.
+	BUTTON_TIMER(CTL) = debouncePeriod.ctl + MC_1 + HAL_TIMER_CLR;
+	HAL_BTN_IE &= ~HAL_BTN_BIT; // Ignore the bounce until then, the dispatch cleared the flag
+
+	STATUS_OUT |= STATUS_BIT; // turn on status LED
+}
+
+// Interrupt subroutine
+// Called when the button timer reaches CCR0: the end of a debounce interval, or a
+// tick while the gesture recognizer waits for its deadline
+#pragma vector = BUTTON_VECTOR
+__interrupt void Timer_Button(void)
+{
+	int pressed;
+
+	buttonTicks++;
+	if (!(HAL_BTN_IE & HAL_BTN_BIT)) {
+		STATUS_OUT &= ~STATUS_BIT; // turn off status LED
+
+		// The level after the bounce is the new state, an edge back to the old one was a glitch
+		pressed = (HAL_BTN_IN & HAL_BTN_BIT) ? 0 : 1;
+		if (pressed != buttonState) {
+			buttonState = pressed;
+			gestureAction(gestureInput(&button, pressed ? EVENT_PRESS : EVENT_RELEASE, buttonTicks));
+		}
+
+		// Arm the opposite edge, then drop the flags the bounce and the IES change left
+		if (buttonState)
+			HAL_BTN_IES &= ~HAL_BTN_BIT; // Next edge: release, LO to HI
+		else
+			HAL_BTN_IES |= HAL_BTN_BIT; // Next edge: press, HI to LO
+		HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear flag
+		if (((HAL_BTN_IN & HAL_BTN_BIT) ? 0 : 1) != buttonState)
+			HAL_BTN_IFG |= HAL_BTN_BIT; // Moved again while re-arming, PORT_Button runs next
+		HAL_BTN_IE |= HAL_BTN_BIT; // Reenable interrupts
+	}
+
+	// A deadline that is due completes its gesture, one not yet due is ignored
+	if (gestureWaiting(&button)) {
+		gestureAction(gestureInput(&button, EVENT_PERIOD, buttonTicks));
+		if (gestureWaiting(&button))
+			return; // keep ticking
+	}
+	BUTTON_TIMER(CTL) &= ~MC_3; // Stop timer, nothing is due until the next edge
+	BUTTON_TIMER(CTL) |= HAL_TIMER_CLR; // Clear Timer
+}
+#else
+// Button pin handler, run by PORT_Button
+// Called whenever button is pressed
+static void buttonEdge(void)
+{
+#if TIMING_MODE == TIMING_MODE_WDT
+	wdtLeft = debounceWdt.intervals;
+	wdtStart(&debounceWdt); // Begin the delay right away, from a cleared watchdog count
+#elif CAPTURE_MODE != CAPTURE_MODE_OFF
+	// The button timer keeps running for capture, the interval ends a debounce period from now
+	BUTTON_TIMER(CCR0) = BUTTON_TIMER(R) + capturePeriod.ccr0 + 1;
+	BUTTON_TIMER(CCTL0) = CCIE; // also drops a stale flag
+#else
+
+    // BUTTON_TIMER(CTL) = the timer that is not driving the PWM pin
+    // debouncePeriod.ctl selects the clock source and ID divider
+    // MC_1 Count-up mode
+	// No clear: the stop cleared the count, and a bounce edge must not restart the interval
+	BUTTON_TIMER(CTL) = debouncePeriod.ctl + MC_1; // Begin timer right away
+#endif
+	
+    HAL_BTN_IES &= ~HAL_BTN_BIT;  // Disable interrupt by toggling edge, the dispatch cleared the flag
+	
+	STATUS_OUT |= STATUS_BIT; // turn on status LED
+
+}
+
+// Interrupt subroutine
+// Called when the button timer reaches CCR0, or at every watchdog interval
+#pragma vector = BUTTON_VECTOR
+__interrupt void Timer_Button(void)
+{
+#if TIMING_MODE == TIMING_MODE_WDT
+	if (--wdtLeft)
+		return; // Delay not over yet
+#endif
+	STATUS_OUT &= ~STATUS_BIT; // turn off status LED
+
+#if PLAYBACK_MODE != PLAYBACK_MODE_OFF
+	playSelect(playEnvelope + 1 < ENVELOPES ? playEnvelope + 1 : 0); // next envelope
+#elif OUTPUT_MODE == OUTPUT_MODE_CHANNELS
+	colorShow(color + 1 < COLORS ? color + 1 : 0); // next color, every channel in the same period
+#elif OUTPUT_MODE == OUTPUT_MODE_BRIDGE
+	bridgeSet(bridgeDuty + BRIDGE_STEP <= BRIDGE_MAX ? bridgeDuty + BRIDGE_STEP : BRIDGE_MIN); // 10 % more, or back to the least
+#else
+	// Increment duty cycle, from the next PWM period on
+	if (dutyStaged < PWM_TICKS) {
+		dutySet(dutyStaged + PWM_STEP);
+		}
+	else dutySet(0);
+#endif
+
+	HAL_BTN_IE |= HAL_BTN_BIT; // Reenable interrupts
+#if TIMING_MODE == TIMING_MODE_WDT
+	wdtStop(); // Hold the watchdog
+#elif CAPTURE_MODE != CAPTURE_MODE_OFF
+	BUTTON_TIMER(CCTL0) = 0; // interval over, the timer runs on for capture
+#else
+	BUTTON_TIMER(CTL) &= ~MC_3; // Stop timer
+	BUTTON_TIMER(CTL) |= HAL_TIMER_CLR; // Clear Timer
+#endif
+	
+}
+#endif
+
+// Handlers of the button port's pins, more buttons or encoder lines on the port add theirs
+static const PortHandler buttonPins[8] = { [HAL_BTN_PIN] = buttonEdge };
+
+// Interrupt subroutine
+// Called while a pin of the button port is pending, one pin per call (see Common/portirq.h)
+#pragma vector = HAL_BTN_VECTOR
+__interrupt void PORT_Button(void)
+{
+	PORT_DISPATCH(HAL_BTN_PORT, buttonPins);
+}
+
+#if CAPTURE_MODE != CAPTURE_MODE_OFF
+// Interrupt subroutine
+// Called on every edge at the capture pin and every wrap of the capture timer
+#pragma vector = HAL_CAP_VECTOR
+__interrupt void Timer_Capture(void)
+{
+	if (captureIrq())
+		__bic_SR_register_on_exit(LPM0_bits); // a full window: wake main() to read it
+}
+#endif
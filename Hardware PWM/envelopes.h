@@ -0,0 +1,56 @@
+// Generated by gen_envelopes.py --top 1000 --breathe 128 --beat 64 --ramp 64 --gamma 2.2
+// Do not edit by hand, rerun the generator instead.
+
+#ifndef ENVELOPES_H
+#define ENVELOPES_H
+
+#include <stdint.h>
+
+#define ENVELOPE_TOP 1000
+
+#ifndef ENVELOPE
+#error "define ENVELOPE(value) before including envelopes.h"
+#endif
+
+static const uint16_t envelopeBreathe[128] = {
+    ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0),
+    ENVELOPE(1), ENVELOPE(1), ENVELOPE(2), ENVELOPE(3), ENVELOPE(4), ENVELOPE(6), ENVELOPE(8), ENVELOPE(11),
+    ENVELOPE(15), ENVELOPE(19), ENVELOPE(24), ENVELOPE(30), ENVELOPE(37), ENVELOPE(44), ENVELOPE(54), ENVELOPE(64),
+    ENVELOPE(75), ENVELOPE(88), ENVELOPE(102), ENVELOPE(118), ENVELOPE(135), ENVELOPE(154), ENVELOPE(173), ENVELOPE(195),
+    ENVELOPE(218), ENVELOPE(242), ENVELOPE(267), ENVELOPE(294), ENVELOPE(322), ENVELOPE(351), ENVELOPE(381), ENVELOPE(412),
+    ENVELOPE(444), ENVELOPE(476), ENVELOPE(509), ENVELOPE(542), ENVELOPE(575), ENVELOPE(608), ENVELOPE(641), ENVELOPE(674),
+    ENVELOPE(706), ENVELOPE(737), ENVELOPE(767), ENVELOPE(796), ENVELOPE(824), ENVELOPE(850), ENVELOPE(875), ENVELOPE(897),
+    ENVELOPE(918), ENVELOPE(937), ENVELOPE(953), ENVELOPE(967), ENVELOPE(979), ENVELOPE(988), ENVELOPE(995), ENVELOPE(999),
+    ENVELOPE(1000), ENVELOPE(999), ENVELOPE(995), ENVELOPE(988), ENVELOPE(979), ENVELOPE(967), ENVELOPE(953), ENVELOPE(937),
+    ENVELOPE(918), ENVELOPE(897), ENVELOPE(875), ENVELOPE(850), ENVELOPE(824), ENVELOPE(796), ENVELOPE(767), ENVELOPE(737),
+    ENVELOPE(706), ENVELOPE(674), ENVELOPE(641), ENVELOPE(608), ENVELOPE(575), ENVELOPE(542), ENVELOPE(509), ENVELOPE(476),
+    ENVELOPE(444), ENVELOPE(412), ENVELOPE(381), ENVELOPE(351), ENVELOPE(322), ENVELOPE(294), ENVELOPE(267), ENVELOPE(242),
+    ENVELOPE(218), ENVELOPE(195), ENVELOPE(173), ENVELOPE(154), ENVELOPE(135), ENVELOPE(118), ENVELOPE(102), ENVELOPE(88),
+    ENVELOPE(75), ENVELOPE(64), ENVELOPE(54), ENVELOPE(44), ENVELOPE(37), ENVELOPE(30), ENVELOPE(24), ENVELOPE(19),
+    ENVELOPE(15), ENVELOPE(11), ENVELOPE(8), ENVELOPE(6), ENVELOPE(4), ENVELOPE(3), ENVELOPE(2), ENVELOPE(1),
+    ENVELOPE(1), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0)
+};
+
+static const uint16_t envelopeHeartbeat[64] = {
+    ENVELOPE(0), ENVELOPE(1), ENVELOPE(14), ENVELOPE(139), ENVELOPE(577), ENVELOPE(994), ENVELOPE(712), ENVELOPE(212),
+    ENVELOPE(27), ENVELOPE(2), ENVELOPE(0), ENVELOPE(2), ENVELOPE(16), ENVELOPE(74), ENVELOPE(199), ENVELOPE(314),
+    ENVELOPE(292), ENVELOPE(159), ENVELOPE(51), ENVELOPE(10), ENVELOPE(1), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0),
+    ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0),
+    ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0),
+    ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0),
+    ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0),
+    ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0), ENVELOPE(0)
+};
+
+static const uint16_t envelopeRamp[64] = {
+    ENVELOPE(0), ENVELOPE(0), ENVELOPE(1), ENVELOPE(1), ENVELOPE(2), ENVELOPE(4), ENVELOPE(6), ENVELOPE(8),
+    ENVELOPE(11), ENVELOPE(14), ENVELOPE(17), ENVELOPE(22), ENVELOPE(26), ENVELOPE(31), ENVELOPE(37), ENVELOPE(43),
+    ENVELOPE(49), ENVELOPE(56), ENVELOPE(64), ENVELOPE(72), ENVELOPE(80), ENVELOPE(89), ENVELOPE(99), ENVELOPE(109),
+    ENVELOPE(120), ENVELOPE(131), ENVELOPE(143), ENVELOPE(155), ENVELOPE(168), ENVELOPE(181), ENVELOPE(195), ENVELOPE(210),
+    ENVELOPE(225), ENVELOPE(241), ENVELOPE(257), ENVELOPE(274), ENVELOPE(292), ENVELOPE(310), ENVELOPE(329), ENVELOPE(348),
+    ENVELOPE(368), ENVELOPE(389), ENVELOPE(410), ENVELOPE(432), ENVELOPE(454), ENVELOPE(477), ENVELOPE(501), ENVELOPE(525),
+    ENVELOPE(550), ENVELOPE(575), ENVELOPE(601), ENVELOPE(628), ENVELOPE(656), ENVELOPE(684), ENVELOPE(712), ENVELOPE(742),
+    ENVELOPE(772), ENVELOPE(802), ENVELOPE(834), ENVELOPE(866), ENVELOPE(898), ENVELOPE(931), ENVELOPE(965), ENVELOPE(1000)
+};
+
+#endif
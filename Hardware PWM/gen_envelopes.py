@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Generates the duty-cycle envelopes in envelopes.h for the playback modes.
+
+An envelope is one table entry per playback step, from 0 (darkest) to
+--top (brightest), after a gamma correction so equal steps of the shape look
+like equal steps of brightness. The entries are written as ENVELOPE(value),
+which the program defines before including the header to scale them to its
+PWM timer ticks, so one header serves every clock rate.
+
+Envelopes:
+  Breathe    a raised cosine, dark to full and back
+  Heartbeat  a strong and a weaker beat, then rest
+  Ramp       dark to full, then straight back to dark
+
+Run from the Hardware PWM directory, for example:
+  python3 gen_envelopes.py --breathe 128 --beat 64 --ramp 64 > envelopes.h
+"""
+
+import argparse
+import math
+
+
+def breathe(x):
+    return (1.0 - math.cos(2.0 * math.pi * x)) / 2.0
+
+
+def heartbeat(x):
+    def beat(centre, width, height):
+        return height * math.exp(-((x - centre) / width) ** 2)
+    return min(1.0, beat(0.08, 0.035, 1.0) + beat(0.24, 0.045, 0.6))
+
+
+def ramp(x):
+    return x
+
+
+def table(shape, steps, top, gamma, closed):
+    # closed: the last entry is the end of the shape, not one step before it
+    span = steps - 1 if closed else steps
+    return [int(round(shape(i / span) ** gamma * top)) for i in range(steps)]
+
+
+def emit(name, values):
+    lines = ["static const uint16_t envelope%s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), 8):
+        row = ", ".join("ENVELOPE(%d)" % v for v in values[i:i + 8])
+        lines.append("    " + row + ("," if i + 8 < len(values) else ""))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--top", type=int, default=1000, help="value of full brightness")
+    parser.add_argument("--breathe", type=int, default=128, help="steps of the Breathe envelope")
+    parser.add_argument("--beat", type=int, default=64, help="steps of the Heartbeat envelope")
+    parser.add_argument("--ramp", type=int, default=64, help="steps of the Ramp envelope")
+    parser.add_argument("--gamma", type=float, default=2.2)
+    args = parser.parse_args()
+
+    print("// Generated by gen_envelopes.py --top %d --breathe %d --beat %d --ramp %d --gamma %g"
+          % (args.top, args.breathe, args.beat, args.ramp, args.gamma))
+    print("// Do not edit by hand, rerun the generator instead.")
+    print()
+    print("#ifndef ENVELOPES_H")
+    print("#define ENVELOPES_H")
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("#define ENVELOPE_TOP %d" % args.top)
+    print()
+    print("#ifndef ENVELOPE")
+    print('#error "define ENVELOPE(value) before including envelopes.h"')
+    print("#endif")
+    for name, shape, steps, closed in (("Breathe", breathe, args.breathe, False),
+                                       ("Heartbeat", heartbeat, args.beat, False),
+                                       ("Ramp", ramp, args.ramp, True)):
+        if steps < 2:
+            parser.error("an envelope needs at least 2 steps")
+        print()
+        print(emit(name, table(shape, steps, args.top, args.gamma, closed)))
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""Replays switch bounce into the Debouncing program and scores the result.
+
+Every board program is built for the simulator once per debounce delay
+(DEBOUNCE_HZ) and then fed a set of button traces. Synthetic traces vary
+one thing at a time:
+
+  bounce  contact chatter after each press and release edge, 0-15 ms
+  glitch  one isolated low pulse between presses, 20 us-8 ms wide
+  rate    presses per second, 2-15
+
+Recorded traces can be added with --recorded: a CSV of time in seconds and
+pin level (0/1) per line, as exported by a logic analyzer. A level that
+holds for --truth-settle (default 20 ms) is taken as the true button state,
+and each press starts at the first edge of the burst that led to it.
+
+The action of the program is a toggle of LED1 (P1.0 on every board). Each
+press owns the time from its first edge to the next press or glitch. A press
+with no toggle in that window is missed, every further toggle is a false
+trigger, and so is any toggle in the window of a glitch. Latency is taken
+from the first press edge (press-to-action) and from the first release edge
+(release-to-action) to the toggle that scores the press.
+
+From the repository root:
+  python3 Simulator/bounce_bench.py
+  python3 Simulator/bounce_bench.py --boards MSP430G2553 --delays 5,10 --detail
+  python3 Simulator/bounce_bench.py --recorded scope.csv -D SOME_OPTION=1
+"""
+
+import argparse
+import csv
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import run  # noqa: E402
+
+BUTTONS = {"MSP430G2553": "P1.3", "MSP430F5529": "P1.1", "MSP430FR2311": "P1.1",
+           "MSP430FR5994": "P5.5", "MSP430FR6989": "P1.1"}
+LED = "P1.0"
+PRESSES = 20 # per synthetic trace
+LEAD_IN = 0.05 # seconds before the first press, after the program set up the port
+
+
+class Trace:
+    """Pin drive plus the ground truth it is scored against"""
+
+    def __init__(self, name):
+        self.name = name
+        self.edges = [] # (seconds, "0" or "z")
+        self.events = [] # (kind, first edge, release edge or None), in time order
+        self.end = 0.0
+
+
+def chatter(trace, t, level, bounce, rng):
+    # Contact bounce: the edge to `level`, then bounces back and forth for
+    # `bounce` seconds, ending on `level`
+    other = "z" if level == "0" else "0"
+    edges = [(t, level)]
+    now, current = t + rng.uniform(20e-6, 500e-6), other
+    while now < t + bounce:
+        edges.append((now, current))
+        current = other if current == level else level
+        now += rng.uniform(20e-6, 500e-6)
+    if edges[-1][1] != level:
+        edges.append((t + bounce, level))
+    trace.edges += edges
+
+
+def synthetic(name, bounce, glitch, rate, seed):
+    rng = random.Random(seed)
+    trace = Trace(name)
+    period = 1.0 / rate
+    hold = 0.4 * period
+    for n in range(PRESSES):
+        t = LEAD_IN + n * period
+        chatter(trace, t, "0", bounce, rng)
+        chatter(trace, t + hold, "z", bounce, rng)
+        trace.events.append(("press", t, t + hold))
+        if glitch:
+            # Somewhere in the released part of the period, clear of the bounce
+            g = t + hold + bounce + rng.uniform(0.3, 0.7) * (period - hold - bounce - glitch)
+            trace.edges += [(g, "0"), (g + glitch, "z")]
+            trace.events.append(("glitch", g, None))
+    trace.end = LEAD_IN + PRESSES * period + 0.2
+    trace.edges.sort(key=lambda e: e[0])
+    return trace
+
+
+def synthetic_suite():
+    suite = []
+    for ms in (0, 0.5, 2, 5, 15):
+        suite.append(synthetic("bounce %gms" % ms, ms / 1e3, 0, 2, len(suite)))
+    for us in (20, 200, 2000, 8000):
+        suite.append(synthetic("glitch %gus" % us, 1e-3, us / 1e6, 2, len(suite)))
+    for rate in (4, 8, 15):
+        suite.append(synthetic("rate %d/s" % rate, 1e-3, 0, rate, len(suite)))
+    return suite
+
+
+def recorded(path, settle):
+    samples = []
+    with open(path) as f:
+        for row in csv.reader(f):
+            try:
+                samples.append((float(row[0]), int(float(row[1]))))
+            except (ValueError, IndexError):
+                continue # header or blank line
+    if not samples:
+        sys.exit("bounce_bench.py: no samples in " + path)
+    t0 = samples[0][0]
+    trace = Trace(os.path.basename(path))
+    # Edges, shifted so the first sample lands after the program's setup
+    last = None
+    for t, level in samples:
+        if level != last:
+            trace.edges.append((t - t0 + LEAD_IN, "z" if level else "0"))
+            last = level
+    # Ground truth: a level that holds for `settle` is the button state;
+    # the state change is dated to the first edge after the previous stable level
+    state, burst, press = 1, None, None
+    for i, (t, level) in enumerate(trace.edges):
+        value = 1 if level == "z" else 0
+        hold = (trace.edges[i + 1][0] if i + 1 < len(trace.edges) else float("inf")) - t
+        if value != state and burst is None:
+            burst = t
+        if hold >= settle and burst is not None:
+            if value != state:
+                if value == 0:
+                    press = burst
+                elif press is not None:
+                    trace.events.append(("press", press, burst))
+                    press = None
+                state = value
+            burst = None
+    if press is not None:
+        trace.events.append(("press", press, None))
+    trace.end = trace.edges[-1][0] + 0.2
+    return trace
+
+
+def simulate(binary, board, trace, workdir):
+    stimulus = os.path.join(workdir, "stimulus.txt")
+    with open(stimulus, "w") as f:
+        for t, level in trace.edges:
+            f.write("%.9fs %s %s\n" % (t, BUTTONS[board], level))
+    csv_path = os.path.join(workdir, "trace.csv")
+    out = subprocess.run([binary, "--until", "%.6fs" % trace.end, "--stimulus", stimulus,
+                          "--trace", csv_path], capture_output=True, text=True)
+    if out.returncode:
+        sys.exit("bounce_bench.py: simulator failed on %s\n%s%s" % (trace.name, out.stdout, out.stderr))
+    hz = float(out.stdout.split(" at ")[1].split(" Hz")[0])
+    toggles = []
+    with open(csv_path) as f:
+        next(f)
+        for cycle, signal, _ in csv.reader(f):
+            if signal == LED:
+                toggles.append(int(cycle) / hz)
+    return toggles
+
+
+def score(trace, toggles):
+    result = {"presses": 0, "missed": 0, "false": 0, "press_lat": [], "release_lat": []}
+    starts = [e[1] for e in trace.events] + [float("inf")]
+    toggles = sorted(toggles)
+    result["false"] += sum(1 for t in toggles if t < starts[0])
+    for i, (kind, start, release) in enumerate(trace.events):
+        hits = [t for t in toggles if start <= t < starts[i + 1]]
+        if kind == "glitch":
+            result["false"] += len(hits)
+            continue
+        result["presses"] += 1
+        if not hits:
+            result["missed"] += 1
+            continue
+        result["false"] += len(hits) - 1
+        result["press_lat"].append(hits[0] - start)
+        if release is not None and hits[0] >= release:
+            result["release_lat"].append(hits[0] - release)
+    return result
+
+
+def merge(results):
+    total = {"presses": 0, "missed": 0, "false": 0, "press_lat": [], "release_lat": []}
+    for r in results:
+        for key in total:
+            total[key] += r[key]
+    return total
+
+
+def ms(values, f):
+    return "%.2f" % (f(values) * 1e3) if values else "-"
+
+
+def mean(values):
+    return sum(values) / len(values)
+
+
+def row(label, r):
+    return "| %s | %d | %d | %d | %s | %s | %s |" % (
+        label, r["presses"], r["missed"], r["false"],
+        ms(r["press_lat"], mean), ms(r["press_lat"], max), ms(r["release_lat"], mean))
+
+
+HEADER = ("| %s | Presses | Missed | False triggers | Press-to-action mean ms | max ms "
+          "| Release-to-action mean ms |\n|---|---|---|---|---|---|---|")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--boards", default=",".join(run.BOARDS))
+    parser.add_argument("--delays", default="2,5,10,20,50", help="debounce delays in ms")
+    parser.add_argument("--source", default="Debouncing/{board}/blink.c")
+    parser.add_argument("--recorded", action="append", default=[], help="CSV of seconds,level")
+    parser.add_argument("--truth-settle", type=float, default=20, help="ms, for recorded traces")
+    parser.add_argument("--no-synthetic", action="store_true")
+    parser.add_argument("--detail", action="store_true", help="one row per trace")
+    parser.add_argument("-D", dest="defines", action="append", default=[], help="program #define")
+    parser.add_argument("--cc", default="gcc")
+    args = parser.parse_args()
+
+    traces = [] if args.no_synthetic else synthetic_suite()
+    traces += [recorded(p, args.truth_settle / 1e3) for p in args.recorded]
+    delays = [float(d) for d in args.delays.split(",")]
+    for d in delays:
+        if 1000 % d:
+            sys.exit("bounce_bench.py: a delay must divide 1000 ms (DEBOUNCE_HZ is an integer)")
+
+    for board in args.boards.split(","):
+        print("### %s\n" % board)
+        print(HEADER % "Delay")
+        best = None
+        details = []
+        for delay in delays:
+            with tempfile.TemporaryDirectory(prefix="bounce_") as workdir:
+                defines = args.defines + ["DEBOUNCE_HZ=%d" % (1000 // delay)]
+                binary = run.build(args.cc, args.source.format(board=board), board, defines, workdir)
+                results = [score(t, simulate(binary, board, t, workdir)) for t in traces]
+            total = merge(results)
+            print(row("%g ms" % delay, total))
+            if best is None and not total["missed"] and not total["false"]:
+                best = delay
+            details += [row("%g ms, %s" % (delay, t.name), r) for t, r in zip(traces, results)]
+        print()
+        print("Shortest clean delay: %s\n" % ("%g ms" % best if best is not None else "none"))
+        if args.detail:
+            print(HEADER % "Delay, trace")
+            print("\n".join(details))
+            print()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
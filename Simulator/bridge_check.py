@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Checks the Hardware PWM bridge outputs for shoot-through and centring.
+
+Every board with two channel outputs builds the Hardware PWM program with
+OUTPUT_MODE_BRIDGE, presses its button so the high side steps through its
+whole duty cycle range and wraps, and runs the simulator with --exclusive on
+the pair, which fails the run if both sides are ever on together or one comes
+on less than --dead after the other went off. From the trace it also reports:
+
+  dead     the shortest and longest time both sides are off between them,
+           for the high side going off and for the low side going off
+  centred  the largest spread of the pulse centres within one period, over
+           the pulses of each side that keep the width of the pulse before:
+           center-aligned pulses grow and shrink about a fixed point
+
+From the repository root:
+  python3 Simulator/bridge_check.py
+  python3 Simulator/bridge_check.py -D BRIDGE_DEAD=0   # fails: no dead time
+The exit code is 1 when any board shows shoot-through, short dead time or
+off-centre pulses.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+from collections import Counter
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import run  # noqa: E402
+from bounce_bench import BUTTONS  # noqa: E402
+from runt_check import edges, presses  # noqa: E402
+
+# High and low side: channels 1 and 2 of HAL_PWMCH_TIMER in Common/hal.h
+BRIDGES = {"MSP430F5529": ("TA0.1", "TA0.2"), "MSP430FR2311": ("TB1.1", "TB1.2"),
+           "MSP430FR5994": ("TB0.1", "TB0.2")}
+
+
+def pulses(found):
+    """(rise, fall) of each complete high pulse"""
+    return [(a[0], b[0]) for a, b in zip(found, found[1:]) if a[1] == 1 and b[1] == 0]
+
+
+def gaps(falls, rises):
+    """Time from each fall of one side to the next rise of the other"""
+    found, j = [], 0
+    for fall in falls:
+        while j < len(rises) and rises[j] < fall:
+            j += 1
+        if j < len(rises):
+            found.append(rises[j] - fall)
+    return found
+
+
+def centring(found, tolerance):
+    """Largest spread of the centres, within one period, of same-width pulses"""
+    spans = pulses(found)
+    if len(spans) < 3:
+        return 0
+    period = Counter(b[0] - a[0] for a, b in zip(spans, spans[1:])).most_common(1)[0][0]
+    centres = [((a + b) / 2.0 - spans[0][0]) % period
+               for (pa, pb), (a, b) in zip(spans, spans[1:]) if abs((b - a) - (pb - pa)) <= tolerance]
+    # The centres sit near one point, unwrap them around the first
+    ref = centres[0]
+    offsets = [(c - ref + period / 2.0) % period - period / 2.0 for c in centres]
+    return max(offsets) - min(offsets)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--boards", default=",".join(BRIDGES))
+    parser.add_argument("--dead", type=float, default=1.0, help="least dead time in us (BRIDGE_DEAD)")
+    parser.add_argument("--tolerance", type=float, default=0.1, help="centre slack in us")
+    parser.add_argument("-D", dest="defines", action="append", default=[], help="program #define")
+    parser.add_argument("--cc", default="gcc")
+    args = parser.parse_args()
+
+    # Eleven steps go through the range and wrap to its bottom, then two more
+    button = presses(0.02, 0.04, 0.02, 13)
+    until = 0.6
+    print("| Board | Pulses | Overlaps | Dead us, high off | Dead us, low off | Centre spread us | Result |")
+    print("|---|---|---|---|---|---|---|")
+    failed = 0
+    for board in args.boards.split(","):
+        high, low = BRIDGES[board]
+        with tempfile.TemporaryDirectory(prefix="bridge_") as workdir:
+            binary = run.build(args.cc, "Hardware PWM/%s/blink.c" % board, board,
+                               args.defines + ["OUTPUT_MODE=2"], workdir)
+            stimulus = os.path.join(workdir, "stimulus.txt")
+            with open(stimulus, "w") as f:
+                for start, length in button:
+                    f.write("%.6fs %s 0\n%.6fs %s z\n" % (start, BUTTONS[board], start + length, BUTTONS[board]))
+            csv_path = os.path.join(workdir, "trace.csv")
+            out = subprocess.run([binary, "--until", "%gs" % until, "--stimulus", stimulus,
+                                  "--trace", csv_path, "--exclusive", "%s,%s@%gus" % (high, low, args.dead)],
+                                 capture_output=True, text=True)
+            if out.returncode not in (0, 1):
+                sys.exit("bridge_check.py: simulator failed\n%s%s" % (out.stdout, out.stderr))
+            hz = float(out.stdout.split(" at ")[1].split(" Hz")[0])
+            report = [line for line in out.stdout.splitlines() if line.startswith(high + "/")][0]
+            overlaps = int(report.split(": ")[1].split(" ")[0])
+            found = {side: edges(csv_path, side) for side in (high, low)}
+        us = 1e6 / hz
+        falls = {side: [c for c, v in found[side] if v == 0] for side in found}
+        rises = {side: [c for c, v in found[side] if v == 1] for side in found}
+        dead_high = gaps(falls[high], rises[low])
+        dead_low = gaps(falls[low], rises[high])
+        spread = max(centring(found[side], args.tolerance * hz / 1e6) for side in found)
+        bad = out.returncode or spread * us > args.tolerance or not dead_high or not dead_low
+        failed += bool(bad)
+        print("| %s | %d | %d | %.2f-%.2f | %.2f-%.2f | %.3f | %s |" % (
+            board, len(pulses(found[high])), overlaps,
+            min(dead_high or [0]) * us, max(dead_high or [0]) * us,
+            min(dead_low or [0]) * us, max(dead_low or [0]) * us,
+            spread * us, "SHOOT-THROUGH" if out.returncode else "off-centre" if bad else "ok"))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
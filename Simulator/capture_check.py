@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""Checks the Hardware PWM capture analyzer against the signals it measures.
+
+Every case builds the Hardware PWM program with CAPTURE_MODE_LOOPBACK, runs it
+long enough for a few CAPTURE_WINDOW windows and reads back the last result
+with --dump captureResult (see Common/capture.h):
+
+  loopback  --wire connects the board's own PWM output to its capture pin, and
+            0-4 button presses step the duty cycle from 50 % by 10 % each: the
+            measured period must match the PWM timer's, and the duty cycle its
+            CCR1 + 1 ticks of high time (OUTMOD_7 sets the output at CCR0) to
+            within one capture timer tick
+  jitter    a stimulus file drives the capture pin with a 5 kHz, 30 % signal
+            whose edges move by up to +-2 us: the mean and the period spread
+            must match the generated edges
+  slow      a 20 Hz, 25 % stimulus, whose period of 200000 timer ticks needs
+            the 32-bit overflow extension
+  1 MHz     the loopback case on the G2553 at CLOCK_MHZ=1, where a 10 kHz
+            edge comes every 50 CPU cycles: the ISR must keep up, missed = 0,
+            and at one timer tick per CPU cycle the duty cycle is exact
+
+From the repository root:
+  python3 Simulator/capture_check.py
+The exit code is 1 when any case measures off or misses edges. The ISR cycles
+are the simulator's estimate, a lower bound (see sim.h).
+"""
+
+import argparse
+import os
+import random
+import re
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import run  # noqa: E402
+from bounce_bench import BUTTONS  # noqa: E402
+
+# PWM output and capture pin of each board, HAL_CAP_TIMER's CCI1A in Common/hal.h
+LOOPBACK = {"MSP430G2553": ("TA0.1", "P2.1"), "MSP430F5529": ("TA0.1", "P2.0"),
+            "MSP430FR2311": ("TB1.1", "P1.6"), "MSP430FR5994": ("TA0.1", "P1.2"),
+            "MSP430FR6989": ("TA0.1", "P1.2")}
+PWM_HZ = 10000
+DEBOUNCE_HZ = 100
+WORDS = 52 # sizeof(CaptureResult) / 2
+
+
+def result(words):
+    """CaptureResult from its 16-bit words"""
+    def stats(w):
+        return {"min": w[0] | w[1] << 16, "max": w[2] | w[3] << 16,
+                "mean": (w[4] | w[5] << 16) / 16.0, "outliers": w[23]}
+    return dict(period=stats(words[0:24]), high=stats(words[24:48]), periods=words[48],
+                duty=words[49] / 10.0, jitter=words[50], missed=words[51])
+
+
+def simulate(binary, until, workdir, stimulus=None, wire=None):
+    """(clock Hz, CaptureResult, estimated Timer_Capture cycles max) of one run"""
+    cmd = [binary, "--until", "%gs" % until, "--dump", "captureResult:%d" % WORDS]
+    if stimulus:
+        path = os.path.join(workdir, "stimulus.txt")
+        with open(path, "w") as f:
+            f.write("".join("%.7fs %s %s\n" % line for line in stimulus))
+        cmd += ["--stimulus", path]
+    if wire:
+        cmd += ["--wire", wire]
+    out = subprocess.run(cmd, capture_output=True, text=True)
+    if out.returncode:
+        sys.exit("capture_check.py: simulator failed\n%s%s" % (out.stdout, out.stderr))
+    hz = float(out.stdout.split(" at ")[1].split(" Hz")[0])
+    words = [int(w) for w in out.stdout.split("captureResult: ")[1].split()]
+    isr = re.search(r"^Timer_Capture\s+\d+\s+\d+\s+[\d.]+\s+(\d+)", out.stdout, re.M)
+    return hz, result(words), int(isr.group(1))
+
+
+def timer_hz(hz):
+    """Capture timer clock: SMCLK through CAPTURE_ID of Hardware PWM/blink.c"""
+    cycles = int(hz) // DEBOUNCE_HZ
+    return hz / (1 if cycles <= 0x10000 else 2 if cycles <= 0x20000 else 4 if cycles <= 0x40000 else 8)
+
+
+def signal(pin, hz, duty, seconds, jitter, seed=1):
+    """Stimulus lines and the periods in seconds of a jittered square wave"""
+    rnd = random.Random(seed)
+    lines, rises = [], []
+    for n in range(int(seconds * hz)):
+        start = 1e-3 + n / float(hz)
+        rise = start + rnd.uniform(-jitter, jitter)
+        fall = start + duty / float(hz) + rnd.uniform(-jitter, jitter)
+        lines += [(rise, pin, 1), (fall, pin, 0)]
+        rises.append(rise)
+    periods = [b - a for a, b in zip(rises, rises[1:])]
+    return lines, periods
+
+
+def row(name, board, expect, got, tick_hz, cycles, bad):
+    print("| %s | %s | %s | %.1f Hz, %.1f %% | %d | %d | %d | %d | %s |" % (
+        name, board, expect, tick_hz / got["period"]["mean"] if got["period"]["mean"] else 0,
+        got["duty"], got["jitter"], got["periods"], got["missed"], cycles, "off" if bad else "ok"))
+    return bool(bad)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--boards", default=",".join(LOOPBACK))
+    parser.add_argument("-D", dest="defines", action="append", default=[], help="program #define")
+    parser.add_argument("--cc", default="gcc")
+    args = parser.parse_args()
+
+    print("| Case | Board | Expected | Measured | Jitter ticks | Periods | Missed | ISR cycles | Result |")
+    print("|---|---|---|---|---|---|---|---|---|")
+    failed = 0
+    defines = args.defines + ["CAPTURE_MODE=1"]
+    for board in args.boards.split(","):
+        out, pin = LOOPBACK[board]
+        with tempfile.TemporaryDirectory(prefix="capture_") as workdir:
+            binary = run.build(args.cc, "Hardware PWM/%s/blink.c" % board, board, defines, workdir)
+            for presses in range(5):
+                button = []
+                for n in range(presses):
+                    start = 0.02 + 0.04 * n
+                    button += [(start, BUTTONS[board], 0), (start + 0.02, BUTTONS[board], "z")]
+                until = 0.02 + 0.04 * presses + 0.3 # the last window after the last step
+                hz, got, cycles = simulate(binary, until, workdir, button, "%s,%s" % (out, pin))
+                ticks = int(round(hz / PWM_HZ)) # PWM_TICKS
+                duty = (ticks // 2 + presses * (ticks // 10) + 1) * 100.0 / ticks
+                period = ticks * timer_hz(hz) / hz # in capture ticks
+                bad = (abs(got["period"]["mean"] - period) > 0.05 or abs(got["duty"] - duty) > 100.0 / period + 0.05
+                       or got["jitter"] > 1 or got["missed"] or not got["periods"])
+                failed += row("loopback", board, "%.1f Hz, %.1f %%" % (hz / ticks, duty),
+                              got, timer_hz(hz), cycles, bad)
+
+        if board != "MSP430F5529" and board != "MSP430FR2311":
+            continue
+        with tempfile.TemporaryDirectory(prefix="capture_") as workdir:
+            if board == "MSP430F5529":
+                name, freq, duty, jitter, defs = "jitter", 5000, 0.3, 2e-6, []
+            else:
+                name, freq, duty, jitter, defs = "slow", 20, 0.25, 0, ["CAPTURE_WINDOW=4"]
+            binary = run.build(args.cc, "Hardware PWM/%s/blink.c" % board, board, defines + defs, workdir)
+            lines, periods = signal(pin, freq, duty, 0.7 if freq > 100 else 0.9, jitter)
+            hz, got, cycles = simulate(binary, lines[-1][0], workdir, lines)
+            tick_hz = timer_hz(hz)
+            spread = (max(periods) - min(periods)) * tick_hz
+            bad = (abs(tick_hz / got["period"]["mean"] - freq) > freq * 1e-3
+                   or abs(got["duty"] - duty * 100) > 0.3 or got["jitter"] > spread + 2
+                   or got["jitter"] < spread / 2 or got["missed"] or not got["periods"])
+            failed += row(name, board, "%d Hz, %.1f %%, spread %d" % (freq, duty * 100, spread),
+                          got, tick_hz, cycles, bad)
+
+    # One edge every 50 cycles
+    board = "MSP430G2553"
+    out, pin = LOOPBACK[board]
+    with tempfile.TemporaryDirectory(prefix="capture_") as workdir:
+        binary = run.build(args.cc, "Hardware PWM/%s/blink.c" % board, board, defines + ["CLOCK_MHZ=1"], workdir)
+        hz, got, cycles = simulate(binary, 0.35, workdir, wire="%s,%s" % (out, pin))
+        ticks = int(round(hz / PWM_HZ))
+        duty = (ticks // 2 + 1) * 100.0 / ticks
+        bad = abs(got["duty"] - duty) > 0.05 or got["missed"] or not got["periods"]
+        failed += row("1 MHz", board, "%.1f Hz, %.1f %%" % (hz / ticks, duty), got, timer_hz(hz), cycles, bad)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
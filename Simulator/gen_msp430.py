@@ -0,0 +1,500 @@
+#!/usr/bin/env python3
+"""Generates Simulator/msp430.h, the substitute device header for the host simulator.
+
+Each supported device gets the timers, ports, vectors and clock registers it
+really has, so a program that touches a peripheral its board lacks still fails
+to compile. Every register expands to an access through sim.h, see there for
+the model. Constants use the values of the TI headers where the simulator
+interprets them (timer, port and status register bits); clock system constants
+are only stored, so their values just have to be distinct.
+
+Run from the Simulator directory:
+  python3 gen_msp430.py > msp430.h
+"""
+
+# Timer DMA triggers (DMAxTSEL value, timer, CCR) shared by the parts with DMA,
+# from the DMA trigger tables of their datasheets
+DMA_TRIGGERS = [(1, "TA0", 0), (2, "TA0", 2), (3, "TA1", 0), (4, "TA1", 2), (5, "TA2", 0)]
+
+# Device -> (timers with their CCR count, ports, interrupt ports, family, DMA channels,
+# capture inputs). Capture inputs are the CCIxA pins the simulator connects, as
+# (timer, CCR, port, bit); only those of HAL_CAP in Common/hal.h are listed.
+DEVICES = {
+    "MSP430G2553": {
+        "timers": {"TA0": 3, "TA1": 3},
+        "ports": ["1", "2"],
+        "irq_ports": ["1", "2"],
+        "family": "2xx",
+        "capture": [("TA1", 1, "2", 1)],
+    },
+    "MSP430F5529": {
+        "timers": {"TA0": 5, "TA1": 3, "TA2": 3, "TB0": 7},
+        "ports": ["1", "2", "3", "4", "5", "6", "7", "8", "J"],
+        "irq_ports": ["1", "2"],
+        "family": "5xx",
+        "dma": 3,
+        "capture": [("TA1", 1, "2", 0)],
+    },
+    "MSP430FR2311": {
+        "timers": {"TB0": 3, "TB1": 3},
+        "ports": ["1", "2"],
+        "irq_ports": ["1", "2"],
+        "family": "fr2xx",
+        "capture": [("TB0", 1, "1", 6)],
+    },
+    "MSP430FR5994": {
+        "timers": {"TA0": 3, "TA1": 3, "TA2": 2, "TA3": 5, "TA4": 3, "TB0": 7},
+        "ports": ["1", "2", "3", "4", "5", "6", "7", "8", "J"],
+        "irq_ports": ["1", "2", "3", "4", "5", "6", "7", "8"],
+        "family": "fr5xx",
+        "dma": 6,
+        "capture": [("TA1", 1, "1", 2)],
+    },
+    "MSP430FR6989": {
+        "timers": {"TA0": 3, "TA1": 3, "TA2": 2, "TA3": 5, "TB0": 7},
+        "ports": ["1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J"],
+        "irq_ports": ["1", "2", "3", "4"],
+        "family": "fr5xx",
+        "dma": 3,
+        "capture": [("TA1", 1, "1", 2)],
+    },
+}
+
+# Vector priority, lowest first (close to the F5529 table; higher number wins)
+PRIORITY = (["PORT%d" % n for n in range(10, 1, -1)]
+            + ["TIMER4_A1", "TIMER4_A0", "TIMER3_A1", "TIMER3_A0", "TIMER2_A1", "TIMER2_A0",
+               "PORT1", "TIMER1_A1", "TIMER1_A0", "DMA", "TIMER0_A1", "TIMER0_A0", "WDT",
+               "TIMER2_B1", "TIMER2_B0", "TIMER1_B1", "TIMER1_B0", "TIMER0_B1", "TIMER0_B0"])
+
+COMMON = """
+#define BIT0 (0x0001)
+#define BIT1 (0x0002)
+#define BIT2 (0x0004)
+#define BIT3 (0x0008)
+#define BIT4 (0x0010)
+#define BIT5 (0x0020)
+#define BIT6 (0x0040)
+#define BIT7 (0x0080)
+#define BIT8 (0x0100)
+#define BIT9 (0x0200)
+#define BITA (0x0400)
+#define BITB (0x0800)
+#define BITC (0x1000)
+#define BITD (0x2000)
+#define BITE (0x4000)
+#define BITF (0x8000)
+
+// Status register
+#define GIE (0x0008)
+#define CPUOFF (0x0010)
+#define OSCOFF (0x0020)
+#define SCG0 (0x0040)
+#define SCG1 (0x0080)
+#define LPM0_bits (CPUOFF)
+#define LPM1_bits (SCG0 + CPUOFF)
+#define LPM2_bits (SCG1 + CPUOFF)
+#define LPM3_bits (SCG1 + SCG0 + CPUOFF)
+#define LPM4_bits (SCG1 + SCG0 + OSCOFF + CPUOFF)
+#define LPM0 (LPM0_bits)
+#define LPM1 (LPM1_bits)
+#define LPM2 (LPM2_bits)
+#define LPM3 (LPM3_bits)
+#define LPM4 (LPM4_bits)
+
+#define WDTPW (0x5A00)
+#define WDTHOLD (0x0080)
+
+// Timer control, shared bit positions of Timer_A and Timer_B
+#define ID_0 (0x0000)
+#define ID_1 (0x0040)
+#define ID_2 (0x0080)
+#define ID_3 (0x00C0)
+#define MC_0 (0x0000)
+#define MC_1 (0x0010)
+#define MC_2 (0x0020)
+#define MC_3 (0x0030)
+
+// Capture/compare control
+#define CM_0 (0x0000)
+#define CM_1 (0x4000)
+#define CM_2 (0x8000)
+#define CM_3 (0xC000)
+#define CCIS_0 (0x0000)
+#define CCIS_1 (0x1000)
+#define CCIS_2 (0x2000)
+#define CCIS_3 (0x3000)
+#define SCS (0x0800)
+#define SCCI (0x0400)
+#define CAP (0x0100)
+#define OUTMOD_0 (0x0000)
+#define OUTMOD_1 (0x0020)
+#define OUTMOD_2 (0x0040)
+#define OUTMOD_3 (0x0060)
+#define OUTMOD_4 (0x0080)
+#define OUTMOD_5 (0x00A0)
+#define OUTMOD_6 (0x00C0)
+#define OUTMOD_7 (0x00E0)
+#define CCIE (0x0010)
+#define CCI (0x0008)
+#define OUT (0x0004)
+#define COV (0x0002)
+#define CCIFG (0x0001)
+
+// Intrinsics
+#define __interrupt
+#define __even_in_range(x, y) (x)
+#define __enable_interrupt() simBisSR(GIE)
+#define __disable_interrupt() simBicSR(GIE)
+#define __bis_SR_register(x) simBisSR(x)
+#define __bic_SR_register(x) simBicSR(x)
+#define __bis_SR_register_on_exit(x) simBisSROnExit(x)
+#define __bic_SR_register_on_exit(x) simBicSROnExit(x)
+#define __get_SR_register() simGetSR()
+#define __delay_cycles(x) simDelayCycles(x)
+#define __no_operation() simDelayCycles(1)
+#define __data16_write_addr(addr, value) simWriteAddr((uintptr_t)(addr), (uintptr_t)(value))
+"""
+
+DMA = """
+#define DMADT_0 (0x0000)
+#define DMADT_1 (0x1000)
+#define DMADT_2 (0x2000)
+#define DMADT_3 (0x3000)
+#define DMADT_4 (0x4000)
+#define DMADT_5 (0x5000)
+#define DMADT_6 (0x6000)
+#define DMADT_7 (0x7000)
+#define DMADSTINCR_0 (0x0000)
+#define DMADSTINCR_1 (0x0400)
+#define DMADSTINCR_2 (0x0800)
+#define DMADSTINCR_3 (0x0C00)
+#define DMASRCINCR_0 (0x0000)
+#define DMASRCINCR_1 (0x0100)
+#define DMASRCINCR_2 (0x0200)
+#define DMASRCINCR_3 (0x0300)
+#define DMADSTBYTE (0x0080)
+#define DMASRCBYTE (0x0040)
+#define DMALEVEL (0x0020)
+#define DMAEN (0x0010)
+#define DMAIFG (0x0008)
+#define DMAIE (0x0004)
+#define DMAABORT (0x0002)
+#define DMAREQ (0x0001)
+#define DMARMWDIS (0x0004)
+#define ROUNDROBIN (0x0002)
+#define ENNMI (0x0001)
+"""
+
+TIMER_A = """
+#define TASSEL_0 (0x0000)
+#define TASSEL_1 (0x0100)
+#define TASSEL_2 (0x0200)
+#define TASSEL_3 (0x0300)
+#define TACLR (0x0004)
+#define TAIE (0x0002)
+#define TAIFG (0x0001)
+"""
+
+TIMER_B = """
+#define TBCLGRP_0 (0x0000)
+#define TBCLGRP_1 (0x2000)
+#define TBCLGRP_2 (0x4000)
+#define TBCLGRP_3 (0x6000)
+#define CNTL_0 (0x0000)
+#define CNTL_1 (0x0800)
+#define CNTL_2 (0x1000)
+#define CNTL_3 (0x1800)
+#define TBSSEL_0 (0x0000)
+#define TBSSEL_1 (0x0100)
+#define TBSSEL_2 (0x0200)
+#define TBSSEL_3 (0x0300)
+#define TBCLR (0x0004)
+#define TBIE (0x0002)
+#define TBIFG (0x0001)
+#define CLLD_0 (0x0000)
+#define CLLD_1 (0x0200)
+#define CLLD_2 (0x0400)
+#define CLLD_3 (0x0600)
+"""
+
+# Watchdog: WDT+ on the 2xx parts, WDT_A on the others. WDTIE and WDTIFG sit in
+# IE1/IFG1 or SFRIE1/SFRIFG1, see CLOCK below.
+WDT = {
+    "2xx": """
+#define WDTNMIES (0x0040)
+#define WDTNMI (0x0020)
+#define WDTTMSEL (0x0010)
+#define WDTCNTCL (0x0008)
+#define WDTSSEL (0x0004)
+#define WDTIS1 (0x0002)
+#define WDTIS0 (0x0001)
+#define WDTIE (0x01)
+#define WDTIFG (0x01)
+""",
+    "other": """
+#define WDTSSEL_0 (0x0000)
+#define WDTSSEL_1 (0x0020)
+#define WDTSSEL_2 (0x0040)
+#define WDTSSEL_3 (0x0060)
+#define WDTTMSEL (0x0010)
+#define WDTCNTCL (0x0008)
+#define WDTIS_0 (0x0000)
+#define WDTIS_1 (0x0001)
+#define WDTIS_2 (0x0002)
+#define WDTIS_3 (0x0003)
+#define WDTIS_4 (0x0004)
+#define WDTIS_5 (0x0005)
+#define WDTIS_6 (0x0006)
+#define WDTIS_7 (0x0007)
+#define WDTIE (0x0001)
+#define WDTIFG (0x0001)
+""",
+}
+
+CLOCK = {
+    "2xx": """
+#define BCSCTL1 SIM_R8(simMisc.bcsctl1)
+#define BCSCTL2 SIM_R8(simMisc.bcsctl2)
+#define BCSCTL3 SIM_R8(simMisc.bcsctl3)
+#define DCOCTL SIM_R8(simMisc.dcoctl)
+#define IE1 SIM_R8(simMisc.ie1)
+#define IFG1 SIM_R8(simMisc.ifg1)
+#define CALBC1_1MHZ SIM_R8(simMisc.calbc1_1mhz)
+#define CALDCO_1MHZ SIM_R8(simMisc.caldco_1mhz)
+#define CALBC1_8MHZ SIM_R8(simMisc.calbc1_8mhz)
+#define CALDCO_8MHZ SIM_R8(simMisc.caldco_8mhz)
+#define CALBC1_12MHZ SIM_R8(simMisc.calbc1_12mhz)
+#define CALDCO_12MHZ SIM_R8(simMisc.caldco_12mhz)
+#define CALBC1_16MHZ SIM_R8(simMisc.calbc1_16mhz)
+#define CALDCO_16MHZ SIM_R8(simMisc.caldco_16mhz)
+#define LFXT1S_2 (0x20)
+""",
+    "5xx": """
+#define SFRIE1 SIM_R16(simMisc.sfrie1)
+#define SFRIFG1 SIM_R16(simMisc.sfrifg1)
+#define UCSCTL0 SIM_R16(simMisc.ucsctl[0])
+#define UCSCTL1 SIM_R16(simMisc.ucsctl[1])
+#define UCSCTL2 SIM_R16(simMisc.ucsctl[2])
+#define UCSCTL3 SIM_R16(simMisc.ucsctl[3])
+#define UCSCTL4 SIM_R16(simMisc.ucsctl[4])
+#define UCSCTL5 SIM_R16(simMisc.ucsctl[5])
+#define UCSCTL6 SIM_R16(simMisc.ucsctl[6])
+#define UCSCTL7 SIM_R16(simMisc.ucsctl[7])
+#define UCSCTL8 SIM_R16(simMisc.ucsctl[8])
+#define PMMCTL0 SIM_R16(simMisc.pmmctl0)
+#define PMMCTL0_L SIM_R8(simMisc.pmmctl0_l)
+#define PMMCTL0_H SIM_R8(simMisc.pmmctl0_h)
+#define PMMIFG SIM_R16(simMisc.pmmifg)
+#define SVSMHCTL SIM_R16(simMisc.svsmhctl)
+#define SVSMLCTL SIM_R16(simMisc.svsmlctl)
+#define PMMPW_H (0xA5)
+#define PMMCOREV0 (0x0001)
+#define SVSHE (0x0400)
+#define SVSHRVL0 (0x0100)
+#define SVMHE (0x4000)
+#define SVSMHRRL0 (0x0001)
+#define SVSLE (0x0400)
+#define SVSLRVL0 (0x0100)
+#define SVMLE (0x4000)
+#define SVSMLRRL0 (0x0001)
+#define SVSMLDLYIFG (0x0001)
+#define SVMLIFG (0x0002)
+#define SVMLVLRIFG (0x0004)
+#define SELREF_2 (0x0020)
+#define SELA_2 (0x0200)
+#define SELS_4 (0x0040)
+#define SELM_4 (0x0004)
+#define DCORSEL_5 (0x0050)
+#define DCORSEL_6 (0x0060)
+#define DCORSEL_7 (0x0070)
+#define FLLD_1 (0x1000)
+#define XT2OFFG (0x0008)
+#define XT1LFOFFG (0x0002)
+#define DCOFFG (0x0001)
+#define OFIFG (0x0002)
+""",
+    "fr5xx": """
+#define SFRIE1 SIM_R16(simMisc.sfrie1)
+#define SFRIFG1 SIM_R16(simMisc.sfrifg1)
+#define PM5CTL0 SIM_R16(simMisc.pm5ctl0)
+#define FRCTL0 SIM_R16(simMisc.frctl0)
+#define CSCTL0 SIM_R16(simMisc.csctl[0])
+#define CSCTL0_H SIM_R8(simMisc.csctl0_h)
+#define CSCTL1 SIM_R16(simMisc.csctl[1])
+#define CSCTL2 SIM_R16(simMisc.csctl[2])
+#define CSCTL3 SIM_R16(simMisc.csctl[3])
+#define CSCTL4 SIM_R16(simMisc.csctl[4])
+#define CSCTL5 SIM_R16(simMisc.csctl[5])
+#define CSCTL6 SIM_R16(simMisc.csctl[6])
+#define LOCKLPM5 (0x0001)
+#define OFIFG (0x0002)
+#define FRCTLPW (0xA500)
+#define NWAITS_1 (0x0010)
+#define CSKEY_H (0xA5)
+#define DCORSEL (0x0040)
+#define DCOFSEL_0 (0x0000)
+#define DCOFSEL_4 (0x0008)
+#define DCOFSEL_6 (0x000C)
+#define SELA__LFXTCLK (0x0000)
+#define SELS__DCOCLK (0x0030)
+#define SELM__DCOCLK (0x0003)
+#define DIVA__1 (0x0000)
+#define DIVS__1 (0x0000)
+#define DIVM__1 (0x0000)
+#define DIVA__4 (0x0200)
+#define DIVS__4 (0x0020)
+#define DIVM__4 (0x0002)
+#define LFXTOFF (0x0001)
+#define LFXTOFFG (0x0001)
+""",
+    "fr2xx": """
+#define SFRIE1 SIM_R16(simMisc.sfrie1)
+#define SFRIFG1 SIM_R16(simMisc.sfrifg1)
+#define PM5CTL0 SIM_R16(simMisc.pm5ctl0)
+#define FRCTL0 SIM_R16(simMisc.frctl0)
+#define CSCTL0 SIM_R16(simMisc.csctl[0])
+#define CSCTL1 SIM_R16(simMisc.csctl[1])
+#define CSCTL2 SIM_R16(simMisc.csctl[2])
+#define CSCTL3 SIM_R16(simMisc.csctl[3])
+#define CSCTL4 SIM_R16(simMisc.csctl[4])
+#define CSCTL5 SIM_R16(simMisc.csctl[5])
+#define CSCTL6 SIM_R16(simMisc.csctl[6])
+#define CSCTL7 SIM_R16(simMisc.csctl[7])
+#define CSCTL8 SIM_R16(simMisc.csctl[8])
+#define LOCKLPM5 (0x0001)
+#define OFIFG (0x0002)
+#define FRCTLPW (0xA500)
+#define NWAITS_1 (0x0010)
+#define DCORSEL_3 (0x0006)
+#define DCORSEL_5 (0x000A)
+#define DCORSEL_7 (0x000E)
+#define FLLD_0 (0x0000)
+#define SELREF__REFOCLK (0x0010)
+#define FLLUNLOCK0 (0x0100)
+#define FLLUNLOCK1 (0x0200)
+#define SELMS__DCOCLKDIV (0x0000)
+#define SELA__REFOCLK (0x0100)
+""",
+}
+
+
+def timer_block(name, ccrs, family):
+    kind = name[1]  # A or B
+    idx = "SIM_" + name
+    lines = []
+    lines.append("#define SIM_%s_CCRS %d" % (name, ccrs))
+    lines.append("#define %sCTL SIM_R16(simTimer[%s].ctl)" % (name, idx))
+    lines.append("#define %sR SIM_R16(simTimer[%s].r)" % (name, idx))
+    lines.append("#define %sIV simTimerIV(%s)" % (name, idx))
+    if family != "2xx":
+        lines.append("#define %sEX0 SIM_R16(simTimer[%s].ex0)" % (name, idx))
+    for n in range(ccrs):
+        lines.append("#define %sCCTL%d SIM_R16(simTimer[%s].cctl[%d])" % (name, n, idx, n))
+        lines.append("#define %sCCR%d SIM_R16(simTimer[%s].ccr[%d])" % (name, n, idx, n))
+    if family == "2xx" and name == "TA0":
+        # Legacy single-timer names of the 2xx headers
+        lines.append("#define TACTL TA0CTL")
+        lines.append("#define TAR TA0R")
+        lines.append("#define TAIV TA0IV")
+        for n in range(ccrs):
+            lines.append("#define TACCTL%d TA0CCTL%d" % (n, n))
+            lines.append("#define TACCR%d TA0CCR%d" % (n, n))
+            lines.append("#define CCTL%d TA0CCTL%d" % (n, n))
+            lines.append("#define CCR%d TA0CCR%d" % (n, n))
+    number = name[2]
+    lines.append("#define TIMER%s_%s0_VECTOR (%d)" % (number, kind, PRIORITY.index("TIMER%s_%s0" % (number, kind)) + 1))
+    lines.append("#define TIMER%s_%s1_VECTOR (%d)" % (number, kind, PRIORITY.index("TIMER%s_%s1" % (number, kind)) + 1))
+    return "\n".join(lines)
+
+
+def dma_block(channels):
+    lines = ["#define SIM_DMA_COUNT %d" % channels]
+    lines.append("#define SIM_DMA_TRIGGERS { %s }" % ", ".join(
+        "{ %d, SIM_%s, %d }" % t for t in DMA_TRIGGERS))
+    for n in range(5):
+        lines.append("#define DMACTL%d SIM_R16(simDma.ctl[%d])" % (n, n))
+    for ch in range(channels):
+        lines.append("#define DMA%dCTL SIM_R16(simDma.ch[%d].ctl)" % (ch, ch))
+        lines.append("#define DMA%dSA (simDma.ch[%d].sa)" % (ch, ch))
+        lines.append("#define DMA%dDA (simDma.ch[%d].da)" % (ch, ch))
+        lines.append("#define DMA%dSZ SIM_R16(simDma.ch[%d].sz)" % (ch, ch))
+        for n in range(32):
+            lines.append("#define DMA%dTSEL_%d (0x%04X)" % (ch, n, n << (8 * (ch & 1))))
+    return "\n".join(lines)
+
+
+def capture_block(inputs):
+    return "#define SIM_CAPTURE_INPUTS { %s }" % ", ".join(
+        "{ SIM_%s, %d, SIM_P%s, %d }" % c for c in inputs)
+
+
+def port_block(port, irq, family):
+    idx = "SIM_P" + port
+    regs = ["IN", "OUT", "DIR", "REN"]
+    if family in ("2xx", "5xx") and port != "J":
+        regs.append("SEL")
+    if family == "2xx":
+        regs.append("SEL2")
+    if family in ("fr5xx", "fr2xx"):
+        regs += ["SEL0", "SEL1"]
+    if family == "5xx":
+        regs.append("DS")
+    if irq:
+        regs += ["IES", "IE", "IFG"]
+    lines = ["#define P%s%s SIM_R8(simPort[%s].%s)" % (port, r, idx, r.lower()) for r in regs]
+    if irq:
+        if family != "2xx":
+            lines.append("#define P%sIV simPortIV(%s)" % (port, idx))
+        lines.append("#define PORT%s_VECTOR (%d)" % (port, PRIORITY.index("PORT" + port) + 1))
+    return "\n".join(lines)
+
+
+def main():
+    print("// Substitute <msp430.h> for the host simulator, generated by gen_msp430.py")
+    print("// Do not edit, change the generator and rerun it")
+    print()
+    print("#ifndef SIM_MSP430_H")
+    print("#define SIM_MSP430_H")
+    print()
+    print('#include "sim.h"')
+    print(COMMON)
+    first = True
+    for device, d in DEVICES.items():
+        print("#%s defined(__%s__)" % ("if" if first else "elif", device))
+        print('#define SIM_DEVICE "%s"' % device)
+        first = False
+        family = d["family"]
+        if any(t.startswith("TA") for t in d["timers"]):
+            print(TIMER_A.strip())
+        if any(t.startswith("TB") for t in d["timers"]):
+            print(TIMER_B.strip())
+        if family != "2xx":
+            for prefix in sorted({t[:2] for t in d["timers"]}):
+                for n in range(8):
+                    print("#define %sIDEX_%d (0x%04X)" % (prefix, n, n))
+        print()
+        for name, ccrs in d["timers"].items():
+            print(timer_block(name, ccrs, family))
+            print()
+        for port in d["ports"]:
+            print(port_block(port, port in d["irq_ports"], family))
+            print()
+        if "capture" in d:
+            print(capture_block(d["capture"]))
+        print("#define WDTCTL SIM_R16(simMisc.wdtctl)")
+        print("#define WDT_VECTOR (%d)" % (PRIORITY.index("WDT") + 1))
+        print(WDT["2xx" if family == "2xx" else "other"].strip())
+        if "dma" in d:
+            print("#define DMA_VECTOR (%d)" % (PRIORITY.index("DMA") + 1))
+            print(DMA.strip())
+            print(dma_block(d["dma"]))
+        print(CLOCK[family].strip())
+    print("#else")
+    print('#error "Simulator/msp430.h: unsupported device"')
+    print("#endif")
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,1676 @@
+// Substitute <msp430.h> for the host simulator, generated by gen_msp430.py
+// Do not edit, change the generator and rerun it
+
+#ifndef SIM_MSP430_H
+#define SIM_MSP430_H
+
+#include "sim.h"
+
+#define BIT0 (0x0001)
+#define BIT1 (0x0002)
+#define BIT2 (0x0004)
+#define BIT3 (0x0008)
+#define BIT4 (0x0010)
+#define BIT5 (0x0020)
+#define BIT6 (0x0040)
+#define BIT7 (0x0080)
+#define BIT8 (0x0100)
+#define BIT9 (0x0200)
+#define BITA (0x0400)
+#define BITB (0x0800)
+#define BITC (0x1000)
+#define BITD (0x2000)
+#define BITE (0x4000)
+#define BITF (0x8000)
+
+// Status register
+#define GIE (0x0008)
+#define CPUOFF (0x0010)
+#define OSCOFF (0x0020)
+#define SCG0 (0x0040)
+#define SCG1 (0x0080)
+#define LPM0_bits (CPUOFF)
+#define LPM1_bits (SCG0 + CPUOFF)
+#define LPM2_bits (SCG1 + CPUOFF)
+#define LPM3_bits (SCG1 + SCG0 + CPUOFF)
+#define LPM4_bits (SCG1 + SCG0 + OSCOFF + CPUOFF)
+#define LPM0 (LPM0_bits)
+#define LPM1 (LPM1_bits)
+#define LPM2 (LPM2_bits)
+#define LPM3 (LPM3_bits)
+#define LPM4 (LPM4_bits)
+
+#define WDTPW (0x5A00)
+#define WDTHOLD (0x0080)
+
+// Timer control, shared bit positions of Timer_A and Timer_B
+#define ID_0 (0x0000)
+#define ID_1 (0x0040)
+#define ID_2 (0x0080)
+#define ID_3 (0x00C0)
+#define MC_0 (0x0000)
+#define MC_1 (0x0010)
+#define MC_2 (0x0020)
+#define MC_3 (0x0030)
+
+// Capture/compare control
+#define CM_0 (0x0000)
+#define CM_1 (0x4000)
+#define CM_2 (0x8000)
+#define CM_3 (0xC000)
+#define CCIS_0 (0x0000)
+#define CCIS_1 (0x1000)
+#define CCIS_2 (0x2000)
+#define CCIS_3 (0x3000)
+#define SCS (0x0800)
+#define SCCI (0x0400)
+#define CAP (0x0100)
+#define OUTMOD_0 (0x0000)
+#define OUTMOD_1 (0x0020)
+#define OUTMOD_2 (0x0040)
+#define OUTMOD_3 (0x0060)
+#define OUTMOD_4 (0x0080)
+#define OUTMOD_5 (0x00A0)
+#define OUTMOD_6 (0x00C0)
+#define OUTMOD_7 (0x00E0)
+#define CCIE (0x0010)
+#define CCI (0x0008)
+#define OUT (0x0004)
+#define COV (0x0002)
+#define CCIFG (0x0001)
+
+// Intrinsics
+#define __interrupt
+#define __even_in_range(x, y) (x)
+#define __enable_interrupt() simBisSR(GIE)
+#define __disable_interrupt() simBicSR(GIE)
+#define __bis_SR_register(x) simBisSR(x)
+#define __bic_SR_register(x) simBicSR(x)
+#define __bis_SR_register_on_exit(x) simBisSROnExit(x)
+#define __bic_SR_register_on_exit(x) simBicSROnExit(x)
+#define __get_SR_register() simGetSR()
+#define __delay_cycles(x) simDelayCycles(x)
+#define __no_operation() simDelayCycles(1)
+#define __data16_write_addr(addr, value) simWriteAddr((uintptr_t)(addr), (uintptr_t)(value))
+
+#if defined(__MSP430G2553__)
+#define SIM_DEVICE "MSP430G2553"
+#define TASSEL_0 (0x0000)
+#define TASSEL_1 (0x0100)
+#define TASSEL_2 (0x0200)
+#define TASSEL_3 (0x0300)
+#define TACLR (0x0004)
+#define TAIE (0x0002)
+#define TAIFG (0x0001)
+
+#define SIM_TA0_CCRS 3
+#define TA0CTL SIM_R16(simTimer[SIM_TA0].ctl)
+#define TA0R SIM_R16(simTimer[SIM_TA0].r)
+#define TA0IV simTimerIV(SIM_TA0)
+#define TA0CCTL0 SIM_R16(simTimer[SIM_TA0].cctl[0])
+#define TA0CCR0 SIM_R16(simTimer[SIM_TA0].ccr[0])
+#define TA0CCTL1 SIM_R16(simTimer[SIM_TA0].cctl[1])
+#define TA0CCR1 SIM_R16(simTimer[SIM_TA0].ccr[1])
+#define TA0CCTL2 SIM_R16(simTimer[SIM_TA0].cctl[2])
+#define TA0CCR2 SIM_R16(simTimer[SIM_TA0].ccr[2])
+#define TACTL TA0CTL
+#define TAR TA0R
+#define TAIV TA0IV
+#define TACCTL0 TA0CCTL0
+#define TACCR0 TA0CCR0
+#define CCTL0 TA0CCTL0
+#define CCR0 TA0CCR0
+#define TACCTL1 TA0CCTL1
+#define TACCR1 TA0CCR1
+#define CCTL1 TA0CCTL1
+#define CCR1 TA0CCR1
+#define TACCTL2 TA0CCTL2
+#define TACCR2 TA0CCR2
+#define CCTL2 TA0CCTL2
+#define CCR2 TA0CCR2
+#define TIMER0_A0_VECTOR (21)
+#define TIMER0_A1_VECTOR (20)
+
+#define SIM_TA1_CCRS 3
+#define TA1CTL SIM_R16(simTimer[SIM_TA1].ctl)
+#define TA1R SIM_R16(simTimer[SIM_TA1].r)
+#define TA1IV simTimerIV(SIM_TA1)
+#define TA1CCTL0 SIM_R16(simTimer[SIM_TA1].cctl[0])
+#define TA1CCR0 SIM_R16(simTimer[SIM_TA1].ccr[0])
+#define TA1CCTL1 SIM_R16(simTimer[SIM_TA1].cctl[1])
+#define TA1CCR1 SIM_R16(simTimer[SIM_TA1].ccr[1])
+#define TA1CCTL2 SIM_R16(simTimer[SIM_TA1].cctl[2])
+#define TA1CCR2 SIM_R16(simTimer[SIM_TA1].ccr[2])
+#define TIMER1_A0_VECTOR (18)
+#define TIMER1_A1_VECTOR (17)
+
+#define P1IN SIM_R8(simPort[SIM_P1].in)
+#define P1OUT SIM_R8(simPort[SIM_P1].out)
+#define P1DIR SIM_R8(simPort[SIM_P1].dir)
+#define P1REN SIM_R8(simPort[SIM_P1].ren)
+#define P1SEL SIM_R8(simPort[SIM_P1].sel)
+#define P1SEL2 SIM_R8(simPort[SIM_P1].sel2)
+#define P1IES SIM_R8(simPort[SIM_P1].ies)
+#define P1IE SIM_R8(simPort[SIM_P1].ie)
+#define P1IFG SIM_R8(simPort[SIM_P1].ifg)
+#define PORT1_VECTOR (16)
+
+#define P2IN SIM_R8(simPort[SIM_P2].in)
+#define P2OUT SIM_R8(simPort[SIM_P2].out)
+#define P2DIR SIM_R8(simPort[SIM_P2].dir)
+#define P2REN SIM_R8(simPort[SIM_P2].ren)
+#define P2SEL SIM_R8(simPort[SIM_P2].sel)
+#define P2SEL2 SIM_R8(simPort[SIM_P2].sel2)
+#define P2IES SIM_R8(simPort[SIM_P2].ies)
+#define P2IE SIM_R8(simPort[SIM_P2].ie)
+#define P2IFG SIM_R8(simPort[SIM_P2].ifg)
+#define PORT2_VECTOR (9)
+
+#define SIM_CAPTURE_INPUTS { { SIM_TA1, 1, SIM_P2, 1 } }
+#define WDTCTL SIM_R16(simMisc.wdtctl)
+#define WDT_VECTOR (22)
+#define WDTNMIES (0x0040)
+#define WDTNMI (0x0020)
+#define WDTTMSEL (0x0010)
+#define WDTCNTCL (0x0008)
+#define WDTSSEL (0x0004)
+#define WDTIS1 (0x0002)
+#define WDTIS0 (0x0001)
+#define WDTIE (0x01)
+#define WDTIFG (0x01)
+#define BCSCTL1 SIM_R8(simMisc.bcsctl1)
+#define BCSCTL2 SIM_R8(simMisc.bcsctl2)
+#define BCSCTL3 SIM_R8(simMisc.bcsctl3)
+#define DCOCTL SIM_R8(simMisc.dcoctl)
+#define IE1 SIM_R8(simMisc.ie1)
+#define IFG1 SIM_R8(simMisc.ifg1)
+#define CALBC1_1MHZ SIM_R8(simMisc.calbc1_1mhz)
+#define CALDCO_1MHZ SIM_R8(simMisc.caldco_1mhz)
+#define CALBC1_8MHZ SIM_R8(simMisc.calbc1_8mhz)
+#define CALDCO_8MHZ SIM_R8(simMisc.caldco_8mhz)
+#define CALBC1_12MHZ SIM_R8(simMisc.calbc1_12mhz)
+#define CALDCO_12MHZ SIM_R8(simMisc.caldco_12mhz)
+#define CALBC1_16MHZ SIM_R8(simMisc.calbc1_16mhz)
+#define CALDCO_16MHZ SIM_R8(simMisc.caldco_16mhz)
+#define LFXT1S_2 (0x20)
+#elif defined(__MSP430F5529__)
+#define SIM_DEVICE "MSP430F5529"
+#define TASSEL_0 (0x0000)
+#define TASSEL_1 (0x0100)
+#define TASSEL_2 (0x0200)
+#define TASSEL_3 (0x0300)
+#define TACLR (0x0004)
+#define TAIE (0x0002)
+#define TAIFG (0x0001)
+#define TBCLGRP_0 (0x0000)
+#define TBCLGRP_1 (0x2000)
+#define TBCLGRP_2 (0x4000)
+#define TBCLGRP_3 (0x6000)
+#define CNTL_0 (0x0000)
+#define CNTL_1 (0x0800)
+#define CNTL_2 (0x1000)
+#define CNTL_3 (0x1800)
+#define TBSSEL_0 (0x0000)
+#define TBSSEL_1 (0x0100)
+#define TBSSEL_2 (0x0200)
+#define TBSSEL_3 (0x0300)
+#define TBCLR (0x0004)
+#define TBIE (0x0002)
+#define TBIFG (0x0001)
+#define CLLD_0 (0x0000)
+#define CLLD_1 (0x0200)
+#define CLLD_2 (0x0400)
+#define CLLD_3 (0x0600)
+#define TAIDEX_0 (0x0000)
+#define TAIDEX_1 (0x0001)
+#define TAIDEX_2 (0x0002)
+#define TAIDEX_3 (0x0003)
+#define TAIDEX_4 (0x0004)
+#define TAIDEX_5 (0x0005)
+#define TAIDEX_6 (0x0006)
+#define TAIDEX_7 (0x0007)
+#define TBIDEX_0 (0x0000)
+#define TBIDEX_1 (0x0001)
+#define TBIDEX_2 (0x0002)
+#define TBIDEX_3 (0x0003)
+#define TBIDEX_4 (0x0004)
+#define TBIDEX_5 (0x0005)
+#define TBIDEX_6 (0x0006)
+#define TBIDEX_7 (0x0007)
+
+#define SIM_TA0_CCRS 5
+#define TA0CTL SIM_R16(simTimer[SIM_TA0].ctl)
+#define TA0R SIM_R16(simTimer[SIM_TA0].r)
+#define TA0IV simTimerIV(SIM_TA0)
+#define TA0EX0 SIM_R16(simTimer[SIM_TA0].ex0)
+#define TA0CCTL0 SIM_R16(simTimer[SIM_TA0].cctl[0])
+#define TA0CCR0 SIM_R16(simTimer[SIM_TA0].ccr[0])
+#define TA0CCTL1 SIM_R16(simTimer[SIM_TA0].cctl[1])
+#define TA0CCR1 SIM_R16(simTimer[SIM_TA0].ccr[1])
+#define TA0CCTL2 SIM_R16(simTimer[SIM_TA0].cctl[2])
+#define TA0CCR2 SIM_R16(simTimer[SIM_TA0].ccr[2])
+#define TA0CCTL3 SIM_R16(simTimer[SIM_TA0].cctl[3])
+#define TA0CCR3 SIM_R16(simTimer[SIM_TA0].ccr[3])
+#define TA0CCTL4 SIM_R16(simTimer[SIM_TA0].cctl[4])
+#define TA0CCR4 SIM_R16(simTimer[SIM_TA0].ccr[4])
+#define TIMER0_A0_VECTOR (21)
+#define TIMER0_A1_VECTOR (20)
+
+#define SIM_TA1_CCRS 3
+#define TA1CTL SIM_R16(simTimer[SIM_TA1].ctl)
+#define TA1R SIM_R16(simTimer[SIM_TA1].r)
+#define TA1IV simTimerIV(SIM_TA1)
+#define TA1EX0 SIM_R16(simTimer[SIM_TA1].ex0)
+#define TA1CCTL0 SIM_R16(simTimer[SIM_TA1].cctl[0])
+#define TA1CCR0 SIM_R16(simTimer[SIM_TA1].ccr[0])
+#define TA1CCTL1 SIM_R16(simTimer[SIM_TA1].cctl[1])
+#define TA1CCR1 SIM_R16(simTimer[SIM_TA1].ccr[1])
+#define TA1CCTL2 SIM_R16(simTimer[SIM_TA1].cctl[2])
+#define TA1CCR2 SIM_R16(simTimer[SIM_TA1].ccr[2])
+#define TIMER1_A0_VECTOR (18)
+#define TIMER1_A1_VECTOR (17)
+
+#define SIM_TA2_CCRS 3
+#define TA2CTL SIM_R16(simTimer[SIM_TA2].ctl)
+#define TA2R SIM_R16(simTimer[SIM_TA2].r)
+#define TA2IV simTimerIV(SIM_TA2)
+#define TA2EX0 SIM_R16(simTimer[SIM_TA2].ex0)
+#define TA2CCTL0 SIM_R16(simTimer[SIM_TA2].cctl[0])
+#define TA2CCR0 SIM_R16(simTimer[SIM_TA2].ccr[0])
+#define TA2CCTL1 SIM_R16(simTimer[SIM_TA2].cctl[1])
+#define TA2CCR1 SIM_R16(simTimer[SIM_TA2].ccr[1])
+#define TA2CCTL2 SIM_R16(simTimer[SIM_TA2].cctl[2])
+#define TA2CCR2 SIM_R16(simTimer[SIM_TA2].ccr[2])
+#define TIMER2_A0_VECTOR (15)
+#define TIMER2_A1_VECTOR (14)
+
+#define SIM_TB0_CCRS 7
+#define TB0CTL SIM_R16(simTimer[SIM_TB0].ctl)
+#define TB0R SIM_R16(simTimer[SIM_TB0].r)
+#define TB0IV simTimerIV(SIM_TB0)
+#define TB0EX0 SIM_R16(simTimer[SIM_TB0].ex0)
+#define TB0CCTL0 SIM_R16(simTimer[SIM_TB0].cctl[0])
+#define TB0CCR0 SIM_R16(simTimer[SIM_TB0].ccr[0])
+#define TB0CCTL1 SIM_R16(simTimer[SIM_TB0].cctl[1])
+#define TB0CCR1 SIM_R16(simTimer[SIM_TB0].ccr[1])
+#define TB0CCTL2 SIM_R16(simTimer[SIM_TB0].cctl[2])
+#define TB0CCR2 SIM_R16(simTimer[SIM_TB0].ccr[2])
+#define TB0CCTL3 SIM_R16(simTimer[SIM_TB0].cctl[3])
+#define TB0CCR3 SIM_R16(simTimer[SIM_TB0].ccr[3])
+#define TB0CCTL4 SIM_R16(simTimer[SIM_TB0].cctl[4])
+#define TB0CCR4 SIM_R16(simTimer[SIM_TB0].ccr[4])
+#define TB0CCTL5 SIM_R16(simTimer[SIM_TB0].cctl[5])
+#define TB0CCR5 SIM_R16(simTimer[SIM_TB0].ccr[5])
+#define TB0CCTL6 SIM_R16(simTimer[SIM_TB0].cctl[6])
+#define TB0CCR6 SIM_R16(simTimer[SIM_TB0].ccr[6])
+#define TIMER0_B0_VECTOR (28)
+#define TIMER0_B1_VECTOR (27)
+
+#define P1IN SIM_R8(simPort[SIM_P1].in)
+#define P1OUT SIM_R8(simPort[SIM_P1].out)
+#define P1DIR SIM_R8(simPort[SIM_P1].dir)
+#define P1REN SIM_R8(simPort[SIM_P1].ren)
+#define P1SEL SIM_R8(simPort[SIM_P1].sel)
+#define P1DS SIM_R8(simPort[SIM_P1].ds)
+#define P1IES SIM_R8(simPort[SIM_P1].ies)
+#define P1IE SIM_R8(simPort[SIM_P1].ie)
+#define P1IFG SIM_R8(simPort[SIM_P1].ifg)
+#define P1IV simPortIV(SIM_P1)
+#define PORT1_VECTOR (16)
+
+#define P2IN SIM_R8(simPort[SIM_P2].in)
+#define P2OUT SIM_R8(simPort[SIM_P2].out)
+#define P2DIR SIM_R8(simPort[SIM_P2].dir)
+#define P2REN SIM_R8(simPort[SIM_P2].ren)
+#define P2SEL SIM_R8(simPort[SIM_P2].sel)
+#define P2DS SIM_R8(simPort[SIM_P2].ds)
+#define P2IES SIM_R8(simPort[SIM_P2].ies)
+#define P2IE SIM_R8(simPort[SIM_P2].ie)
+#define P2IFG SIM_R8(simPort[SIM_P2].ifg)
+#define P2IV simPortIV(SIM_P2)
+#define PORT2_VECTOR (9)
+
+#define P3IN SIM_R8(simPort[SIM_P3].in)
+#define P3OUT SIM_R8(simPort[SIM_P3].out)
+#define P3DIR SIM_R8(simPort[SIM_P3].dir)
+#define P3REN SIM_R8(simPort[SIM_P3].ren)
+#define P3SEL SIM_R8(simPort[SIM_P3].sel)
+#define P3DS SIM_R8(simPort[SIM_P3].ds)
+
+#define P4IN SIM_R8(simPort[SIM_P4].in)
+#define P4OUT SIM_R8(simPort[SIM_P4].out)
+#define P4DIR SIM_R8(simPort[SIM_P4].dir)
+#define P4REN SIM_R8(simPort[SIM_P4].ren)
+#define P4SEL SIM_R8(simPort[SIM_P4].sel)
+#define P4DS SIM_R8(simPort[SIM_P4].ds)
+
+#define P5IN SIM_R8(simPort[SIM_P5].in)
+#define P5OUT SIM_R8(simPort[SIM_P5].out)
+#define P5DIR SIM_R8(simPort[SIM_P5].dir)
+#define P5REN SIM_R8(simPort[SIM_P5].ren)
+#define P5SEL SIM_R8(simPort[SIM_P5].sel)
+#define P5DS SIM_R8(simPort[SIM_P5].ds)
+
+#define P6IN SIM_R8(simPort[SIM_P6].in)
+#define P6OUT SIM_R8(simPort[SIM_P6].out)
+#define P6DIR SIM_R8(simPort[SIM_P6].dir)
+#define P6REN SIM_R8(simPort[SIM_P6].ren)
+#define P6SEL SIM_R8(simPort[SIM_P6].sel)
+#define P6DS SIM_R8(simPort[SIM_P6].ds)
+
+#define P7IN SIM_R8(simPort[SIM_P7].in)
+#define P7OUT SIM_R8(simPort[SIM_P7].out)
+#define P7DIR SIM_R8(simPort[SIM_P7].dir)
+#define P7REN SIM_R8(simPort[SIM_P7].ren)
+#define P7SEL SIM_R8(simPort[SIM_P7].sel)
+#define P7DS SIM_R8(simPort[SIM_P7].ds)
+
+#define P8IN SIM_R8(simPort[SIM_P8].in)
+#define P8OUT SIM_R8(simPort[SIM_P8].out)
+#define P8DIR SIM_R8(simPort[SIM_P8].dir)
+#define P8REN SIM_R8(simPort[SIM_P8].ren)
+#define P8SEL SIM_R8(simPort[SIM_P8].sel)
+#define P8DS SIM_R8(simPort[SIM_P8].ds)
+
+#define PJIN SIM_R8(simPort[SIM_PJ].in)
+#define PJOUT SIM_R8(simPort[SIM_PJ].out)
+#define PJDIR SIM_R8(simPort[SIM_PJ].dir)
+#define PJREN SIM_R8(simPort[SIM_PJ].ren)
+#define PJDS SIM_R8(simPort[SIM_PJ].ds)
+
+#define SIM_CAPTURE_INPUTS { { SIM_TA1, 1, SIM_P2, 0 } }
+#define WDTCTL SIM_R16(simMisc.wdtctl)
+#define WDT_VECTOR (22)
+#define WDTSSEL_0 (0x0000)
+#define WDTSSEL_1 (0x0020)
+#define WDTSSEL_2 (0x0040)
+#define WDTSSEL_3 (0x0060)
+#define WDTTMSEL (0x0010)
+#define WDTCNTCL (0x0008)
+#define WDTIS_0 (0x0000)
+#define WDTIS_1 (0x0001)
+#define WDTIS_2 (0x0002)
+#define WDTIS_3 (0x0003)
+#define WDTIS_4 (0x0004)
+#define WDTIS_5 (0x0005)
+#define WDTIS_6 (0x0006)
+#define WDTIS_7 (0x0007)
+#define WDTIE (0x0001)
+#define WDTIFG (0x0001)
+#define DMA_VECTOR (19)
+#define DMADT_0 (0x0000)
+#define DMADT_1 (0x1000)
+#define DMADT_2 (0x2000)
+#define DMADT_3 (0x3000)
+#define DMADT_4 (0x4000)
+#define DMADT_5 (0x5000)
+#define DMADT_6 (0x6000)
+#define DMADT_7 (0x7000)
+#define DMADSTINCR_0 (0x0000)
+#define DMADSTINCR_1 (0x0400)
+#define DMADSTINCR_2 (0x0800)
+#define DMADSTINCR_3 (0x0C00)
+#define DMASRCINCR_0 (0x0000)
+#define DMASRCINCR_1 (0x0100)
+#define DMASRCINCR_2 (0x0200)
+#define DMASRCINCR_3 (0x0300)
+#define DMADSTBYTE (0x0080)
+#define DMASRCBYTE (0x0040)
+#define DMALEVEL (0x0020)
+#define DMAEN (0x0010)
+#define DMAIFG (0x0008)
+#define DMAIE (0x0004)
+#define DMAABORT (0x0002)
+#define DMAREQ (0x0001)
+#define DMARMWDIS (0x0004)
+#define ROUNDROBIN (0x0002)
+#define ENNMI (0x0001)
+#define SIM_DMA_COUNT 3
+#define SIM_DMA_TRIGGERS { { 1, SIM_TA0, 0 }, { 2, SIM_TA0, 2 }, { 3, SIM_TA1, 0 }, { 4, SIM_TA1, 2 }, { 5, SIM_TA2, 0 } }
+#define DMACTL0 SIM_R16(simDma.ctl[0])
+#define DMACTL1 SIM_R16(simDma.ctl[1])
+#define DMACTL2 SIM_R16(simDma.ctl[2])
+#define DMACTL3 SIM_R16(simDma.ctl[3])
+#define DMACTL4 SIM_R16(simDma.ctl[4])
+#define DMA0CTL SIM_R16(simDma.ch[0].ctl)
+#define DMA0SA (simDma.ch[0].sa)
+#define DMA0DA (simDma.ch[0].da)
+#define DMA0SZ SIM_R16(simDma.ch[0].sz)
+#define DMA0TSEL_0 (0x0000)
+#define DMA0TSEL_1 (0x0001)
+#define DMA0TSEL_2 (0x0002)
+#define DMA0TSEL_3 (0x0003)
+#define DMA0TSEL_4 (0x0004)
+#define DMA0TSEL_5 (0x0005)
+#define DMA0TSEL_6 (0x0006)
+#define DMA0TSEL_7 (0x0007)
+#define DMA0TSEL_8 (0x0008)
+#define DMA0TSEL_9 (0x0009)
+#define DMA0TSEL_10 (0x000A)
+#define DMA0TSEL_11 (0x000B)
+#define DMA0TSEL_12 (0x000C)
+#define DMA0TSEL_13 (0x000D)
+#define DMA0TSEL_14 (0x000E)
+#define DMA0TSEL_15 (0x000F)
+#define DMA0TSEL_16 (0x0010)
+#define DMA0TSEL_17 (0x0011)
+#define DMA0TSEL_18 (0x0012)
+#define DMA0TSEL_19 (0x0013)
+#define DMA0TSEL_20 (0x0014)
+#define DMA0TSEL_21 (0x0015)
+#define DMA0TSEL_22 (0x0016)
+#define DMA0TSEL_23 (0x0017)
+#define DMA0TSEL_24 (0x0018)
+#define DMA0TSEL_25 (0x0019)
+#define DMA0TSEL_26 (0x001A)
+#define DMA0TSEL_27 (0x001B)
+#define DMA0TSEL_28 (0x001C)
+#define DMA0TSEL_29 (0x001D)
+#define DMA0TSEL_30 (0x001E)
+#define DMA0TSEL_31 (0x001F)
+#define DMA1CTL SIM_R16(simDma.ch[1].ctl)
+#define DMA1SA (simDma.ch[1].sa)
+#define DMA1DA (simDma.ch[1].da)
+#define DMA1SZ SIM_R16(simDma.ch[1].sz)
+#define DMA1TSEL_0 (0x0000)
+#define DMA1TSEL_1 (0x0100)
+#define DMA1TSEL_2 (0x0200)
+#define DMA1TSEL_3 (0x0300)
+#define DMA1TSEL_4 (0x0400)
+#define DMA1TSEL_5 (0x0500)
+#define DMA1TSEL_6 (0x0600)
+#define DMA1TSEL_7 (0x0700)
+#define DMA1TSEL_8 (0x0800)
+#define DMA1TSEL_9 (0x0900)
+#define DMA1TSEL_10 (0x0A00)
+#define DMA1TSEL_11 (0x0B00)
+#define DMA1TSEL_12 (0x0C00)
+#define DMA1TSEL_13 (0x0D00)
+#define DMA1TSEL_14 (0x0E00)
+#define DMA1TSEL_15 (0x0F00)
+#define DMA1TSEL_16 (0x1000)
+#define DMA1TSEL_17 (0x1100)
+#define DMA1TSEL_18 (0x1200)
+#define DMA1TSEL_19 (0x1300)
+#define DMA1TSEL_20 (0x1400)
+#define DMA1TSEL_21 (0x1500)
+#define DMA1TSEL_22 (0x1600)
+#define DMA1TSEL_23 (0x1700)
+#define DMA1TSEL_24 (0x1800)
+#define DMA1TSEL_25 (0x1900)
+#define DMA1TSEL_26 (0x1A00)
+#define DMA1TSEL_27 (0x1B00)
+#define DMA1TSEL_28 (0x1C00)
+#define DMA1TSEL_29 (0x1D00)
+#define DMA1TSEL_30 (0x1E00)
+#define DMA1TSEL_31 (0x1F00)
+#define DMA2CTL SIM_R16(simDma.ch[2].ctl)
+#define DMA2SA (simDma.ch[2].sa)
+#define DMA2DA (simDma.ch[2].da)
+#define DMA2SZ SIM_R16(simDma.ch[2].sz)
+#define DMA2TSEL_0 (0x0000)
+#define DMA2TSEL_1 (0x0001)
+#define DMA2TSEL_2 (0x0002)
+#define DMA2TSEL_3 (0x0003)
+#define DMA2TSEL_4 (0x0004)
+#define DMA2TSEL_5 (0x0005)
+#define DMA2TSEL_6 (0x0006)
+#define DMA2TSEL_7 (0x0007)
+#define DMA2TSEL_8 (0x0008)
+#define DMA2TSEL_9 (0x0009)
+#define DMA2TSEL_10 (0x000A)
+#define DMA2TSEL_11 (0x000B)
+#define DMA2TSEL_12 (0x000C)
+#define DMA2TSEL_13 (0x000D)
+#define DMA2TSEL_14 (0x000E)
+#define DMA2TSEL_15 (0x000F)
+#define DMA2TSEL_16 (0x0010)
+#define DMA2TSEL_17 (0x0011)
+#define DMA2TSEL_18 (0x0012)
+#define DMA2TSEL_19 (0x0013)
+#define DMA2TSEL_20 (0x0014)
+#define DMA2TSEL_21 (0x0015)
+#define DMA2TSEL_22 (0x0016)
+#define DMA2TSEL_23 (0x0017)
+#define DMA2TSEL_24 (0x0018)
+#define DMA2TSEL_25 (0x0019)
+#define DMA2TSEL_26 (0x001A)
+#define DMA2TSEL_27 (0x001B)
+#define DMA2TSEL_28 (0x001C)
+#define DMA2TSEL_29 (0x001D)
+#define DMA2TSEL_30 (0x001E)
+#define DMA2TSEL_31 (0x001F)
+#define SFRIE1 SIM_R16(simMisc.sfrie1)
+#define SFRIFG1 SIM_R16(simMisc.sfrifg1)
+#define UCSCTL0 SIM_R16(simMisc.ucsctl[0])
+#define UCSCTL1 SIM_R16(simMisc.ucsctl[1])
+#define UCSCTL2 SIM_R16(simMisc.ucsctl[2])
+#define UCSCTL3 SIM_R16(simMisc.ucsctl[3])
+#define UCSCTL4 SIM_R16(simMisc.ucsctl[4])
+#define UCSCTL5 SIM_R16(simMisc.ucsctl[5])
+#define UCSCTL6 SIM_R16(simMisc.ucsctl[6])
+#define UCSCTL7 SIM_R16(simMisc.ucsctl[7])
+#define UCSCTL8 SIM_R16(simMisc.ucsctl[8])
+#define PMMCTL0 SIM_R16(simMisc.pmmctl0)
+#define PMMCTL0_L SIM_R8(simMisc.pmmctl0_l)
+#define PMMCTL0_H SIM_R8(simMisc.pmmctl0_h)
+#define PMMIFG SIM_R16(simMisc.pmmifg)
+#define SVSMHCTL SIM_R16(simMisc.svsmhctl)
+#define SVSMLCTL SIM_R16(simMisc.svsmlctl)
+#define PMMPW_H (0xA5)
+#define PMMCOREV0 (0x0001)
+#define SVSHE (0x0400)
+#define SVSHRVL0 (0x0100)
+#define SVMHE (0x4000)
+#define SVSMHRRL0 (0x0001)
+#define SVSLE (0x0400)
+#define SVSLRVL0 (0x0100)
+#define SVMLE (0x4000)
+#define SVSMLRRL0 (0x0001)
+#define SVSMLDLYIFG (0x0001)
+#define SVMLIFG (0x0002)
+#define SVMLVLRIFG (0x0004)
+#define SELREF_2 (0x0020)
+#define SELA_2 (0x0200)
+#define SELS_4 (0x0040)
+#define SELM_4 (0x0004)
+#define DCORSEL_5 (0x0050)
+#define DCORSEL_6 (0x0060)
+#define DCORSEL_7 (0x0070)
+#define FLLD_1 (0x1000)
+#define XT2OFFG (0x0008)
+#define XT1LFOFFG (0x0002)
+#define DCOFFG (0x0001)
+#define OFIFG (0x0002)
+#elif defined(__MSP430FR2311__)
+#define SIM_DEVICE "MSP430FR2311"
+#define TBCLGRP_0 (0x0000)
+#define TBCLGRP_1 (0x2000)
+#define TBCLGRP_2 (0x4000)
+#define TBCLGRP_3 (0x6000)
+#define CNTL_0 (0x0000)
+#define CNTL_1 (0x0800)
+#define CNTL_2 (0x1000)
+#define CNTL_3 (0x1800)
+#define TBSSEL_0 (0x0000)
+#define TBSSEL_1 (0x0100)
+#define TBSSEL_2 (0x0200)
+#define TBSSEL_3 (0x0300)
+#define TBCLR (0x0004)
+#define TBIE (0x0002)
+#define TBIFG (0x0001)
+#define CLLD_0 (0x0000)
+#define CLLD_1 (0x0200)
+#define CLLD_2 (0x0400)
+#define CLLD_3 (0x0600)
+#define TBIDEX_0 (0x0000)
+#define TBIDEX_1 (0x0001)
+#define TBIDEX_2 (0x0002)
+#define TBIDEX_3 (0x0003)
+#define TBIDEX_4 (0x0004)
+#define TBIDEX_5 (0x0005)
+#define TBIDEX_6 (0x0006)
+#define TBIDEX_7 (0x0007)
+
+#define SIM_TB0_CCRS 3
+#define TB0CTL SIM_R16(simTimer[SIM_TB0].ctl)
+#define TB0R SIM_R16(simTimer[SIM_TB0].r)
+#define TB0IV simTimerIV(SIM_TB0)
+#define TB0EX0 SIM_R16(simTimer[SIM_TB0].ex0)
+#define TB0CCTL0 SIM_R16(simTimer[SIM_TB0].cctl[0])
+#define TB0CCR0 SIM_R16(simTimer[SIM_TB0].ccr[0])
+#define TB0CCTL1 SIM_R16(simTimer[SIM_TB0].cctl[1])
+#define TB0CCR1 SIM_R16(simTimer[SIM_TB0].ccr[1])
+#define TB0CCTL2 SIM_R16(simTimer[SIM_TB0].cctl[2])
+#define TB0CCR2 SIM_R16(simTimer[SIM_TB0].ccr[2])
+#define TIMER0_B0_VECTOR (28)
+#define TIMER0_B1_VECTOR (27)
+
+#define SIM_TB1_CCRS 3
+#define TB1CTL SIM_R16(simTimer[SIM_TB1].ctl)
+#define TB1R SIM_R16(simTimer[SIM_TB1].r)
+#define TB1IV simTimerIV(SIM_TB1)
+#define TB1EX0 SIM_R16(simTimer[SIM_TB1].ex0)
+#define TB1CCTL0 SIM_R16(simTimer[SIM_TB1].cctl[0])
+#define TB1CCR0 SIM_R16(simTimer[SIM_TB1].ccr[0])
+#define TB1CCTL1 SIM_R16(simTimer[SIM_TB1].cctl[1])
+#define TB1CCR1 SIM_R16(simTimer[SIM_TB1].ccr[1])
+#define TB1CCTL2 SIM_R16(simTimer[SIM_TB1].cctl[2])
+#define TB1CCR2 SIM_R16(simTimer[SIM_TB1].ccr[2])
+#define TIMER1_B0_VECTOR (26)
+#define TIMER1_B1_VECTOR (25)
+
+#define P1IN SIM_R8(simPort[SIM_P1].in)
+#define P1OUT SIM_R8(simPort[SIM_P1].out)
+#define P1DIR SIM_R8(simPort[SIM_P1].dir)
+#define P1REN SIM_R8(simPort[SIM_P1].ren)
+#define P1SEL0 SIM_R8(simPort[SIM_P1].sel0)
+#define P1SEL1 SIM_R8(simPort[SIM_P1].sel1)
+#define P1IES SIM_R8(simPort[SIM_P1].ies)
+#define P1IE SIM_R8(simPort[SIM_P1].ie)
+#define P1IFG SIM_R8(simPort[SIM_P1].ifg)
+#define P1IV simPortIV(SIM_P1)
+#define PORT1_VECTOR (16)
+
+#define P2IN SIM_R8(simPort[SIM_P2].in)
+#define P2OUT SIM_R8(simPort[SIM_P2].out)
+#define P2DIR SIM_R8(simPort[SIM_P2].dir)
+#define P2REN SIM_R8(simPort[SIM_P2].ren)
+#define P2SEL0 SIM_R8(simPort[SIM_P2].sel0)
+#define P2SEL1 SIM_R8(simPort[SIM_P2].sel1)
+#define P2IES SIM_R8(simPort[SIM_P2].ies)
+#define P2IE SIM_R8(simPort[SIM_P2].ie)
+#define P2IFG SIM_R8(simPort[SIM_P2].ifg)
+#define P2IV simPortIV(SIM_P2)
+#define PORT2_VECTOR (9)
+
+#define SIM_CAPTURE_INPUTS { { SIM_TB0, 1, SIM_P1, 6 } }
+#define WDTCTL SIM_R16(simMisc.wdtctl)
+#define WDT_VECTOR (22)
+#define WDTSSEL_0 (0x0000)
+#define WDTSSEL_1 (0x0020)
+#define WDTSSEL_2 (0x0040)
+#define WDTSSEL_3 (0x0060)
+#define WDTTMSEL (0x0010)
+#define WDTCNTCL (0x0008)
+#define WDTIS_0 (0x0000)
+#define WDTIS_1 (0x0001)
+#define WDTIS_2 (0x0002)
+#define WDTIS_3 (0x0003)
+#define WDTIS_4 (0x0004)
+#define WDTIS_5 (0x0005)
+#define WDTIS_6 (0x0006)
+#define WDTIS_7 (0x0007)
+#define WDTIE (0x0001)
+#define WDTIFG (0x0001)
+#define SFRIE1 SIM_R16(simMisc.sfrie1)
+#define SFRIFG1 SIM_R16(simMisc.sfrifg1)
+#define PM5CTL0 SIM_R16(simMisc.pm5ctl0)
+#define FRCTL0 SIM_R16(simMisc.frctl0)
+#define CSCTL0 SIM_R16(simMisc.csctl[0])
+#define CSCTL1 SIM_R16(simMisc.csctl[1])
+#define CSCTL2 SIM_R16(simMisc.csctl[2])
+#define CSCTL3 SIM_R16(simMisc.csctl[3])
+#define CSCTL4 SIM_R16(simMisc.csctl[4])
+#define CSCTL5 SIM_R16(simMisc.csctl[5])
+#define CSCTL6 SIM_R16(simMisc.csctl[6])
+#define CSCTL7 SIM_R16(simMisc.csctl[7])
+#define CSCTL8 SIM_R16(simMisc.csctl[8])
+#define LOCKLPM5 (0x0001)
+#define OFIFG (0x0002)
+#define FRCTLPW (0xA500)
+#define NWAITS_1 (0x0010)
+#define DCORSEL_3 (0x0006)
+#define DCORSEL_5 (0x000A)
+#define DCORSEL_7 (0x000E)
+#define FLLD_0 (0x0000)
+#define SELREF__REFOCLK (0x0010)
+#define FLLUNLOCK0 (0x0100)
+#define FLLUNLOCK1 (0x0200)
+#define SELMS__DCOCLKDIV (0x0000)
+#define SELA__REFOCLK (0x0100)
+#elif defined(__MSP430FR5994__)
+#define SIM_DEVICE "MSP430FR5994"
+#define TASSEL_0 (0x0000)
+#define TASSEL_1 (0x0100)
+#define TASSEL_2 (0x0200)
+#define TASSEL_3 (0x0300)
+#define TACLR (0x0004)
+#define TAIE (0x0002)
+#define TAIFG (0x0001)
+#define TBCLGRP_0 (0x0000)
+#define TBCLGRP_1 (0x2000)
+#define TBCLGRP_2 (0x4000)
+#define TBCLGRP_3 (0x6000)
+#define CNTL_0 (0x0000)
+#define CNTL_1 (0x0800)
+#define CNTL_2 (0x1000)
+#define CNTL_3 (0x1800)
+#define TBSSEL_0 (0x0000)
+#define TBSSEL_1 (0x0100)
+#define TBSSEL_2 (0x0200)
+#define TBSSEL_3 (0x0300)
+#define TBCLR (0x0004)
+#define TBIE (0x0002)
+#define TBIFG (0x0001)
+#define CLLD_0 (0x0000)
+#define CLLD_1 (0x0200)
+#define CLLD_2 (0x0400)
+#define CLLD_3 (0x0600)
+#define TAIDEX_0 (0x0000)
+#define TAIDEX_1 (0x0001)
+#define TAIDEX_2 (0x0002)
+#define TAIDEX_3 (0x0003)
+#define TAIDEX_4 (0x0004)
+#define TAIDEX_5 (0x0005)
+#define TAIDEX_6 (0x0006)
+#define TAIDEX_7 (0x0007)
+#define TBIDEX_0 (0x0000)
+#define TBIDEX_1 (0x0001)
+#define TBIDEX_2 (0x0002)
+#define TBIDEX_3 (0x0003)
+#define TBIDEX_4 (0x0004)
+#define TBIDEX_5 (0x0005)
+#define TBIDEX_6 (0x0006)
+#define TBIDEX_7 (0x0007)
+
+#define SIM_TA0_CCRS 3
+#define TA0CTL SIM_R16(simTimer[SIM_TA0].ctl)
+#define TA0R SIM_R16(simTimer[SIM_TA0].r)
+#define TA0IV simTimerIV(SIM_TA0)
+#define TA0EX0 SIM_R16(simTimer[SIM_TA0].ex0)
+#define TA0CCTL0 SIM_R16(simTimer[SIM_TA0].cctl[0])
+#define TA0CCR0 SIM_R16(simTimer[SIM_TA0].ccr[0])
+#define TA0CCTL1 SIM_R16(simTimer[SIM_TA0].cctl[1])
+#define TA0CCR1 SIM_R16(simTimer[SIM_TA0].ccr[1])
+#define TA0CCTL2 SIM_R16(simTimer[SIM_TA0].cctl[2])
+#define TA0CCR2 SIM_R16(simTimer[SIM_TA0].ccr[2])
+#define TIMER0_A0_VECTOR (21)
+#define TIMER0_A1_VECTOR (20)
+
+#define SIM_TA1_CCRS 3
+#define TA1CTL SIM_R16(simTimer[SIM_TA1].ctl)
+#define TA1R SIM_R16(simTimer[SIM_TA1].r)
+#define TA1IV simTimerIV(SIM_TA1)
+#define TA1EX0 SIM_R16(simTimer[SIM_TA1].ex0)
+#define TA1CCTL0 SIM_R16(simTimer[SIM_TA1].cctl[0])
+#define TA1CCR0 SIM_R16(simTimer[SIM_TA1].ccr[0])
+#define TA1CCTL1 SIM_R16(simTimer[SIM_TA1].cctl[1])
+#define TA1CCR1 SIM_R16(simTimer[SIM_TA1].ccr[1])
+#define TA1CCTL2 SIM_R16(simTimer[SIM_TA1].cctl[2])
+#define TA1CCR2 SIM_R16(simTimer[SIM_TA1].ccr[2])
+#define TIMER1_A0_VECTOR (18)
+#define TIMER1_A1_VECTOR (17)
+
+#define SIM_TA2_CCRS 2
+#define TA2CTL SIM_R16(simTimer[SIM_TA2].ctl)
+#define TA2R SIM_R16(simTimer[SIM_TA2].r)
+#define TA2IV simTimerIV(SIM_TA2)
+#define TA2EX0 SIM_R16(simTimer[SIM_TA2].ex0)
+#define TA2CCTL0 SIM_R16(simTimer[SIM_TA2].cctl[0])
+#define TA2CCR0 SIM_R16(simTimer[SIM_TA2].ccr[0])
+#define TA2CCTL1 SIM_R16(simTimer[SIM_TA2].cctl[1])
+#define TA2CCR1 SIM_R16(simTimer[SIM_TA2].ccr[1])
+#define TIMER2_A0_VECTOR (15)
+#define TIMER2_A1_VECTOR (14)
+
+#define SIM_TA3_CCRS 5
+#define TA3CTL SIM_R16(simTimer[SIM_TA3].ctl)
+#define TA3R SIM_R16(simTimer[SIM_TA3].r)
+#define TA3IV simTimerIV(SIM_TA3)
+#define TA3EX0 SIM_R16(simTimer[SIM_TA3].ex0)
+#define TA3CCTL0 SIM_R16(simTimer[SIM_TA3].cctl[0])
+#define TA3CCR0 SIM_R16(simTimer[SIM_TA3].ccr[0])
+#define TA3CCTL1 SIM_R16(simTimer[SIM_TA3].cctl[1])
+#define TA3CCR1 SIM_R16(simTimer[SIM_TA3].ccr[1])
+#define TA3CCTL2 SIM_R16(simTimer[SIM_TA3].cctl[2])
+#define TA3CCR2 SIM_R16(simTimer[SIM_TA3].ccr[2])
+#define TA3CCTL3 SIM_R16(simTimer[SIM_TA3].cctl[3])
+#define TA3CCR3 SIM_R16(simTimer[SIM_TA3].ccr[3])
+#define TA3CCTL4 SIM_R16(simTimer[SIM_TA3].cctl[4])
+#define TA3CCR4 SIM_R16(simTimer[SIM_TA3].ccr[4])
+#define TIMER3_A0_VECTOR (13)
+#define TIMER3_A1_VECTOR (12)
+
+#define SIM_TA4_CCRS 3
+#define TA4CTL SIM_R16(simTimer[SIM_TA4].ctl)
+#define TA4R SIM_R16(simTimer[SIM_TA4].r)
+#define TA4IV simTimerIV(SIM_TA4)
+#define TA4EX0 SIM_R16(simTimer[SIM_TA4].ex0)
+#define TA4CCTL0 SIM_R16(simTimer[SIM_TA4].cctl[0])
+#define TA4CCR0 SIM_R16(simTimer[SIM_TA4].ccr[0])
+#define TA4CCTL1 SIM_R16(simTimer[SIM_TA4].cctl[1])
+#define TA4CCR1 SIM_R16(simTimer[SIM_TA4].ccr[1])
+#define TA4CCTL2 SIM_R16(simTimer[SIM_TA4].cctl[2])
+#define TA4CCR2 SIM_R16(simTimer[SIM_TA4].ccr[2])
+#define TIMER4_A0_VECTOR (11)
+#define TIMER4_A1_VECTOR (10)
+
+#define SIM_TB0_CCRS 7
+#define TB0CTL SIM_R16(simTimer[SIM_TB0].ctl)
+#define TB0R SIM_R16(simTimer[SIM_TB0].r)
+#define TB0IV simTimerIV(SIM_TB0)
+#define TB0EX0 SIM_R16(simTimer[SIM_TB0].ex0)
+#define TB0CCTL0 SIM_R16(simTimer[SIM_TB0].cctl[0])
+#define TB0CCR0 SIM_R16(simTimer[SIM_TB0].ccr[0])
+#define TB0CCTL1 SIM_R16(simTimer[SIM_TB0].cctl[1])
+#define TB0CCR1 SIM_R16(simTimer[SIM_TB0].ccr[1])
+#define TB0CCTL2 SIM_R16(simTimer[SIM_TB0].cctl[2])
+#define TB0CCR2 SIM_R16(simTimer[SIM_TB0].ccr[2])
+#define TB0CCTL3 SIM_R16(simTimer[SIM_TB0].cctl[3])
+#define TB0CCR3 SIM_R16(simTimer[SIM_TB0].ccr[3])
+#define TB0CCTL4 SIM_R16(simTimer[SIM_TB0].cctl[4])
+#define TB0CCR4 SIM_R16(simTimer[SIM_TB0].ccr[4])
+#define TB0CCTL5 SIM_R16(simTimer[SIM_TB0].cctl[5])
+#define TB0CCR5 SIM_R16(simTimer[SIM_TB0].ccr[5])
+#define TB0CCTL6 SIM_R16(simTimer[SIM_TB0].cctl[6])
+#define TB0CCR6 SIM_R16(simTimer[SIM_TB0].ccr[6])
+#define TIMER0_B0_VECTOR (28)
+#define TIMER0_B1_VECTOR (27)
+
+#define P1IN SIM_R8(simPort[SIM_P1].in)
+#define P1OUT SIM_R8(simPort[SIM_P1].out)
+#define P1DIR SIM_R8(simPort[SIM_P1].dir)
+#define P1REN SIM_R8(simPort[SIM_P1].ren)
+#define P1SEL0 SIM_R8(simPort[SIM_P1].sel0)
+#define P1SEL1 SIM_R8(simPort[SIM_P1].sel1)
+#define P1IES SIM_R8(simPort[SIM_P1].ies)
+#define P1IE SIM_R8(simPort[SIM_P1].ie)
+#define P1IFG SIM_R8(simPort[SIM_P1].ifg)
+#define P1IV simPortIV(SIM_P1)
+#define PORT1_VECTOR (16)
+
+#define P2IN SIM_R8(simPort[SIM_P2].in)
+#define P2OUT SIM_R8(simPort[SIM_P2].out)
+#define P2DIR SIM_R8(simPort[SIM_P2].dir)
+#define P2REN SIM_R8(simPort[SIM_P2].ren)
+#define P2SEL0 SIM_R8(simPort[SIM_P2].sel0)
+#define P2SEL1 SIM_R8(simPort[SIM_P2].sel1)
+#define P2IES SIM_R8(simPort[SIM_P2].ies)
+#define P2IE SIM_R8(simPort[SIM_P2].ie)
+#define P2IFG SIM_R8(simPort[SIM_P2].ifg)
+#define P2IV simPortIV(SIM_P2)
+#define PORT2_VECTOR (9)
+
+#define P3IN SIM_R8(simPort[SIM_P3].in)
+#define P3OUT SIM_R8(simPort[SIM_P3].out)
+#define P3DIR SIM_R8(simPort[SIM_P3].dir)
+#define P3REN SIM_R8(simPort[SIM_P3].ren)
+#define P3SEL0 SIM_R8(simPort[SIM_P3].sel0)
+#define P3SEL1 SIM_R8(simPort[SIM_P3].sel1)
+#define P3IES SIM_R8(simPort[SIM_P3].ies)
+#define P3IE SIM_R8(simPort[SIM_P3].ie)
+#define P3IFG SIM_R8(simPort[SIM_P3].ifg)
+#define P3IV simPortIV(SIM_P3)
+#define PORT3_VECTOR (8)
+
+#define P4IN SIM_R8(simPort[SIM_P4].in)
+#define P4OUT SIM_R8(simPort[SIM_P4].out)
+#define P4DIR SIM_R8(simPort[SIM_P4].dir)
+#define P4REN SIM_R8(simPort[SIM_P4].ren)
+#define P4SEL0 SIM_R8(simPort[SIM_P4].sel0)
+#define P4SEL1 SIM_R8(simPort[SIM_P4].sel1)
+#define P4IES SIM_R8(simPort[SIM_P4].ies)
+#define P4IE SIM_R8(simPort[SIM_P4].ie)
+#define P4IFG SIM_R8(simPort[SIM_P4].ifg)
+#define P4IV simPortIV(SIM_P4)
+#define PORT4_VECTOR (7)
+
+#define P5IN SIM_R8(simPort[SIM_P5].in)
+#define P5OUT SIM_R8(simPort[SIM_P5].out)
+#define P5DIR SIM_R8(simPort[SIM_P5].dir)
+#define P5REN SIM_R8(simPort[SIM_P5].ren)
+#define P5SEL0 SIM_R8(simPort[SIM_P5].sel0)
+#define P5SEL1 SIM_R8(simPort[SIM_P5].sel1)
+#define P5IES SIM_R8(simPort[SIM_P5].ies)
+#define P5IE SIM_R8(simPort[SIM_P5].ie)
+#define P5IFG SIM_R8(simPort[SIM_P5].ifg)
+#define P5IV simPortIV(SIM_P5)
+#define PORT5_VECTOR (6)
+
+#define P6IN SIM_R8(simPort[SIM_P6].in)
+#define P6OUT SIM_R8(simPort[SIM_P6].out)
+#define P6DIR SIM_R8(simPort[SIM_P6].dir)
+#define P6REN SIM_R8(simPort[SIM_P6].ren)
+#define P6SEL0 SIM_R8(simPort[SIM_P6].sel0)
+#define P6SEL1 SIM_R8(simPort[SIM_P6].sel1)
+#define P6IES SIM_R8(simPort[SIM_P6].ies)
+#define P6IE SIM_R8(simPort[SIM_P6].ie)
+#define P6IFG SIM_R8(simPort[SIM_P6].ifg)
+#define P6IV simPortIV(SIM_P6)
+#define PORT6_VECTOR (5)
+
+#define P7IN SIM_R8(simPort[SIM_P7].in)
+#define P7OUT SIM_R8(simPort[SIM_P7].out)
+#define P7DIR SIM_R8(simPort[SIM_P7].dir)
+#define P7REN SIM_R8(simPort[SIM_P7].ren)
+#define P7SEL0 SIM_R8(simPort[SIM_P7].sel0)
+#define P7SEL1 SIM_R8(simPort[SIM_P7].sel1)
+#define P7IES SIM_R8(simPort[SIM_P7].ies)
+#define P7IE SIM_R8(simPort[SIM_P7].ie)
+#define P7IFG SIM_R8(simPort[SIM_P7].ifg)
+#define P7IV simPortIV(SIM_P7)
+#define PORT7_VECTOR (4)
+
+#define P8IN SIM_R8(simPort[SIM_P8].in)
+#define P8OUT SIM_R8(simPort[SIM_P8].out)
+#define P8DIR SIM_R8(simPort[SIM_P8].dir)
+#define P8REN SIM_R8(simPort[SIM_P8].ren)
+#define P8SEL0 SIM_R8(simPort[SIM_P8].sel0)
+#define P8SEL1 SIM_R8(simPort[SIM_P8].sel1)
+#define P8IES SIM_R8(simPort[SIM_P8].ies)
+#define P8IE SIM_R8(simPort[SIM_P8].ie)
+#define P8IFG SIM_R8(simPort[SIM_P8].ifg)
+#define P8IV simPortIV(SIM_P8)
+#define PORT8_VECTOR (3)
+
+#define PJIN SIM_R8(simPort[SIM_PJ].in)
+#define PJOUT SIM_R8(simPort[SIM_PJ].out)
+#define PJDIR SIM_R8(simPort[SIM_PJ].dir)
+#define PJREN SIM_R8(simPort[SIM_PJ].ren)
+#define PJSEL0 SIM_R8(simPort[SIM_PJ].sel0)
+#define PJSEL1 SIM_R8(simPort[SIM_PJ].sel1)
+
+#define SIM_CAPTURE_INPUTS { { SIM_TA1, 1, SIM_P1, 2 } }
+#define WDTCTL SIM_R16(simMisc.wdtctl)
+#define WDT_VECTOR (22)
+#define WDTSSEL_0 (0x0000)
+#define WDTSSEL_1 (0x0020)
+#define WDTSSEL_2 (0x0040)
+#define WDTSSEL_3 (0x0060)
+#define WDTTMSEL (0x0010)
+#define WDTCNTCL (0x0008)
+#define WDTIS_0 (0x0000)
+#define WDTIS_1 (0x0001)
+#define WDTIS_2 (0x0002)
+#define WDTIS_3 (0x0003)
+#define WDTIS_4 (0x0004)
+#define WDTIS_5 (0x0005)
+#define WDTIS_6 (0x0006)
+#define WDTIS_7 (0x0007)
+#define WDTIE (0x0001)
+#define WDTIFG (0x0001)
+#define DMA_VECTOR (19)
+#define DMADT_0 (0x0000)
+#define DMADT_1 (0x1000)
+#define DMADT_2 (0x2000)
+#define DMADT_3 (0x3000)
+#define DMADT_4 (0x4000)
+#define DMADT_5 (0x5000)
+#define DMADT_6 (0x6000)
+#define DMADT_7 (0x7000)
+#define DMADSTINCR_0 (0x0000)
+#define DMADSTINCR_1 (0x0400)
+#define DMADSTINCR_2 (0x0800)
+#define DMADSTINCR_3 (0x0C00)
+#define DMASRCINCR_0 (0x0000)
+#define DMASRCINCR_1 (0x0100)
+#define DMASRCINCR_2 (0x0200)
+#define DMASRCINCR_3 (0x0300)
+#define DMADSTBYTE (0x0080)
+#define DMASRCBYTE (0x0040)
+#define DMALEVEL (0x0020)
+#define DMAEN (0x0010)
+#define DMAIFG (0x0008)
+#define DMAIE (0x0004)
+#define DMAABORT (0x0002)
+#define DMAREQ (0x0001)
+#define DMARMWDIS (0x0004)
+#define ROUNDROBIN (0x0002)
+#define ENNMI (0x0001)
+#define SIM_DMA_COUNT 6
+#define SIM_DMA_TRIGGERS { { 1, SIM_TA0, 0 }, { 2, SIM_TA0, 2 }, { 3, SIM_TA1, 0 }, { 4, SIM_TA1, 2 }, { 5, SIM_TA2, 0 } }
+#define DMACTL0 SIM_R16(simDma.ctl[0])
+#define DMACTL1 SIM_R16(simDma.ctl[1])
+#define DMACTL2 SIM_R16(simDma.ctl[2])
+#define DMACTL3 SIM_R16(simDma.ctl[3])
+#define DMACTL4 SIM_R16(simDma.ctl[4])
+#define DMA0CTL SIM_R16(simDma.ch[0].ctl)
+#define DMA0SA (simDma.ch[0].sa)
+#define DMA0DA (simDma.ch[0].da)
+#define DMA0SZ SIM_R16(simDma.ch[0].sz)
+#define DMA0TSEL_0 (0x0000)
+#define DMA0TSEL_1 (0x0001)
+#define DMA0TSEL_2 (0x0002)
+#define DMA0TSEL_3 (0x0003)
+#define DMA0TSEL_4 (0x0004)
+#define DMA0TSEL_5 (0x0005)
+#define DMA0TSEL_6 (0x0006)
+#define DMA0TSEL_7 (0x0007)
+#define DMA0TSEL_8 (0x0008)
+#define DMA0TSEL_9 (0x0009)
+#define DMA0TSEL_10 (0x000A)
+#define DMA0TSEL_11 (0x000B)
+#define DMA0TSEL_12 (0x000C)
+#define DMA0TSEL_13 (0x000D)
+#define DMA0TSEL_14 (0x000E)
+#define DMA0TSEL_15 (0x000F)
+#define DMA0TSEL_16 (0x0010)
+#define DMA0TSEL_17 (0x0011)
+#define DMA0TSEL_18 (0x0012)
+#define DMA0TSEL_19 (0x0013)
+#define DMA0TSEL_20 (0x0014)
+#define DMA0TSEL_21 (0x0015)
+#define DMA0TSEL_22 (0x0016)
+#define DMA0TSEL_23 (0x0017)
+#define DMA0TSEL_24 (0x0018)
+#define DMA0TSEL_25 (0x0019)
+#define DMA0TSEL_26 (0x001A)
+#define DMA0TSEL_27 (0x001B)
+#define DMA0TSEL_28 (0x001C)
+#define DMA0TSEL_29 (0x001D)
+#define DMA0TSEL_30 (0x001E)
+#define DMA0TSEL_31 (0x001F)
+#define DMA1CTL SIM_R16(simDma.ch[1].ctl)
+#define DMA1SA (simDma.ch[1].sa)
+#define DMA1DA (simDma.ch[1].da)
+#define DMA1SZ SIM_R16(simDma.ch[1].sz)
+#define DMA1TSEL_0 (0x0000)
+#define DMA1TSEL_1 (0x0100)
+#define DMA1TSEL_2 (0x0200)
+#define DMA1TSEL_3 (0x0300)
+#define DMA1TSEL_4 (0x0400)
+#define DMA1TSEL_5 (0x0500)
+#define DMA1TSEL_6 (0x0600)
+#define DMA1TSEL_7 (0x0700)
+#define DMA1TSEL_8 (0x0800)
+#define DMA1TSEL_9 (0x0900)
+#define DMA1TSEL_10 (0x0A00)
+#define DMA1TSEL_11 (0x0B00)
+#define DMA1TSEL_12 (0x0C00)
+#define DMA1TSEL_13 (0x0D00)
+#define DMA1TSEL_14 (0x0E00)
+#define DMA1TSEL_15 (0x0F00)
+#define DMA1TSEL_16 (0x1000)
+#define DMA1TSEL_17 (0x1100)
+#define DMA1TSEL_18 (0x1200)
+#define DMA1TSEL_19 (0x1300)
+#define DMA1TSEL_20 (0x1400)
+#define DMA1TSEL_21 (0x1500)
+#define DMA1TSEL_22 (0x1600)
+#define DMA1TSEL_23 (0x1700)
+#define DMA1TSEL_24 (0x1800)
+#define DMA1TSEL_25 (0x1900)
+#define DMA1TSEL_26 (0x1A00)
+#define DMA1TSEL_27 (0x1B00)
+#define DMA1TSEL_28 (0x1C00)
+#define DMA1TSEL_29 (0x1D00)
+#define DMA1TSEL_30 (0x1E00)
+#define DMA1TSEL_31 (0x1F00)
+#define DMA2CTL SIM_R16(simDma.ch[2].ctl)
+#define DMA2SA (simDma.ch[2].sa)
+#define DMA2DA (simDma.ch[2].da)
+#define DMA2SZ SIM_R16(simDma.ch[2].sz)
+#define DMA2TSEL_0 (0x0000)
+#define DMA2TSEL_1 (0x0001)
+#define DMA2TSEL_2 (0x0002)
+#define DMA2TSEL_3 (0x0003)
+#define DMA2TSEL_4 (0x0004)
+#define DMA2TSEL_5 (0x0005)
+#define DMA2TSEL_6 (0x0006)
+#define DMA2TSEL_7 (0x0007)
+#define DMA2TSEL_8 (0x0008)
+#define DMA2TSEL_9 (0x0009)
+#define DMA2TSEL_10 (0x000A)
+#define DMA2TSEL_11 (0x000B)
+#define DMA2TSEL_12 (0x000C)
+#define DMA2TSEL_13 (0x000D)
+#define DMA2TSEL_14 (0x000E)
+#define DMA2TSEL_15 (0x000F)
+#define DMA2TSEL_16 (0x0010)
+#define DMA2TSEL_17 (0x0011)
+#define DMA2TSEL_18 (0x0012)
+#define DMA2TSEL_19 (0x0013)
+#define DMA2TSEL_20 (0x0014)
+#define DMA2TSEL_21 (0x0015)
+#define DMA2TSEL_22 (0x0016)
+#define DMA2TSEL_23 (0x0017)
+#define DMA2TSEL_24 (0x0018)
+#define DMA2TSEL_25 (0x0019)
+#define DMA2TSEL_26 (0x001A)
+#define DMA2TSEL_27 (0x001B)
+#define DMA2TSEL_28 (0x001C)
+#define DMA2TSEL_29 (0x001D)
+#define DMA2TSEL_30 (0x001E)
+#define DMA2TSEL_31 (0x001F)
+#define DMA3CTL SIM_R16(simDma.ch[3].ctl)
+#define DMA3SA (simDma.ch[3].sa)
+#define DMA3DA (simDma.ch[3].da)
+#define DMA3SZ SIM_R16(simDma.ch[3].sz)
+#define DMA3TSEL_0 (0x0000)
+#define DMA3TSEL_1 (0x0100)
+#define DMA3TSEL_2 (0x0200)
+#define DMA3TSEL_3 (0x0300)
+#define DMA3TSEL_4 (0x0400)
+#define DMA3TSEL_5 (0x0500)
+#define DMA3TSEL_6 (0x0600)
+#define DMA3TSEL_7 (0x0700)
+#define DMA3TSEL_8 (0x0800)
+#define DMA3TSEL_9 (0x0900)
+#define DMA3TSEL_10 (0x0A00)
+#define DMA3TSEL_11 (0x0B00)
+#define DMA3TSEL_12 (0x0C00)
+#define DMA3TSEL_13 (0x0D00)
+#define DMA3TSEL_14 (0x0E00)
+#define DMA3TSEL_15 (0x0F00)
+#define DMA3TSEL_16 (0x1000)
+#define DMA3TSEL_17 (0x1100)
+#define DMA3TSEL_18 (0x1200)
+#define DMA3TSEL_19 (0x1300)
+#define DMA3TSEL_20 (0x1400)
+#define DMA3TSEL_21 (0x1500)
+#define DMA3TSEL_22 (0x1600)
+#define DMA3TSEL_23 (0x1700)
+#define DMA3TSEL_24 (0x1800)
+#define DMA3TSEL_25 (0x1900)
+#define DMA3TSEL_26 (0x1A00)
+#define DMA3TSEL_27 (0x1B00)
+#define DMA3TSEL_28 (0x1C00)
+#define DMA3TSEL_29 (0x1D00)
+#define DMA3TSEL_30 (0x1E00)
+#define DMA3TSEL_31 (0x1F00)
+#define DMA4CTL SIM_R16(simDma.ch[4].ctl)
+#define DMA4SA (simDma.ch[4].sa)
+#define DMA4DA (simDma.ch[4].da)
+#define DMA4SZ SIM_R16(simDma.ch[4].sz)
+#define DMA4TSEL_0 (0x0000)
+#define DMA4TSEL_1 (0x0001)
+#define DMA4TSEL_2 (0x0002)
+#define DMA4TSEL_3 (0x0003)
+#define DMA4TSEL_4 (0x0004)
+#define DMA4TSEL_5 (0x0005)
+#define DMA4TSEL_6 (0x0006)
+#define DMA4TSEL_7 (0x0007)
+#define DMA4TSEL_8 (0x0008)
+#define DMA4TSEL_9 (0x0009)
+#define DMA4TSEL_10 (0x000A)
+#define DMA4TSEL_11 (0x000B)
+#define DMA4TSEL_12 (0x000C)
+#define DMA4TSEL_13 (0x000D)
+#define DMA4TSEL_14 (0x000E)
+#define DMA4TSEL_15 (0x000F)
+#define DMA4TSEL_16 (0x0010)
+#define DMA4TSEL_17 (0x0011)
+#define DMA4TSEL_18 (0x0012)
+#define DMA4TSEL_19 (0x0013)
+#define DMA4TSEL_20 (0x0014)
+#define DMA4TSEL_21 (0x0015)
+#define DMA4TSEL_22 (0x0016)
+#define DMA4TSEL_23 (0x0017)
+#define DMA4TSEL_24 (0x0018)
+#define DMA4TSEL_25 (0x0019)
+#define DMA4TSEL_26 (0x001A)
+#define DMA4TSEL_27 (0x001B)
+#define DMA4TSEL_28 (0x001C)
+#define DMA4TSEL_29 (0x001D)
+#define DMA4TSEL_30 (0x001E)
+#define DMA4TSEL_31 (0x001F)
+#define DMA5CTL SIM_R16(simDma.ch[5].ctl)
+#define DMA5SA (simDma.ch[5].sa)
+#define DMA5DA (simDma.ch[5].da)
+#define DMA5SZ SIM_R16(simDma.ch[5].sz)
+#define DMA5TSEL_0 (0x0000)
+#define DMA5TSEL_1 (0x0100)
+#define DMA5TSEL_2 (0x0200)
+#define DMA5TSEL_3 (0x0300)
+#define DMA5TSEL_4 (0x0400)
+#define DMA5TSEL_5 (0x0500)
+#define DMA5TSEL_6 (0x0600)
+#define DMA5TSEL_7 (0x0700)
+#define DMA5TSEL_8 (0x0800)
+#define DMA5TSEL_9 (0x0900)
+#define DMA5TSEL_10 (0x0A00)
+#define DMA5TSEL_11 (0x0B00)
+#define DMA5TSEL_12 (0x0C00)
+#define DMA5TSEL_13 (0x0D00)
+#define DMA5TSEL_14 (0x0E00)
+#define DMA5TSEL_15 (0x0F00)
+#define DMA5TSEL_16 (0x1000)
+#define DMA5TSEL_17 (0x1100)
+#define DMA5TSEL_18 (0x1200)
+#define DMA5TSEL_19 (0x1300)
+#define DMA5TSEL_20 (0x1400)
+#define DMA5TSEL_21 (0x1500)
+#define DMA5TSEL_22 (0x1600)
+#define DMA5TSEL_23 (0x1700)
+#define DMA5TSEL_24 (0x1800)
+#define DMA5TSEL_25 (0x1900)
+#define DMA5TSEL_26 (0x1A00)
+#define DMA5TSEL_27 (0x1B00)
+#define DMA5TSEL_28 (0x1C00)
+#define DMA5TSEL_29 (0x1D00)
+#define DMA5TSEL_30 (0x1E00)
+#define DMA5TSEL_31 (0x1F00)
+#define SFRIE1 SIM_R16(simMisc.sfrie1)
+#define SFRIFG1 SIM_R16(simMisc.sfrifg1)
+#define PM5CTL0 SIM_R16(simMisc.pm5ctl0)
+#define FRCTL0 SIM_R16(simMisc.frctl0)
+#define CSCTL0 SIM_R16(simMisc.csctl[0])
+#define CSCTL0_H SIM_R8(simMisc.csctl0_h)
+#define CSCTL1 SIM_R16(simMisc.csctl[1])
+#define CSCTL2 SIM_R16(simMisc.csctl[2])
+#define CSCTL3 SIM_R16(simMisc.csctl[3])
+#define CSCTL4 SIM_R16(simMisc.csctl[4])
+#define CSCTL5 SIM_R16(simMisc.csctl[5])
+#define CSCTL6 SIM_R16(simMisc.csctl[6])
+#define LOCKLPM5 (0x0001)
+#define OFIFG (0x0002)
+#define FRCTLPW (0xA500)
+#define NWAITS_1 (0x0010)
+#define CSKEY_H (0xA5)
+#define DCORSEL (0x0040)
+#define DCOFSEL_0 (0x0000)
+#define DCOFSEL_4 (0x0008)
+#define DCOFSEL_6 (0x000C)
+#define SELA__LFXTCLK (0x0000)
+#define SELS__DCOCLK (0x0030)
+#define SELM__DCOCLK (0x0003)
+#define DIVA__1 (0x0000)
+#define DIVS__1 (0x0000)
+#define DIVM__1 (0x0000)
+#define DIVA__4 (0x0200)
+#define DIVS__4 (0x0020)
+#define DIVM__4 (0x0002)
+#define LFXTOFF (0x0001)
+#define LFXTOFFG (0x0001)
+#elif defined(__MSP430FR6989__)
+#define SIM_DEVICE "MSP430FR6989"
+#define TASSEL_0 (0x0000)
+#define TASSEL_1 (0x0100)
+#define TASSEL_2 (0x0200)
+#define TASSEL_3 (0x0300)
+#define TACLR (0x0004)
+#define TAIE (0x0002)
+#define TAIFG (0x0001)
+#define TBCLGRP_0 (0x0000)
+#define TBCLGRP_1 (0x2000)
+#define TBCLGRP_2 (0x4000)
+#define TBCLGRP_3 (0x6000)
+#define CNTL_0 (0x0000)
+#define CNTL_1 (0x0800)
+#define CNTL_2 (0x1000)
+#define CNTL_3 (0x1800)
+#define TBSSEL_0 (0x0000)
+#define TBSSEL_1 (0x0100)
+#define TBSSEL_2 (0x0200)
+#define TBSSEL_3 (0x0300)
+#define TBCLR (0x0004)
+#define TBIE (0x0002)
+#define TBIFG (0x0001)
+#define CLLD_0 (0x0000)
+#define CLLD_1 (0x0200)
+#define CLLD_2 (0x0400)
+#define CLLD_3 (0x0600)
+#define TAIDEX_0 (0x0000)
+#define TAIDEX_1 (0x0001)
+#define TAIDEX_2 (0x0002)
+#define TAIDEX_3 (0x0003)
+#define TAIDEX_4 (0x0004)
+#define TAIDEX_5 (0x0005)
+#define TAIDEX_6 (0x0006)
+#define TAIDEX_7 (0x0007)
+#define TBIDEX_0 (0x0000)
+#define TBIDEX_1 (0x0001)
+#define TBIDEX_2 (0x0002)
+#define TBIDEX_3 (0x0003)
+#define TBIDEX_4 (0x0004)
+#define TBIDEX_5 (0x0005)
+#define TBIDEX_6 (0x0006)
+#define TBIDEX_7 (0x0007)
+
+#define SIM_TA0_CCRS 3
+#define TA0CTL SIM_R16(simTimer[SIM_TA0].ctl)
+#define TA0R SIM_R16(simTimer[SIM_TA0].r)
+#define TA0IV simTimerIV(SIM_TA0)
+#define TA0EX0 SIM_R16(simTimer[SIM_TA0].ex0)
+#define TA0CCTL0 SIM_R16(simTimer[SIM_TA0].cctl[0])
+#define TA0CCR0 SIM_R16(simTimer[SIM_TA0].ccr[0])
+#define TA0CCTL1 SIM_R16(simTimer[SIM_TA0].cctl[1])
+#define TA0CCR1 SIM_R16(simTimer[SIM_TA0].ccr[1])
+#define TA0CCTL2 SIM_R16(simTimer[SIM_TA0].cctl[2])
+#define TA0CCR2 SIM_R16(simTimer[SIM_TA0].ccr[2])
+#define TIMER0_A0_VECTOR (21)
+#define TIMER0_A1_VECTOR (20)
+
+#define SIM_TA1_CCRS 3
+#define TA1CTL SIM_R16(simTimer[SIM_TA1].ctl)
+#define TA1R SIM_R16(simTimer[SIM_TA1].r)
+#define TA1IV simTimerIV(SIM_TA1)
+#define TA1EX0 SIM_R16(simTimer[SIM_TA1].ex0)
+#define TA1CCTL0 SIM_R16(simTimer[SIM_TA1].cctl[0])
+#define TA1CCR0 SIM_R16(simTimer[SIM_TA1].ccr[0])
+#define TA1CCTL1 SIM_R16(simTimer[SIM_TA1].cctl[1])
+#define TA1CCR1 SIM_R16(simTimer[SIM_TA1].ccr[1])
+#define TA1CCTL2 SIM_R16(simTimer[SIM_TA1].cctl[2])
+#define TA1CCR2 SIM_R16(simTimer[SIM_TA1].ccr[2])
+#define TIMER1_A0_VECTOR (18)
+#define TIMER1_A1_VECTOR (17)
+
+#define SIM_TA2_CCRS 2
+#define TA2CTL SIM_R16(simTimer[SIM_TA2].ctl)
+#define TA2R SIM_R16(simTimer[SIM_TA2].r)
+#define TA2IV simTimerIV(SIM_TA2)
+#define TA2EX0 SIM_R16(simTimer[SIM_TA2].ex0)
+#define TA2CCTL0 SIM_R16(simTimer[SIM_TA2].cctl[0])
+#define TA2CCR0 SIM_R16(simTimer[SIM_TA2].ccr[0])
+#define TA2CCTL1 SIM_R16(simTimer[SIM_TA2].cctl[1])
+#define TA2CCR1 SIM_R16(simTimer[SIM_TA2].ccr[1])
+#define TIMER2_A0_VECTOR (15)
+#define TIMER2_A1_VECTOR (14)
+
+#define SIM_TA3_CCRS 5
+#define TA3CTL SIM_R16(simTimer[SIM_TA3].ctl)
+#define TA3R SIM_R16(simTimer[SIM_TA3].r)
+#define TA3IV simTimerIV(SIM_TA3)
+#define TA3EX0 SIM_R16(simTimer[SIM_TA3].ex0)
+#define TA3CCTL0 SIM_R16(simTimer[SIM_TA3].cctl[0])
+#define TA3CCR0 SIM_R16(simTimer[SIM_TA3].ccr[0])
+#define TA3CCTL1 SIM_R16(simTimer[SIM_TA3].cctl[1])
+#define TA3CCR1 SIM_R16(simTimer[SIM_TA3].ccr[1])
+#define TA3CCTL2 SIM_R16(simTimer[SIM_TA3].cctl[2])
+#define TA3CCR2 SIM_R16(simTimer[SIM_TA3].ccr[2])
+#define TA3CCTL3 SIM_R16(simTimer[SIM_TA3].cctl[3])
+#define TA3CCR3 SIM_R16(simTimer[SIM_TA3].ccr[3])
+#define TA3CCTL4 SIM_R16(simTimer[SIM_TA3].cctl[4])
+#define TA3CCR4 SIM_R16(simTimer[SIM_TA3].ccr[4])
+#define TIMER3_A0_VECTOR (13)
+#define TIMER3_A1_VECTOR (12)
+
+#define SIM_TB0_CCRS 7
+#define TB0CTL SIM_R16(simTimer[SIM_TB0].ctl)
+#define TB0R SIM_R16(simTimer[SIM_TB0].r)
+#define TB0IV simTimerIV(SIM_TB0)
+#define TB0EX0 SIM_R16(simTimer[SIM_TB0].ex0)
+#define TB0CCTL0 SIM_R16(simTimer[SIM_TB0].cctl[0])
+#define TB0CCR0 SIM_R16(simTimer[SIM_TB0].ccr[0])
+#define TB0CCTL1 SIM_R16(simTimer[SIM_TB0].cctl[1])
+#define TB0CCR1 SIM_R16(simTimer[SIM_TB0].ccr[1])
+#define TB0CCTL2 SIM_R16(simTimer[SIM_TB0].cctl[2])
+#define TB0CCR2 SIM_R16(simTimer[SIM_TB0].ccr[2])
+#define TB0CCTL3 SIM_R16(simTimer[SIM_TB0].cctl[3])
+#define TB0CCR3 SIM_R16(simTimer[SIM_TB0].ccr[3])
+#define TB0CCTL4 SIM_R16(simTimer[SIM_TB0].cctl[4])
+#define TB0CCR4 SIM_R16(simTimer[SIM_TB0].ccr[4])
+#define TB0CCTL5 SIM_R16(simTimer[SIM_TB0].cctl[5])
+#define TB0CCR5 SIM_R16(simTimer[SIM_TB0].ccr[5])
+#define TB0CCTL6 SIM_R16(simTimer[SIM_TB0].cctl[6])
+#define TB0CCR6 SIM_R16(simTimer[SIM_TB0].ccr[6])
+#define TIMER0_B0_VECTOR (28)
+#define TIMER0_B1_VECTOR (27)
+
+#define P1IN SIM_R8(simPort[SIM_P1].in)
+#define P1OUT SIM_R8(simPort[SIM_P1].out)
+#define P1DIR SIM_R8(simPort[SIM_P1].dir)
+#define P1REN SIM_R8(simPort[SIM_P1].ren)
+#define P1SEL0 SIM_R8(simPort[SIM_P1].sel0)
+#define P1SEL1 SIM_R8(simPort[SIM_P1].sel1)
+#define P1IES SIM_R8(simPort[SIM_P1].ies)
+#define P1IE SIM_R8(simPort[SIM_P1].ie)
+#define P1IFG SIM_R8(simPort[SIM_P1].ifg)
+#define P1IV simPortIV(SIM_P1)
+#define PORT1_VECTOR (16)
+
+#define P2IN SIM_R8(simPort[SIM_P2].in)
+#define P2OUT SIM_R8(simPort[SIM_P2].out)
+#define P2DIR SIM_R8(simPort[SIM_P2].dir)
+#define P2REN SIM_R8(simPort[SIM_P2].ren)
+#define P2SEL0 SIM_R8(simPort[SIM_P2].sel0)
+#define P2SEL1 SIM_R8(simPort[SIM_P2].sel1)
+#define P2IES SIM_R8(simPort[SIM_P2].ies)
+#define P2IE SIM_R8(simPort[SIM_P2].ie)
+#define P2IFG SIM_R8(simPort[SIM_P2].ifg)
+#define P2IV simPortIV(SIM_P2)
+#define PORT2_VECTOR (9)
+
+#define P3IN SIM_R8(simPort[SIM_P3].in)
+#define P3OUT SIM_R8(simPort[SIM_P3].out)
+#define P3DIR SIM_R8(simPort[SIM_P3].dir)
+#define P3REN SIM_R8(simPort[SIM_P3].ren)
+#define P3SEL0 SIM_R8(simPort[SIM_P3].sel0)
+#define P3SEL1 SIM_R8(simPort[SIM_P3].sel1)
+#define P3IES SIM_R8(simPort[SIM_P3].ies)
+#define P3IE SIM_R8(simPort[SIM_P3].ie)
+#define P3IFG SIM_R8(simPort[SIM_P3].ifg)
+#define P3IV simPortIV(SIM_P3)
+#define PORT3_VECTOR (8)
+
+#define P4IN SIM_R8(simPort[SIM_P4].in)
+#define P4OUT SIM_R8(simPort[SIM_P4].out)
+#define P4DIR SIM_R8(simPort[SIM_P4].dir)
+#define P4REN SIM_R8(simPort[SIM_P4].ren)
+#define P4SEL0 SIM_R8(simPort[SIM_P4].sel0)
+#define P4SEL1 SIM_R8(simPort[SIM_P4].sel1)
+#define P4IES SIM_R8(simPort[SIM_P4].ies)
+#define P4IE SIM_R8(simPort[SIM_P4].ie)
+#define P4IFG SIM_R8(simPort[SIM_P4].ifg)
+#define P4IV simPortIV(SIM_P4)
+#define PORT4_VECTOR (7)
+
+#define P5IN SIM_R8(simPort[SIM_P5].in)
+#define P5OUT SIM_R8(simPort[SIM_P5].out)
+#define P5DIR SIM_R8(simPort[SIM_P5].dir)
+#define P5REN SIM_R8(simPort[SIM_P5].ren)
+#define P5SEL0 SIM_R8(simPort[SIM_P5].sel0)
+#define P5SEL1 SIM_R8(simPort[SIM_P5].sel1)
+
+#define P6IN SIM_R8(simPort[SIM_P6].in)
+#define P6OUT SIM_R8(simPort[SIM_P6].out)
+#define P6DIR SIM_R8(simPort[SIM_P6].dir)
+#define P6REN SIM_R8(simPort[SIM_P6].ren)
+#define P6SEL0 SIM_R8(simPort[SIM_P6].sel0)
+#define P6SEL1 SIM_R8(simPort[SIM_P6].sel1)
+
+#define P7IN SIM_R8(simPort[SIM_P7].in)
+#define P7OUT SIM_R8(simPort[SIM_P7].out)
+#define P7DIR SIM_R8(simPort[SIM_P7].dir)
+#define P7REN SIM_R8(simPort[SIM_P7].ren)
+#define P7SEL0 SIM_R8(simPort[SIM_P7].sel0)
+#define P7SEL1 SIM_R8(simPort[SIM_P7].sel1)
+
+#define P8IN SIM_R8(simPort[SIM_P8].in)
+#define P8OUT SIM_R8(simPort[SIM_P8].out)
+#define P8DIR SIM_R8(simPort[SIM_P8].dir)
+#define P8REN SIM_R8(simPort[SIM_P8].ren)
+#define P8SEL0 SIM_R8(simPort[SIM_P8].sel0)
+#define P8SEL1 SIM_R8(simPort[SIM_P8].sel1)
+
+#define P9IN SIM_R8(simPort[SIM_P9].in)
+#define P9OUT SIM_R8(simPort[SIM_P9].out)
+#define P9DIR SIM_R8(simPort[SIM_P9].dir)
+#define P9REN SIM_R8(simPort[SIM_P9].ren)
+#define P9SEL0 SIM_R8(simPort[SIM_P9].sel0)
+#define P9SEL1 SIM_R8(simPort[SIM_P9].sel1)
+
+#define P10IN SIM_R8(simPort[SIM_P10].in)
+#define P10OUT SIM_R8(simPort[SIM_P10].out)
+#define P10DIR SIM_R8(simPort[SIM_P10].dir)
+#define P10REN SIM_R8(simPort[SIM_P10].ren)
+#define P10SEL0 SIM_R8(simPort[SIM_P10].sel0)
+#define P10SEL1 SIM_R8(simPort[SIM_P10].sel1)
+
+#define PJIN SIM_R8(simPort[SIM_PJ].in)
+#define PJOUT SIM_R8(simPort[SIM_PJ].out)
+#define PJDIR SIM_R8(simPort[SIM_PJ].dir)
+#define PJREN SIM_R8(simPort[SIM_PJ].ren)
+#define PJSEL0 SIM_R8(simPort[SIM_PJ].sel0)
+#define PJSEL1 SIM_R8(simPort[SIM_PJ].sel1)
+
+#define SIM_CAPTURE_INPUTS { { SIM_TA1, 1, SIM_P1, 2 } }
+#define WDTCTL SIM_R16(simMisc.wdtctl)
+#define WDT_VECTOR (22)
+#define WDTSSEL_0 (0x0000)
+#define WDTSSEL_1 (0x0020)
+#define WDTSSEL_2 (0x0040)
+#define WDTSSEL_3 (0x0060)
+#define WDTTMSEL (0x0010)
+#define WDTCNTCL (0x0008)
+#define WDTIS_0 (0x0000)
+#define WDTIS_1 (0x0001)
+#define WDTIS_2 (0x0002)
+#define WDTIS_3 (0x0003)
+#define WDTIS_4 (0x0004)
+#define WDTIS_5 (0x0005)
+#define WDTIS_6 (0x0006)
+#define WDTIS_7 (0x0007)
+#define WDTIE (0x0001)
+#define WDTIFG (0x0001)
+#define DMA_VECTOR (19)
+#define DMADT_0 (0x0000)
+#define DMADT_1 (0x1000)
+#define DMADT_2 (0x2000)
+#define DMADT_3 (0x3000)
+#define DMADT_4 (0x4000)
+#define DMADT_5 (0x5000)
+#define DMADT_6 (0x6000)
+#define DMADT_7 (0x7000)
+#define DMADSTINCR_0 (0x0000)
+#define DMADSTINCR_1 (0x0400)
+#define DMADSTINCR_2 (0x0800)
+#define DMADSTINCR_3 (0x0C00)
+#define DMASRCINCR_0 (0x0000)
+#define DMASRCINCR_1 (0x0100)
+#define DMASRCINCR_2 (0x0200)
+#define DMASRCINCR_3 (0x0300)
+#define DMADSTBYTE (0x0080)
+#define DMASRCBYTE (0x0040)
+#define DMALEVEL (0x0020)
+#define DMAEN (0x0010)
+#define DMAIFG (0x0008)
+#define DMAIE (0x0004)
+#define DMAABORT (0x0002)
+#define DMAREQ (0x0001)
+#define DMARMWDIS (0x0004)
+#define ROUNDROBIN (0x0002)
+#define ENNMI (0x0001)
+#define SIM_DMA_COUNT 3
+#define SIM_DMA_TRIGGERS { { 1, SIM_TA0, 0 }, { 2, SIM_TA0, 2 }, { 3, SIM_TA1, 0 }, { 4, SIM_TA1, 2 }, { 5, SIM_TA2, 0 } }
+#define DMACTL0 SIM_R16(simDma.ctl[0])
+#define DMACTL1 SIM_R16(simDma.ctl[1])
+#define DMACTL2 SIM_R16(simDma.ctl[2])
+#define DMACTL3 SIM_R16(simDma.ctl[3])
+#define DMACTL4 SIM_R16(simDma.ctl[4])
+#define DMA0CTL SIM_R16(simDma.ch[0].ctl)
+#define DMA0SA (simDma.ch[0].sa)
+#define DMA0DA (simDma.ch[0].da)
+#define DMA0SZ SIM_R16(simDma.ch[0].sz)
+#define DMA0TSEL_0 (0x0000)
+#define DMA0TSEL_1 (0x0001)
+#define DMA0TSEL_2 (0x0002)
+#define DMA0TSEL_3 (0x0003)
+#define DMA0TSEL_4 (0x0004)
+#define DMA0TSEL_5 (0x0005)
+#define DMA0TSEL_6 (0x0006)
+#define DMA0TSEL_7 (0x0007)
+#define DMA0TSEL_8 (0x0008)
+#define DMA0TSEL_9 (0x0009)
+#define DMA0TSEL_10 (0x000A)
+#define DMA0TSEL_11 (0x000B)
+#define DMA0TSEL_12 (0x000C)
+#define DMA0TSEL_13 (0x000D)
+#define DMA0TSEL_14 (0x000E)
+#define DMA0TSEL_15 (0x000F)
+#define DMA0TSEL_16 (0x0010)
+#define DMA0TSEL_17 (0x0011)
+#define DMA0TSEL_18 (0x0012)
+#define DMA0TSEL_19 (0x0013)
+#define DMA0TSEL_20 (0x0014)
+#define DMA0TSEL_21 (0x0015)
+#define DMA0TSEL_22 (0x0016)
+#define DMA0TSEL_23 (0x0017)
+#define DMA0TSEL_24 (0x0018)
+#define DMA0TSEL_25 (0x0019)
+#define DMA0TSEL_26 (0x001A)
+#define DMA0TSEL_27 (0x001B)
+#define DMA0TSEL_28 (0x001C)
+#define DMA0TSEL_29 (0x001D)
+#define DMA0TSEL_30 (0x001E)
+#define DMA0TSEL_31 (0x001F)
+#define DMA1CTL SIM_R16(simDma.ch[1].ctl)
+#define DMA1SA (simDma.ch[1].sa)
+#define DMA1DA (simDma.ch[1].da)
+#define DMA1SZ SIM_R16(simDma.ch[1].sz)
+#define DMA1TSEL_0 (0x0000)
+#define DMA1TSEL_1 (0x0100)
+#define DMA1TSEL_2 (0x0200)
+#define DMA1TSEL_3 (0x0300)
+#define DMA1TSEL_4 (0x0400)
+#define DMA1TSEL_5 (0x0500)
+#define DMA1TSEL_6 (0x0600)
+#define DMA1TSEL_7 (0x0700)
+#define DMA1TSEL_8 (0x0800)
+#define DMA1TSEL_9 (0x0900)
+#define DMA1TSEL_10 (0x0A00)
+#define DMA1TSEL_11 (0x0B00)
+#define DMA1TSEL_12 (0x0C00)
+#define DMA1TSEL_13 (0x0D00)
+#define DMA1TSEL_14 (0x0E00)
+#define DMA1TSEL_15 (0x0F00)
+#define DMA1TSEL_16 (0x1000)
+#define DMA1TSEL_17 (0x1100)
+#define DMA1TSEL_18 (0x1200)
+#define DMA1TSEL_19 (0x1300)
+#define DMA1TSEL_20 (0x1400)
+#define DMA1TSEL_21 (0x1500)
+#define DMA1TSEL_22 (0x1600)
+#define DMA1TSEL_23 (0x1700)
+#define DMA1TSEL_24 (0x1800)
+#define DMA1TSEL_25 (0x1900)
+#define DMA1TSEL_26 (0x1A00)
+#define DMA1TSEL_27 (0x1B00)
+#define DMA1TSEL_28 (0x1C00)
+#define DMA1TSEL_29 (0x1D00)
+#define DMA1TSEL_30 (0x1E00)
+#define DMA1TSEL_31 (0x1F00)
+#define DMA2CTL SIM_R16(simDma.ch[2].ctl)
+#define DMA2SA (simDma.ch[2].sa)
+#define DMA2DA (simDma.ch[2].da)
+#define DMA2SZ SIM_R16(simDma.ch[2].sz)
+#define DMA2TSEL_0 (0x0000)
+#define DMA2TSEL_1 (0x0001)
+#define DMA2TSEL_2 (0x0002)
+#define DMA2TSEL_3 (0x0003)
+#define DMA2TSEL_4 (0x0004)
+#define DMA2TSEL_5 (0x0005)
+#define DMA2TSEL_6 (0x0006)
+#define DMA2TSEL_7 (0x0007)
+#define DMA2TSEL_8 (0x0008)
+#define DMA2TSEL_9 (0x0009)
+#define DMA2TSEL_10 (0x000A)
+#define DMA2TSEL_11 (0x000B)
+#define DMA2TSEL_12 (0x000C)
+#define DMA2TSEL_13 (0x000D)
+#define DMA2TSEL_14 (0x000E)
+#define DMA2TSEL_15 (0x000F)
+#define DMA2TSEL_16 (0x0010)
+#define DMA2TSEL_17 (0x0011)
+#define DMA2TSEL_18 (0x0012)
+#define DMA2TSEL_19 (0x0013)
+#define DMA2TSEL_20 (0x0014)
+#define DMA2TSEL_21 (0x0015)
+#define DMA2TSEL_22 (0x0016)
+#define DMA2TSEL_23 (0x0017)
+#define DMA2TSEL_24 (0x0018)
+#define DMA2TSEL_25 (0x0019)
+#define DMA2TSEL_26 (0x001A)
+#define DMA2TSEL_27 (0x001B)
+#define DMA2TSEL_28 (0x001C)
+#define DMA2TSEL_29 (0x001D)
+#define DMA2TSEL_30 (0x001E)
+#define DMA2TSEL_31 (0x001F)
+#define SFRIE1 SIM_R16(simMisc.sfrie1)
+#define SFRIFG1 SIM_R16(simMisc.sfrifg1)
+#define PM5CTL0 SIM_R16(simMisc.pm5ctl0)
+#define FRCTL0 SIM_R16(simMisc.frctl0)
+#define CSCTL0 SIM_R16(simMisc.csctl[0])
+#define CSCTL0_H SIM_R8(simMisc.csctl0_h)
+#define CSCTL1 SIM_R16(simMisc.csctl[1])
+#define CSCTL2 SIM_R16(simMisc.csctl[2])
+#define CSCTL3 SIM_R16(simMisc.csctl[3])
+#define CSCTL4 SIM_R16(simMisc.csctl[4])
+#define CSCTL5 SIM_R16(simMisc.csctl[5])
+#define CSCTL6 SIM_R16(simMisc.csctl[6])
+#define LOCKLPM5 (0x0001)
+#define OFIFG (0x0002)
+#define FRCTLPW (0xA500)
+#define NWAITS_1 (0x0010)
+#define CSKEY_H (0xA5)
+#define DCORSEL (0x0040)
+#define DCOFSEL_0 (0x0000)
+#define DCOFSEL_4 (0x0008)
+#define DCOFSEL_6 (0x000C)
+#define SELA__LFXTCLK (0x0000)
+#define SELS__DCOCLK (0x0030)
+#define SELM__DCOCLK (0x0003)
+#define DIVA__1 (0x0000)
+#define DIVS__1 (0x0000)
+#define DIVM__1 (0x0000)
+#define DIVA__4 (0x0200)
+#define DIVS__4 (0x0020)
+#define DIVM__4 (0x0002)
+#define LFXTOFF (0x0001)
+#define LFXTOFFG (0x0001)
+#else
+#error "Simulator/msp430.h: unsupported device"
+#endif
+
+#endif
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Estimates supply current per board and sleep mode, and the PWM duty resolution.
+
+Current: each case builds a program twice as far as the simulator can tell
+(LPM0 at 16 MHz, and with CLOCK_LPM3 the timers on ACLK and LPM3), runs it
+for a second after start-up with two button presses, and weighs the cycles
+awake, in LPM0 and in LPM3 with the board's typical currents below. Time in
+LPM3 with a timer still holding SMCLK on (the UCS and CS grant such clock
+requests) is charged at the LPM0 current. Clock start-up, the LEDs, the
+LaunchPad's debugger and the pull-up current of a held button are left out.
+
+Resolution: Hardware PWM is built with its PWM timer on SMCLK (10 kHz) and on
+ACLK (CLOCK_LPM3, PWM_HZ of 10000, 1000 and the default 128). Eleven presses
+step the duty cycle through its range, and the trace of the PWM output gives
+the duty cycles actually produced: the ticks per period, the distinct levels
+seen (held for at least two periods, so not a period cut by an update) and
+the duty step one tick makes.
+
+From the repository root:
+  python3 Simulator/power_estimate.py
+  python3 Simulator/power_estimate.py --boards MSP430G2553 --no-resolution
+"""
+
+import argparse
+import math
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import run  # noqa: E402
+from bounce_bench import BUTTONS  # noqa: E402
+from capture_check import LOOPBACK  # noqa: E402
+from runt_check import edges, presses  # noqa: E402
+
+# Typical supply current at 3 V and 25 C, rounded from the device datasheets and
+# not measured here: active uA per MHz of MCLK, LPM0 as a share of the active
+# current at the same clock (an assumption: the DCO and SMCLK keep running),
+# and LPM3 with the board's ACLK source (clock.h) running.
+CURRENT = {
+    "MSP430G2553": (270, 0.25, 0.5),  # VLO
+    "MSP430F5529": (300, 0.25, 5.0),  # REFO, about 3 uA of it
+    "MSP430FR2311": (130, 0.25, 16.0),  # REFO, about 15 uA of it
+    "MSP430FR5994": (120, 0.25, 0.6),  # LFXT
+    "MSP430FR6989": (100, 0.25, 0.7),  # LFXT
+}
+
+ACLK = {"MSP430G2553": 12000.0} # CLOCK_ACLK_HZ in Common/clock.h, 32768 elsewhere
+
+CASES = [
+    ("Debouncing, timeout", "Debouncing", []),
+    ("Debouncing, integrator", "Debouncing", ["DEBOUNCE_MODE=1"]),
+    ("Hardware PWM", "Hardware PWM", []),
+]
+
+
+def counters(binary, until, stimulus):
+    """Cycles awake, in LPM0-LPM4 and with SMCLK held, and the clock rate of one run"""
+    cmd = [binary, "--until", "%gs" % until]
+    if stimulus:
+        cmd += ["--stimulus", stimulus]
+    out = subprocess.run(cmd, capture_output=True, text=True)
+    if out.returncode:
+        sys.exit("power_estimate.py: simulator failed\n%s%s" % (out.stdout, out.stderr))
+    hz = float(out.stdout.split(" at ")[1].split(" Hz")[0])
+    main, isr = [int(v) for v in re.search(r"main (\d+), ISRs (\d+)", out.stdout).groups()]
+    lpm = re.search(r"asleep LPM0 (\d+), LPM1 (\d+), LPM2 (\d+), LPM3 (\d+), LPM4 (\d+) cycles, "
+                    r"SMCLK held on by a timer (\d+)", out.stdout).groups()
+    return hz, [main + isr] + [int(v) for v in lpm]
+
+
+def current(board, hz, awake, lpm):
+    """Average supply current in uA over the cycles counted"""
+    per_mhz, lpm0_share, lpm3 = CURRENT[board]
+    active = per_mhz * hz / 1e6
+    lpm0 = active * lpm0_share
+    total = awake + sum(lpm[:5])
+    charge = active * awake + lpm0 * (lpm[0] + lpm[1] + lpm[2]) + lpm3 * (lpm[3] + lpm[4]) \
+        + (lpm0 - lpm3) * lpm[5]
+    return charge / total if total else 0
+
+
+def estimate(args):
+    print("| Program | Board | Sleep | Awake % | Held SMCLK % | Estimated uA |")
+    print("|---|---|---|---|---|---|")
+    for name, lab, defines in CASES:
+        for board in args.boards.split(","):
+            for sleep, extra in (("LPM0", []), ("LPM3", ["CLOCK_LPM3=1"])):
+                with tempfile.TemporaryDirectory(prefix="power_") as workdir:
+                    binary = run.build(args.cc, "%s/%s/blink.c" % (lab, board), board,
+                                       args.defines + defines + extra, workdir)
+                    stimulus = os.path.join(workdir, "stimulus.txt")
+                    with open(stimulus, "w") as f:
+                        for start in (0.8, 1.2):
+                            f.write("%gs %s 0\n%gs %s z\n" % (start, BUTTONS[board], start + 0.1, BUTTONS[board]))
+                    # The second minus the first half second leaves out clock start-up
+                    hz, first = counters(binary, 0.5, stimulus)
+                    hz, second = counters(binary, 1.5, stimulus)
+                    diff = [b - a for a, b in zip(first, second)]
+                    total = diff[0] + sum(diff[1:6])
+                    print("| %s | %s | %s | %.3f | %.1f | %.1f |" % (
+                        name, board, sleep, 100.0 * diff[0] / total, 100.0 * diff[6] / total,
+                        current(board, hz, diff[0], diff[1:])))
+
+
+def duty_levels(found):
+    """Duty cycle of each whole period of the trace, in %"""
+    rises = [c for c, v in found if v == 1]
+    falls = [c for c, v in found if v == 0]
+    levels, j = [], 0
+    for a, b in zip(rises, rises[1:]):
+        while j < len(falls) and falls[j] < a:
+            j += 1
+        if j < len(falls) and falls[j] < b:
+            levels.append(100.0 * (falls[j] - a) / (b - a))
+    return levels
+
+
+def resolution(args):
+    print("| Board | PWM clock | PWM Hz | Ticks | Bits | Levels seen | Duty step % |")
+    print("|---|---|---|---|---|---|---|")
+    for board in args.boards.split(","):
+        output = LOOPBACK[board][0]
+        for clock, pwm_hz, extra in (("SMCLK", 10000, []), ("ACLK", 10000, ["CLOCK_LPM3=1", "PWM_HZ=10000"]),
+                                     ("ACLK", 1000, ["CLOCK_LPM3=1", "PWM_HZ=1000"]),
+                                     ("ACLK", 128, ["CLOCK_LPM3=1"])):
+            if clock == "ACLK" and ACLK.get(board, 32768.0) / pwm_hz < 2:
+                print("| %s | %s | %d | under 2 | - | does not build (PERIOD_ASSERT) | - |" % (board, clock, pwm_hz))
+                continue
+            with tempfile.TemporaryDirectory(prefix="power_") as workdir:
+                binary = run.build(args.cc, "Hardware PWM/%s/blink.c" % board, board,
+                                   args.defines + extra, workdir)
+                stimulus = os.path.join(workdir, "stimulus.txt")
+                with open(stimulus, "w") as f:
+                    for start, length in presses(0.02, 0.04, 0.02, 11):
+                        f.write("%.6fs %s 0\n%.6fs %s z\n" % (start, BUTTONS[board], start + length, BUTTONS[board]))
+                csv_path = os.path.join(workdir, "trace.csv")
+                out = subprocess.run([binary, "--until", "0.5s", "--stimulus", stimulus, "--trace", csv_path],
+                                     capture_output=True, text=True)
+                hz = float(out.stdout.split(" at ")[1].split(" Hz")[0])
+                found = edges(csv_path, output)
+            source = hz if clock == "SMCLK" else ACLK.get(board, 32768.0)
+            ticks = int(round(source / pwm_hz)) # every rate here fits 16 bits undivided
+            levels = [round(v, 1) for v in duty_levels(found)]
+            held = set(v for v in levels if levels.count(v) >= 2)
+            print("| %s | %s | %d | %d | %.1f | %d | %.2f |" % (
+                board, clock, pwm_hz, ticks, math.log2(ticks), len(held), 100.0 / ticks))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--boards", default=",".join(CURRENT))
+    parser.add_argument("--no-resolution", action="store_true", help="current estimates only")
+    parser.add_argument("-D", dest="defines", action="append", default=[], help="program #define")
+    parser.add_argument("--cc", default="gcc")
+    args = parser.parse_args()
+
+    estimate(args)
+    if not args.no_resolution:
+        print()
+        resolution(args)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Builds a lab program for the host simulator and runs it.
+
+The program is compiled unchanged with the host gcc against Simulator/msp430.h,
+whose registers are backed by the timer, port and interrupt model in sim.c.
+The #pragma vector lines of the program become the simulator's vector table,
+main() becomes simProgramMain(), and the Common and lab-level sources are linked
+in next to it. The run prints simulated time, where the cycles went and
+estimated cycles per ISR (see sim.h for what the estimate counts).
+
+Examples, from the repository root:
+  python3 Simulator/run.py Debouncing/MSP430G2553/blink.c --press P1.3@100ms+200ms
+  python3 Simulator/run.py "Software PWM/MSP430FR5994/blink.c" -D PWM_MODE=2 \\
+      --until 2s --trace pwm.csv --budget Timer_Duty=80
+
+--press PIN@TIME+LENGTH pulls an active-low button to 0 at TIME and releases it
+LENGTH later. --stimulus FILE gives arbitrary pin drive, one "TIME PIN LEVEL"
+per line (TIME with an s, ms, us or cyc suffix, LEVEL 0, 1 or z). --trace
+writes every pin, timer output and ISR entry/exit as cycle,signal,value CSV.
+--budget ISR=CYCLES fails the run if one call of the ISR took longer.
+--exclusive OUT,OUT[@TIME] fails it if two timer outputs (TA0.1,TA0.2) are
+ever high together, or one goes high less than TIME after the other fell.
+--wire OUT,PIN drives an input pin with a timer output (TA0.1,P2.1), as a
+jumper does. --dump SYMBOL[:WORDS] prints a global of the program after the
+run as 16-bit words.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+BOARDS = ["MSP430G2553", "MSP430F5529", "MSP430FR2311", "MSP430FR5994", "MSP430FR6989"]
+
+
+def infer_board(source):
+    for part in reversed(os.path.abspath(source).split(os.sep)):
+        if part in BOARDS:
+            return part
+    return None
+
+
+def cflags(board, defines):
+    flags = ["-O1", "-g", "-D__%s__" % board, "-I", HERE,
+             "-Wall", "-Wno-unknown-pragmas", "-Wno-main"]
+    return flags + ["-D" + d for d in defines]
+
+
+def vectors(cc, flags, source):
+    # gcc -E keeps the active #pragma vector lines with their macro unexpanded;
+    # the handler is the function defined right after each one
+    text = subprocess.run([cc, "-E", "-P"] + flags + [source], check=True,
+                          capture_output=True, text=True).stdout
+    found = []
+    for m in re.finditer(r"#pragma\s+vector\s*=\s*([^\n]+)\n[^(]*?\bvoid\s+(\w+)\s*\(", text):
+        for vector in m.group(1).split(","):
+            found.append((vector.strip(), m.group(2)))
+    return found
+
+
+def parse_press(press):
+    m = re.match(r"^(P[0-9J]+\.[0-7])@([0-9.]+(?:s|ms|us|cyc))\+([0-9.]+)(s|ms|us|cyc)$", press)
+    if not m:
+        sys.exit("run.py: --press wants PIN@TIME+LENGTH, e.g. P1.3@100ms+50ms")
+    pin, start, length, unit = m.groups()
+    start_value, start_unit = re.match(r"([0-9.]+)(\D+)", start).groups()
+    scale = {"s": 1e9, "ms": 1e6, "us": 1e3, "cyc": None}
+    if scale[start_unit] is None or scale[unit] is None:
+        if start_unit != unit:
+            sys.exit("run.py: --press in cycles needs cyc for both times")
+        end = "%d%s" % (int(float(start_value)) + int(float(length)), unit)
+    else:
+        ns = float(start_value) * scale[start_unit] + float(length) * scale[unit]
+        end = "%gus" % (ns / 1e3)
+    return [["--drive", start, pin, "0"], ["--drive", end, pin, "z"]]
+
+
+def build(cc, source, board, defines, build_dir):
+    """Compiles source for board into build_dir and returns the simulator binary"""
+    source = os.path.abspath(source)
+    flags = cflags(board, defines)
+    program = os.path.join(build_dir, "program.c")
+    with open(program, "w") as f:
+        f.write('#include "%s"\n\n' % source)
+        f.write("const SimVector simVectors[] = {\n")
+        for vector, isr in vectors(cc, flags, source):
+            f.write('    { %s, %s, "%s" },\n' % (vector, isr, isr))
+        f.write("    { 0, 0, 0 }\n};\n")
+
+    # The lab's other sources (pwm_*.c) and Common sit next to the program's blink.c
+    lab = os.path.dirname(os.path.dirname(source)) if infer_board(source) else os.path.dirname(source)
+    units = [(program, ["-Dmain=simProgramMain"])]
+    for directory in (lab, os.path.join(ROOT, "Common")):
+        for name in sorted(os.listdir(directory)):
+            if name.endswith(".c") and name != "blink.c":
+                units.append((os.path.join(directory, name), []))
+    units += [(os.path.join(HERE, "sim.c"), []), (os.path.join(HERE, "sim_main.c"), [])]
+
+    objects = []
+    for unit, extra in units:
+        obj = os.path.join(build_dir, "%d.o" % len(objects))
+        result = subprocess.run([cc, "-c", unit, "-o", obj] + flags + extra,
+                                capture_output=True, text=True)
+        if result.returncode:
+            sys.stderr.write(result.stderr)
+            sys.exit("run.py: %s does not build for the simulator" % unit)
+        objects.append(obj)
+    binary = os.path.join(build_dir, "sim")
+    # -rdynamic exports the program's globals for --dump
+    subprocess.run([cc, "-rdynamic", "-o", binary] + objects + ["-ldl"], check=True)
+    return binary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="program, e.g. Debouncing/MSP430G2553/blink.c")
+    parser.add_argument("--board", help="device, by default the MSP430... folder of the source")
+    parser.add_argument("--until", default="1s", help="simulated time to run (default 1s)")
+    parser.add_argument("--press", action="append", default=[], help="PIN@TIME+LENGTH")
+    parser.add_argument("--stimulus", help="file of TIME PIN LEVEL lines")
+    parser.add_argument("--trace", help="CSV output file")
+    parser.add_argument("--budget", action="append", default=[], help="ISR=CYCLES")
+    parser.add_argument("--exclusive", action="append", default=[], help="OUT,OUT[@TIME]")
+    parser.add_argument("--wire", action="append", default=[], help="OUT,PIN")
+    parser.add_argument("--dump", action="append", default=[], help="SYMBOL[:WORDS]")
+    parser.add_argument("-D", dest="defines", action="append", default=[], help="program #define")
+    parser.add_argument("--cc", default="gcc")
+    parser.add_argument("--keep", action="store_true", help="keep the build directory")
+    args = parser.parse_args()
+
+    board = args.board or infer_board(args.source)
+    if board not in BOARDS:
+        sys.exit("run.py: pass --board, one of " + ", ".join(BOARDS))
+
+    build_dir = tempfile.mkdtemp(prefix="sim_")
+    try:
+        binary = build(args.cc, args.source, board, args.defines, build_dir)
+        command = [binary, "--until", args.until]
+        for press in args.press:
+            for drive in parse_press(press):
+                command += drive
+        if args.stimulus:
+            command += ["--stimulus", args.stimulus]
+        if args.trace:
+            command += ["--trace", args.trace]
+        for budget in args.budget:
+            command += ["--budget", budget]
+        for pair in args.exclusive:
+            command += ["--exclusive", pair]
+        for pair in args.wire:
+            command += ["--wire", pair]
+        for symbol in args.dump:
+            command += ["--dump", symbol]
+        return subprocess.run(command).returncode
+    finally:
+        if args.keep:
+            print("build kept in " + build_dir)
+        else:
+            shutil.rmtree(build_dir)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
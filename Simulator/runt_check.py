@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""Checks PWM outputs for glitches while the duty cycle changes.
+
+Every case builds a PWM program for the simulator, presses its button so the
+duty cycle steps, fades or ramps through its whole range, and reads the PWM
+output back from the trace. An update that lands at the wrong point of a
+period shows up as one of:
+
+  runt     a high or low time shorter (or longer) than both the same level's
+           times one period before and after: a pulse cut short or stretched
+           by a half-applied update
+  doubled  the output stays high for more than one period but less than two:
+           a reset was missed and the pulse ran on into the next period
+  dropped  the same for low: a period without a pulse
+  split    for programs with several outputs on one timer: one update that
+           changes some outputs a period earlier or later than the others
+
+Widths are compared with --tolerance (default 4 us) of slack, which covers
+interrupt latency in the software PWM. Outputs that stay high or low for two
+periods or more are a full or zero duty cycle, not a glitch, and the pulses
+next to them are not compared with them. The period is the most common
+distance between rising edges.
+
+From the repository root:
+  python3 Simulator/runt_check.py
+  python3 Simulator/runt_check.py --boards MSP430FR2311 --detail
+The exit code is 1 when any case has a glitch.
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+import tempfile
+from collections import Counter
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import run  # noqa: E402
+from bounce_bench import BUTTONS  # noqa: E402
+
+HARDWARE_PWM = {"MSP430G2553": "TA0.1", "MSP430F5529": "TA0.1", "MSP430FR2311": "TB1.1",
+                "MSP430FR5994": "TA0.1", "MSP430FR6989": "TA0.1"}
+# Outputs of the Common/pwm.c channels (HAL_PWMCH_TIMER in Common/hal.h)
+PWM_CHANNELS = {"MSP430G2553": ["TA0.1"], "MSP430F5529": ["TA0.%d" % n for n in range(1, 5)],
+                "MSP430FR2311": ["TB1.1", "TB1.2"], "MSP430FR5994": ["TB0.%d" % n for n in range(1, 7)],
+                "MSP430FR6989": ["TA0.1"]}
+
+
+def presses(start, every, length, count):
+    return [(start + n * every, length) for n in range(count)]
+
+
+# Program, source, defines, PWM outputs, button presses as (start s, length s), run time s
+CASES = [
+    # Ten 10 % steps up to full, the wrap to 0, and back up
+    ("Hardware PWM, one-shot", "Hardware PWM/{board}/blink.c", [], lambda b: [HARDWARE_PWM[b]],
+     presses(0.02, 0.04, 0.02, 13), 0.6),
+    # The same steps timed by the watchdog
+    ("Hardware PWM, watchdog", "Hardware PWM/{board}/blink.c", ["TIMING_MODE=2"], lambda b: [HARDWARE_PWM[b]],
+     presses(0.02, 0.04, 0.02, 13), 0.6),
+    # The same steps as fades, including a long fade down from full. The step count
+    # to the wrap differs with PWM_TICKS, so it takes 6 presses or 7.
+    ("Hardware PWM, wheel", "Hardware PWM/{board}/blink.c", ["TIMING_MODE=1"], lambda b: [HARDWARE_PWM[b]],
+     presses(0.02, 0.08, 0.02, 6) + presses(0.5, 1.0, 0.02, 2) + [(1.58, 0.02)], 2.0),
+    # Clicks step up, a long press ramps down a step every 100 ms and stops at off
+    ("Software PWM, interrupt", "Software PWM/{board}/blink.c", ["PWM_MODE=1"], lambda b: ["P1.0"],
+     presses(0.02, 0.4, 0.05, 3) + [(1.3, 1.5)] + presses(3.0, 0.4, 0.05, 2), 4.0),
+    # The same gestures on the hardware PWM: up to 100 %, a ramp down to 0 and two steps back up
+    ("Hardware PWM, gestures", "Hardware PWM/{board}/blink.c", ["BUTTON_MODE=1"], lambda b: [HARDWARE_PWM[b]],
+     presses(0.02, 0.06, 0.03, 5) + [(0.4, 1.6)] + presses(2.1, 0.06, 0.03, 2), 2.3),
+    # The same gestures, debounced by the watchdog
+    ("Software PWM, watchdog", "Software PWM/{board}/blink.c", ["PWM_MODE=1", "DEBOUNCE_TIMER=1"],
+     lambda b: ["P1.0"], presses(0.02, 0.4, 0.05, 3) + [(1.3, 1.5)] + presses(3.0, 0.4, 0.05, 2), 4.0),
+    # Envelope playback: each press restarts on the next envelope, four go round them all
+    ("Hardware PWM, DMA playback", "Hardware PWM/{board}/blink.c", ["PLAYBACK_MODE=1"], lambda b: [HARDWARE_PWM[b]],
+     presses(0.7, 0.7, 0.02, 4), 3.5),
+    ("Hardware PWM, ISR playback", "Hardware PWM/{board}/blink.c", ["PLAYBACK_MODE=2"], lambda b: [HARDWARE_PWM[b]],
+     presses(0.7, 0.7, 0.02, 4), 3.5),
+    # Every channel through the color list and round again
+    ("Hardware PWM, channels", "Hardware PWM/{board}/blink.c", ["OUTPUT_MODE=1"], PWM_CHANNELS.get,
+     presses(0.02, 0.04, 0.02, 12), 0.6),
+]
+
+
+def simulate(binary, pin, button, until, workdir):
+    stimulus = os.path.join(workdir, "stimulus.txt")
+    with open(stimulus, "w") as f:
+        for start, length in button:
+            f.write("%.6fs %s 0\n%.6fs %s z\n" % (start, pin, start + length, pin))
+    csv_path = os.path.join(workdir, "trace.csv")
+    out = subprocess.run([binary, "--until", "%gs" % until, "--stimulus", stimulus,
+                          "--trace", csv_path], capture_output=True, text=True)
+    if out.returncode:
+        sys.exit("runt_check.py: simulator failed\n%s%s" % (out.stdout, out.stderr))
+    hz = float(out.stdout.split(" at ")[1].split(" Hz")[0])
+    return hz, csv_path
+
+
+def edges(csv_path, signal):
+    found = []
+    with open(csv_path) as f:
+        next(f)
+        for cycle, name, value in csv.reader(f):
+            if name == signal:
+                found.append((int(cycle), int(value)))
+    return found
+
+
+def check(found, tolerance):
+    """Returns (pulses, (shortest, longest) pulse, glitches as (cycle, kind, width))"""
+    rises = [c for c, v in found if v == 1]
+    if len(rises) < 3:
+        return 0, (0, 0), []
+    period = Counter(b - a for a, b in zip(rises, rises[1:])).most_common(1)[0][0]
+    glitches = []
+    # Times at each level, in order: (start, level, width)
+    spans = [(a[0], a[1], b[0] - a[0]) for a, b in zip(found, found[1:])]
+
+    for start, level, width in spans:
+        if period + tolerance < width <= 2 * period + tolerance:
+            glitches.append((start, "doubled" if level else "dropped", width))
+
+    # Each span against the spans of the same level one period before and after
+    for i in range(2, len(spans) - 2):
+        near = spans[i - 2:i + 3]
+        if any(s[2] > period + tolerance for s in near):
+            continue # next to a full or zero duty cycle, or already reported
+        start, level, width = spans[i]
+        low, high = min(near[0][2], near[4][2]), max(near[0][2], near[4][2])
+        if width < low - tolerance or width > high + tolerance:
+            glitches.append((start, "runt", width))
+
+    highs = [s[2] for s in spans if s[1] == 1 and s[2] <= period + tolerance]
+    return len(rises), (min(highs), max(highs)) if highs else (0, 0), sorted(glitches)
+
+
+def period_highs(found, start, period, count):
+    """High time in each of count periods from start on"""
+    highs = [0] * count
+    end = start + count * period
+    for (a, level), (b, _) in zip(found, found[1:] + [(end, 0)]):
+        a, b = max(a, start), min(b, end)
+        while level and a < b:
+            k = (a - start) // period
+            stop = min(b, start + (k + 1) * period)
+            highs[k] += stop - a
+            a = stop
+    return highs
+
+
+def splits(outputs, tolerance):
+    """Periods in which some outputs change width and others only one period before or after"""
+    rises = sorted(c for found in outputs for c, v in found if v == 1)
+    if len(outputs) < 2 or len(rises) < 3:
+        return []
+    period = Counter(b - a for a, b in zip(rises, rises[1:]) if b != a).most_common(1)[0][0]
+    count = (max(found[-1][0] for found in outputs if found) - rises[0]) // period
+    changes = []
+    for found in outputs:
+        highs = period_highs(found, rises[0], period, count)
+        changes.append({k for k in range(1, count) if abs(highs[k] - highs[k - 1]) > tolerance})
+    return sorted(rises[0] + k * period for k in set().union(*changes)
+                  if any(k not in c and (k - 1 in c or k + 1 in c) for c in changes))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--boards", default=",".join(run.BOARDS))
+    parser.add_argument("--tolerance", type=float, default=4, help="width slack in us")
+    parser.add_argument("--detail", action="store_true", help="list the glitches")
+    parser.add_argument("-D", dest="defines", action="append", default=[], help="program #define")
+    parser.add_argument("--cc", default="gcc")
+    args = parser.parse_args()
+
+    print("| Program | Board | Pulses | High time us | Runt | Doubled | Dropped | Split |")
+    print("|---|---|---|---|---|---|---|---|")
+    failed = 0
+    details = []
+    for name, source, defines, signals, button, until in CASES:
+        for board in args.boards.split(","):
+            pulses, widths, glitches = 0, [], []
+            with tempfile.TemporaryDirectory(prefix="runt_") as workdir:
+                binary = run.build(args.cc, source.format(board=board), board,
+                                   args.defines + defines, workdir)
+                hz, csv_path = simulate(binary, BUTTONS[board], button, until, workdir)
+                tolerance = int(args.tolerance * hz / 1e6)
+                outputs = [edges(csv_path, signal) for signal in signals(board)]
+            for found in outputs:
+                n, w, g = check(found, tolerance)
+                pulses += n
+                widths += [x for x in w if n]
+                glitches += g
+            glitches += [(cycle, "split", 0) for cycle in splits(outputs, tolerance)]
+            widths = widths or [0]
+            kinds = Counter(kind for _, kind, _ in glitches)
+            print("| %s | %s | %d | %.1f-%.1f | %d | %d | %d | %d |" % (
+                name, board, pulses, min(widths) * 1e6 / hz, max(widths) * 1e6 / hz,
+                kinds["runt"], kinds["doubled"], kinds["dropped"], kinds["split"]))
+            failed += bool(glitches)
+            details += ["%s, %s: %s %.1f us wide at %.3f ms" % (
+                name, board, kind, width * 1e6 / hz, cycle * 1e3 / hz)
+                for cycle, kind, width in sorted(glitches)]
+    if args.detail and details:
+        print()
+        print("\n".join(details))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
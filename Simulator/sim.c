@@ -0,0 +1,1393 @@
+// Host simulator core, see sim.h for the model and its limits
+//
+// Time only moves forward in advance(). From a register access it moves by the
+// access cost. While the CPU sleeps it jumps straight to the next timer event or
+// pin stimulus, which is why a second of mostly-LPM program time takes
+// milliseconds of host time.
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <msp430.h>
+#include "../Common/clock.h"
+
+SimTimerRegs simTimer[SIM_TIMERS];
+SimPortRegs simPort[SIM_PORTS];
+SimMiscRegs simMisc;
+SimDmaRegs simDma;
+
+#define NEVER UINT64_MAX
+
+// Timer_A IV value for TAIFG: after CCR2 on the 2xx Timer_A3, fixed 0x0E elsewhere
+#if defined(__MSP430G2553__)
+#define IV_TAIFG 0x0A
+#else
+#define IV_TAIFG 0x0E
+#endif
+
+static const uint8_t timerCcrs[SIM_TIMERS] = {
+#ifdef SIM_TA0_CCRS
+    [SIM_TA0] = SIM_TA0_CCRS,
+#endif
+#ifdef SIM_TA1_CCRS
+    [SIM_TA1] = SIM_TA1_CCRS,
+#endif
+#ifdef SIM_TA2_CCRS
+    [SIM_TA2] = SIM_TA2_CCRS,
+#endif
+#ifdef SIM_TA3_CCRS
+    [SIM_TA3] = SIM_TA3_CCRS,
+#endif
+#ifdef SIM_TA4_CCRS
+    [SIM_TA4] = SIM_TA4_CCRS,
+#endif
+#ifdef SIM_TB0_CCRS
+    [SIM_TB0] = SIM_TB0_CCRS,
+#endif
+#ifdef SIM_TB1_CCRS
+    [SIM_TB1] = SIM_TB1_CCRS,
+#endif
+#ifdef SIM_TB2_CCRS
+    [SIM_TB2] = SIM_TB2_CCRS,
+#endif
+};
+
+static const char *const timerNames[SIM_TIMERS] = { "TA0", "TA1", "TA2", "TA3", "TA4", "TB0", "TB1", "TB2" };
+static const char *const portNames[SIM_PORTS] = { "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J" };
+
+// Interrupt sources and the vector each one raises
+enum { SRC_PORT, SRC_CCR0, SRC_IV, SRC_WDT };
+
+typedef struct {
+    int vector;
+    uint8_t kind;
+    uint8_t unit;
+} Source;
+
+#define PORT_SOURCE(n) { PORT##n##_VECTOR, SRC_PORT, SIM_P##n }
+#define TIMER_SOURCES(n, k, t) { TIMER##n##_##k##0_VECTOR, SRC_CCR0, t }, { TIMER##n##_##k##1_VECTOR, SRC_IV, t }
+
+static const Source sources[] = {
+#ifdef PORT1_VECTOR
+    PORT_SOURCE(1),
+#endif
+#ifdef PORT2_VECTOR
+    PORT_SOURCE(2),
+#endif
+#ifdef PORT3_VECTOR
+    PORT_SOURCE(3),
+#endif
+#ifdef PORT4_VECTOR
+    PORT_SOURCE(4),
+#endif
+#ifdef PORT5_VECTOR
+    PORT_SOURCE(5),
+#endif
+#ifdef PORT6_VECTOR
+    PORT_SOURCE(6),
+#endif
+#ifdef PORT7_VECTOR
+    PORT_SOURCE(7),
+#endif
+#ifdef PORT8_VECTOR
+    PORT_SOURCE(8),
+#endif
+#ifdef TIMER0_A0_VECTOR
+    TIMER_SOURCES(0, A, SIM_TA0),
+#endif
+#ifdef TIMER1_A0_VECTOR
+    TIMER_SOURCES(1, A, SIM_TA1),
+#endif
+#ifdef TIMER2_A0_VECTOR
+    TIMER_SOURCES(2, A, SIM_TA2),
+#endif
+#ifdef TIMER3_A0_VECTOR
+    TIMER_SOURCES(3, A, SIM_TA3),
+#endif
+#ifdef TIMER4_A0_VECTOR
+    TIMER_SOURCES(4, A, SIM_TA4),
+#endif
+#ifdef TIMER0_B0_VECTOR
+    TIMER_SOURCES(0, B, SIM_TB0),
+#endif
+#ifdef TIMER1_B0_VECTOR
+    TIMER_SOURCES(1, B, SIM_TB1),
+#endif
+    { WDT_VECTOR, SRC_WDT, 0 },
+};
+
+#define SOURCES (sizeof(sources) / sizeof(sources[0]))
+
+typedef struct {
+    uint64_t phase; // source clock phase, in MCLK cycles x source Hz
+    uint8_t down; // counting down in up/down mode
+    uint8_t out[SIM_CCRS]; // output unit levels
+    uint16_t cl[SIM_CCRS]; // Timer_B compare latches TBxCLn
+    uint8_t updated; // Timer_B: TBxCCRn accessed since TBxCLn last loaded, one bit per n
+} TimerState;
+
+typedef struct {
+    uint8_t driven; // pins driven from outside
+    uint8_t level; // levels of the driven pins
+    uint8_t pin; // last pin levels
+} PortState;
+
+typedef struct {
+    uint64_t cycle;
+    uint8_t port, bit, level;
+} Stimulus;
+
+// Where the CPU spends its cycles
+enum { CTX_MAIN, CTX_ISR, CTX_SLEEP, CTX_RETURNED, CTXS };
+
+typedef struct {
+    uint64_t calls, total, min, max;
+} IsrStats;
+
+static TimerState timerState[SIM_TIMERS];
+static PortState portState[SIM_PORTS];
+static Stimulus *stimuli;
+static size_t stimulusCount, stimulusCap, nextStimulus;
+
+static uint64_t now, endCycles;
+static unsigned sr;
+static int context = CTX_MAIN;
+static int inIsr = -1; // simVectors index of the running ISR
+static unsigned isrExitSR; // SR restored by RETI
+static jmp_buf endJump;
+static int unhandledVector = -1;
+static FILE *traceFile;
+
+static uint64_t contextCycles[CTXS];
+static uint64_t lpmCycles[5]; // asleep in LPM0-LPM4
+static uint64_t smclkHeldCycles; // asleep in LPM2-LPM4 with a timer or the watchdog keeping SMCLK on
+static uint64_t dmaTransfers;
+static IsrStats *isrStats;
+static size_t vectorCount;
+
+static void trace(const char *signal, int value)
+{
+    if (traceFile)
+        fprintf(traceFile, "%llu,%s,%d\n", (unsigned long long)now, signal, value);
+}
+
+// Timers
+
+static int timerMode(int t)
+{
+    return (simTimer[t].ctl >> 4) & 3;
+}
+
+static uint32_t timerMax(int t)
+{
+    static const uint32_t lengths[4] = { 0xFFFF, 0x0FFF, 0x03FF, 0x00FF };
+
+    if (t >= SIM_TB0)
+        return lengths[(simTimer[t].ctl >> 11) & 3]; // CNTL
+    return 0xFFFF;
+}
+
+// SCG1 (LPM2-LPM4) turns SMCLK off. The 2xx basic clock stops it; the UCS and
+// CS of the other parts keep it running for a module that requests it, such as
+// a timer counting it, and the DCO with it (counted in smclkHeldCycles).
+static int smclkStopped(void)
+{
+#if defined(__MSP430G2553__)
+    return (sr & (CPUOFF | SCG1)) == (CPUOFF | SCG1);
+#else
+    return 0;
+#endif
+}
+
+static uint64_t timerSourceHz(int t)
+{
+    switch ((simTimer[t].ctl >> 8) & 3) {
+    case 1:
+        return CLOCK_ACLK_HZ;
+    case 2:
+        return smclkStopped() ? 0 : CLOCK_SMCLK_HZ;
+    default:
+        return 0; // external clock pins are not modelled
+    }
+}
+
+static uint64_t timerDivider(int t)
+{
+    uint64_t div = 1u << ((simTimer[t].ctl >> 6) & 3);
+
+#if !defined(__MSP430G2553__)
+    div *= (simTimer[t].ex0 & 7) + 1;
+#endif
+    return div;
+}
+
+// Value CCRn compares with: TBxCLn on Timer_B, which CLLD loads from TBxCCRn
+static uint16_t compareValue(int t, int n)
+{
+    return t >= SIM_TB0 ? timerState[t].cl[n] : simTimer[t].ccr[n];
+}
+
+static int timerRunning(int t)
+{
+    int mode = timerMode(t);
+
+    if (!timerCcrs[t] || !mode || !timerSourceHz(t))
+        return 0;
+    return mode == 2 || compareValue(t, 0) != 0; // up and up/down halt with CCR0 = 0
+}
+
+static uint32_t distance(uint32_t from, uint32_t to, uint32_t period)
+{
+    uint32_t d = (to + period - from) % period;
+
+    return d ? d : period;
+}
+
+// Ticks until the counter next counts to v, 0 if it never does
+static uint32_t ticksTo(int t, uint32_t v)
+{
+    SimTimerRegs *r = &simTimer[t];
+    uint32_t count = r->r, top = compareValue(t, 0), max = timerMax(t);
+    uint32_t period, pos, best;
+
+    if (timerMode(t) == 2) {
+        if (v > max)
+            return 0;
+        return distance(count, v, max + 1);
+    }
+    if (count > top) {
+        // CCR0 was moved below the count: the counter runs on to its end and wraps
+        if (v > count && v <= max)
+            return v - count;
+        if (v <= top)
+            return (max - count) + 1 + v;
+        return 0;
+    }
+    if (v > top)
+        return 0;
+    if (timerMode(t) == 1)
+        return distance(count, v, top + 1);
+
+    // Up/down: positions 0..top count up, top..2*top count back down
+    period = 2 * top;
+    pos = timerState[t].down ? period - count : count;
+    best = distance(pos, v, period);
+    if (v != 0 && v != top) {
+        uint32_t back = distance(pos, period - v, period);
+        if (back < best)
+            best = back;
+    }
+    return best;
+}
+
+static uint32_t timerTicksToEvent(int t)
+{
+    uint32_t best = ticksTo(t, 0); // TAIFG
+    int n;
+
+    for (n = 0; n < timerCcrs[t]; n++) {
+        uint32_t d = ticksTo(t, compareValue(t, n));
+        if (d && (!best || d < best))
+            best = d;
+    }
+    return best;
+}
+
+static void timerStep(int t, uint32_t ticks)
+{
+    SimTimerRegs *r = &simTimer[t];
+    uint32_t top = compareValue(t, 0), max = timerMax(t);
+
+    if (timerMode(t) == 2 || r->r > top) {
+        r->r = (uint16_t)((r->r + ticks) % (max + 1));
+    } else if (timerMode(t) == 1) {
+        r->r = (uint16_t)((r->r + ticks) % (top + 1));
+    } else {
+        uint32_t period = 2 * top;
+        uint32_t pos = ((timerState[t].down ? period - r->r : r->r) + ticks) % period;
+        r->r = (uint16_t)(pos <= top ? pos : period - pos);
+        timerState[t].down = pos >= top;
+    }
+}
+
+// Output pairs that must never be high together (--exclusive), such as the two
+// sides of a half-bridge, with the least time one must stay low after the other
+typedef struct {
+    int t[2], n[2];
+    uint64_t dead; // required gap, cycles
+    uint64_t fell[2]; // cycle each output last went low
+    uint8_t fallen[2]; // it has gone low at least once
+    unsigned long overlaps, shortGaps;
+    uint64_t firstFault, minGap;
+} Exclusive;
+
+#define SIM_EXCLUSIVES 4
+
+static Exclusive exclusives[SIM_EXCLUSIVES];
+static int exclusiveCount;
+
+// Checks the pairs that output (t, n) belongs to, as it goes to level
+static void exclusiveCheck(int t, int n, int level)
+{
+    int i, side;
+
+    for (i = 0; i < exclusiveCount; i++) {
+        Exclusive *x = &exclusives[i];
+        for (side = 0; side < 2; side++) {
+            int other = !side;
+            if (x->t[side] != t || x->n[side] != n)
+                continue;
+            if (!level) {
+                x->fell[side] = now;
+                x->fallen[side] = 1;
+            } else if (timerState[x->t[other]].out[x->n[other]]) {
+                if (!x->overlaps++ && !x->shortGaps)
+                    x->firstFault = now;
+            } else if (x->fallen[other]) {
+                uint64_t gap = now - x->fell[other];
+                if (gap < x->minGap)
+                    x->minGap = gap;
+                if (gap < x->dead && !x->shortGaps++ && !x->overlaps)
+                    x->firstFault = now;
+            }
+        }
+    }
+}
+
+// Timer outputs wired to input pins (--wire), as a jumper from the output's pin
+typedef struct {
+    int t, n, port, bit;
+} Wire;
+
+#define SIM_WIRES 4
+
+static Wire wires[SIM_WIRES];
+static int wireCount;
+
+static void portsUpdate(void);
+
+static void wireDrive(int port, int bit, int level)
+{
+    portState[port].driven |= (uint8_t)(1 << bit);
+    portState[port].level = (uint8_t)((portState[port].level & ~(1 << bit)) | (level << bit));
+}
+
+static void setOutput(int t, int n, int level)
+{
+    char name[8];
+    int i;
+
+    if (timerState[t].out[n] == level)
+        return;
+    timerState[t].out[n] = (uint8_t)level;
+    snprintf(name, sizeof(name), "%s.%d", timerNames[t], n);
+    trace(name, level);
+    exclusiveCheck(t, n, level);
+    for (i = 0; i < wireCount; i++) {
+        if (wires[i].t == t && wires[i].n == n) {
+            wireDrive(wires[i].port, wires[i].bit, level);
+            portsUpdate();
+        }
+    }
+}
+
+// Output unit action when the counter reaches CCRn (atCcr0 = 0) or CCR0 (atCcr0 = 1)
+static void outputAction(int t, int n, int atCcr0)
+{
+    int mode = (simTimer[t].cctl[n] >> 5) & 7;
+    int out = timerState[t].out[n];
+
+    if (!atCcr0) {
+        switch (mode) {
+        case 1: case 3: out = 1; break;
+        case 2: case 4: case 6: out = !out; break;
+        case 5: case 7: out = 0; break;
+        }
+    } else {
+        switch (mode) {
+        case 2: case 3: out = 0; break;
+        case 6: case 7: out = 1; break;
+        }
+    }
+    setOutput(t, n, out);
+}
+
+// DMA
+
+#ifdef SIM_DMA_COUNT
+typedef struct {
+    uint8_t tsel, timer, ccr;
+} DmaTrigger;
+
+typedef struct {
+    uintptr_t sa, da; // working addresses, loaded from DMAxSA/DMAxDA when the channel is enabled
+    uint16_t sz; // transfers left in the block
+    uint8_t enabled;
+} DmaState;
+
+static const DmaTrigger dmaTriggers[] = SIM_DMA_TRIGGERS;
+static DmaState dmaState[SIM_DMA_CHANNELS];
+
+static int dmaTsel(int ch)
+{
+    return (simDma.ctl[ch / 2] >> (8 * (ch & 1))) & 0x1F;
+}
+
+static uintptr_t dmaStep(uintptr_t address, int incr, int size)
+{
+    return incr == 3 ? address + size : incr == 2 ? address - size : address;
+}
+
+// One trigger of channel ch: one transfer, or the whole block in the block modes
+static void dmaRun(int ch)
+{
+    SimDmaChannel *c = &simDma.ch[ch];
+    DmaState *s = &dmaState[ch];
+    int mode = (c->ctl >> 12) & 7;
+    int srcSize = c->ctl & 0x0040 ? 1 : 2, dstSize = c->ctl & 0x0080 ? 1 : 2;
+
+    do {
+        uint16_t value;
+
+        if (!s->sz)
+            break;
+        value = srcSize == 1 ? *(uint8_t *)s->sa : *(uint16_t *)s->sa;
+        if (dstSize == 1)
+            *(uint8_t *)s->da = (uint8_t)value;
+        else
+            *(uint16_t *)s->da = value;
+        s->sa = dmaStep(s->sa, (c->ctl >> 8) & 3, srcSize);
+        s->da = dmaStep(s->da, (c->ctl >> 10) & 3, dstSize);
+        s->sz--;
+        dmaTransfers++;
+    } while (mode & 3); // block and burst-block modes run to the end of the block
+
+    if (!s->sz) {
+        c->ctl |= 0x0008; // DMAIFG
+        if (mode >= 4) { // repeated modes start over
+            s->sa = c->sa;
+            s->da = c->da;
+            s->sz = c->sz;
+        } else {
+            c->ctl &= ~0x0010; // DMAEN
+            s->enabled = 0;
+        }
+    }
+}
+
+// Enables, and DMAREQ software triggers, of the previous access
+static void dmaWrites(void)
+{
+    int ch;
+
+    for (ch = 0; ch < SIM_DMA_COUNT; ch++) {
+        SimDmaChannel *c = &simDma.ch[ch];
+        DmaState *s = &dmaState[ch];
+        int enabled = (c->ctl & 0x0010) != 0;
+
+        if (enabled && !s->enabled) {
+            s->sa = c->sa;
+            s->da = c->da;
+            s->sz = c->sz;
+        }
+        s->enabled = (uint8_t)enabled;
+        if (c->ctl & 0x0001) { // DMAREQ
+            c->ctl &= ~0x0001;
+            if (enabled && dmaTsel(ch) == 0)
+                dmaRun(ch);
+        }
+    }
+}
+
+// CCIFG of timer t, CCRn was just set: runs the channels it triggers. The DMA
+// takes the flag when CCIE is off, with CCIE on it triggers nothing.
+static void dmaTimerFlag(int t, int n)
+{
+    size_t i;
+    int ch, taken = 0;
+
+    if (simTimer[t].cctl[n] & CCIE)
+        return;
+    for (i = 0; i < sizeof(dmaTriggers) / sizeof(dmaTriggers[0]); i++) {
+        if (dmaTriggers[i].timer != t || dmaTriggers[i].ccr != n)
+            continue;
+        for (ch = 0; ch < SIM_DMA_COUNT; ch++) {
+            if (dmaState[ch].enabled && dmaTsel(ch) == dmaTriggers[i].tsel) {
+                dmaRun(ch);
+                taken = 1;
+            }
+        }
+    }
+    if (taken)
+        simTimer[t].cctl[n] &= ~CCIFG;
+}
+#else
+static void dmaWrites(void)
+{
+}
+
+static void dmaTimerFlag(int t, int n)
+{
+    (void)t;
+    (void)n;
+}
+#endif
+
+// Timer_B: the compare latch group of CCR n, as TBCLGRP sets it. Returns the
+// CCR whose CLLD bits rule the group and sets its mask of CCRs.
+static int latchGroup(int t, int n, uint8_t *mask)
+{
+    int first, last, rule;
+
+    switch ((simTimer[t].ctl >> 13) & 3) { // TBCLGRP
+    case 1: // 1+2, 3+4, 5+6
+        first = n ? n - !(n & 1) : 0;
+        last = n ? first + 1 : 0;
+        rule = first;
+        break;
+    case 2: // 1+2+3, 4+5+6
+        first = !n ? 0 : n <= 3 ? 1 : 4;
+        last = n ? first + 2 : 0;
+        rule = first;
+        break;
+    case 3: // all, ruled by CCR1
+        first = 0;
+        last = SIM_CCRS - 1;
+        rule = 1;
+        break;
+    default:
+        first = last = rule = n;
+        break;
+    }
+    if (last >= timerCcrs[t])
+        last = timerCcrs[t] - 1;
+    *mask = (uint8_t)(((2u << last) - 1) & ~((1u << first) - 1));
+    return rule;
+}
+
+// Loads the latches of a group, if every CCR of it has been updated. The
+// manual requires that for groups even when a value does not change.
+static void latchLoad(int t, uint8_t mask)
+{
+    int n;
+
+    if ((timerState[t].updated & mask) != mask)
+        return;
+    for (n = 0; n < timerCcrs[t]; n++)
+        if (mask & (1 << n))
+            timerState[t].cl[n] = simTimer[t].ccr[n];
+    timerState[t].updated &= ~mask;
+}
+
+// Timer_B: loads the TBxCLn latches whose CLLD event is the count just reached.
+// Loads at 0 come before that count's compares, loads at a compare value after.
+static void timerLatch(int t, int afterCompare, const uint16_t *before)
+{
+    SimTimerRegs *r = &simTimer[t];
+    uint8_t mask, done = 0;
+    int n, rule, load;
+
+    for (n = 0; n < timerCcrs[t]; n++) {
+        if (done & (1 << n))
+            continue;
+        rule = latchGroup(t, n, &mask);
+        done |= mask;
+        switch ((r->cctl[rule] >> 9) & 3) { // CLLD
+        case 1:
+            load = !afterCompare && r->r == 0;
+            break;
+        case 2:
+            load = afterCompare ? timerMode(t) == 3 && r->r == before[0] : r->r == 0;
+            break;
+        case 3:
+            load = afterCompare && r->r == before[rule];
+            break;
+        default:
+            load = 0; // CLLD_0 loads on the write, see applyWrites()
+            break;
+        }
+        if (load) {
+            if (mask == (1 << n))
+                timerState[t].updated |= mask; // a single latch loads whatever was written
+            latchLoad(t, mask);
+        }
+    }
+}
+
+// Compare and overflow events at the count the timer just reached
+static void timerEvents(int t)
+{
+    SimTimerRegs *r = &simTimer[t];
+    uint16_t before[SIM_CCRS];
+    int n;
+
+    if (t >= SIM_TB0) {
+        timerLatch(t, 0, 0);
+        memcpy(before, timerState[t].cl, sizeof(before));
+    }
+    for (n = 1; n < timerCcrs[t]; n++) {
+        if (!(r->cctl[n] & CAP) && r->r == compareValue(t, n)) {
+            r->cctl[n] |= CCIFG;
+            outputAction(t, n, 0);
+            dmaTimerFlag(t, n);
+        }
+    }
+    if (!(r->cctl[0] & CAP) && r->r == compareValue(t, 0)) {
+        r->cctl[0] |= CCIFG;
+        outputAction(t, 0, 0);
+        for (n = 1; n < timerCcrs[t]; n++)
+            outputAction(t, n, 1);
+        dmaTimerFlag(t, 0);
+    }
+    if (t >= SIM_TB0)
+        timerLatch(t, 1, before);
+    if (r->r == 0)
+        r->ctl |= 0x0001; // TAIFG/TBIFG
+}
+
+static uint64_t timerCyclesToEvent(int t)
+{
+    uint64_t unit = (uint64_t)CLOCK_MCLK_HZ * timerDivider(t);
+    uint64_t src = timerSourceHz(t);
+    uint32_t ticks;
+
+    if (!timerRunning(t) || !(ticks = timerTicksToEvent(t)))
+        return NEVER;
+    return (ticks * unit - timerState[t].phase + src - 1) / src;
+}
+
+// Moves the count on, 1 when it reached its next event (see timerEvents())
+static int timerElapse(int t, uint64_t cycles)
+{
+    uint64_t unit = (uint64_t)CLOCK_MCLK_HZ * timerDivider(t);
+    uint32_t event = timerTicksToEvent(t);
+    uint64_t ticks;
+
+    timerState[t].phase += cycles * timerSourceHz(t);
+    ticks = timerState[t].phase / unit;
+    timerState[t].phase -= ticks * unit;
+    if (!ticks)
+        return 0;
+    timerStep(t, (uint32_t)ticks);
+    return ticks == event;
+}
+
+// Watchdog
+// Counts its source clock while WDTHOLD is clear. In interval mode (WDTTMSEL)
+// the end of an interval sets WDTIFG and the count starts over; in watchdog
+// mode it resets the device, which ends the run.
+
+#if defined(__MSP430G2553__)
+#define WDT_IE simMisc.ie1
+#define WDT_IFG simMisc.ifg1
+#else
+#define WDT_IE simMisc.sfrie1
+#define WDT_IFG simMisc.sfrifg1
+#endif
+#define SIM_VLO_HZ 10000 // WDT_A's VLO source, typical
+
+static uint64_t wdtPhase; // source clock phase, in MCLK cycles x source Hz
+static uint64_t wdtCount; // source clocks into the interval
+
+static int wdtSource(void)
+{
+#if defined(__MSP430G2553__)
+    return (simMisc.wdtctl & WDTSSEL) ? 1 : 0; // ACLK, SMCLK
+#else
+    return (simMisc.wdtctl >> 5) & 3; // SMCLK, ACLK, VLO, X_CLK (VLO on these parts)
+#endif
+}
+
+static uint64_t wdtSourceHz(void)
+{
+    if (simMisc.wdtctl & WDTHOLD)
+        return 0;
+    switch (wdtSource()) {
+    case 0:
+        return smclkStopped() ? 0 : CLOCK_SMCLK_HZ;
+    case 1:
+        return CLOCK_ACLK_HZ;
+    default:
+        return SIM_VLO_HZ;
+    }
+}
+
+// Source clocks per interval, WDTISx
+static uint64_t wdtInterval(void)
+{
+#if defined(__MSP430G2553__)
+    static const uint64_t clocks[4] = { 32768, 8192, 512, 64 };
+
+    return clocks[simMisc.wdtctl & 3];
+#else
+    static const uint8_t shifts[8] = { 31, 27, 23, 19, 15, 13, 9, 6 };
+
+    return 1ULL << shifts[simMisc.wdtctl & 7];
+#endif
+}
+
+static uint64_t wdtCyclesToEvent(void)
+{
+    uint64_t src = wdtSourceHz();
+
+    if (!src)
+        return NEVER;
+    return ((wdtInterval() - wdtCount) * CLOCK_MCLK_HZ - wdtPhase + src - 1) / src;
+}
+
+static void wdtElapse(uint64_t cycles)
+{
+    uint64_t ticks;
+
+    wdtPhase += cycles * wdtSourceHz();
+    ticks = wdtPhase / CLOCK_MCLK_HZ;
+    wdtPhase -= ticks * CLOCK_MCLK_HZ;
+    wdtCount += ticks;
+    if (wdtCount < wdtInterval())
+        return;
+    wdtCount %= wdtInterval();
+    if (!(simMisc.wdtctl & WDTTMSEL))
+        longjmp(endJump, 3);
+    WDT_IFG |= WDTIFG;
+}
+
+// Ports
+
+static const uint8_t portPresent[SIM_PORTS] = {
+#ifdef P1OUT
+    [SIM_P1] = 1,
+#endif
+#ifdef P2OUT
+    [SIM_P2] = 1,
+#endif
+#ifdef P3OUT
+    [SIM_P3] = 1,
+#endif
+#ifdef P4OUT
+    [SIM_P4] = 1,
+#endif
+#ifdef P5OUT
+    [SIM_P5] = 1,
+#endif
+#ifdef P6OUT
+    [SIM_P6] = 1,
+#endif
+#ifdef P7OUT
+    [SIM_P7] = 1,
+#endif
+#ifdef P8OUT
+    [SIM_P8] = 1,
+#endif
+#ifdef P9OUT
+    [SIM_P9] = 1,
+#endif
+#ifdef P10OUT
+    [SIM_P10] = 1,
+#endif
+#ifdef PJOUT
+    [SIM_PJ] = 1,
+#endif
+};
+
+// Capture inputs: the CCIxA pins the simulator connects, from Simulator/msp430.h.
+// The input reaches the timer when the pin is selected for a peripheral
+// (PxSEL, PxSEL0 or PxSEL1 set). Captures take the count at the edge; SCS
+// synchronisation to the timer clock is not modelled.
+typedef struct {
+    uint8_t timer, ccr, port, bit;
+} CaptureInput;
+
+#ifdef SIM_CAPTURE_INPUTS
+static const CaptureInput captureInputs[] = SIM_CAPTURE_INPUTS;
+#define CAPTURE_INPUTS (sizeof(captureInputs) / sizeof(captureInputs[0]))
+#else
+static const CaptureInput captureInputs[1];
+#define CAPTURE_INPUTS 0
+#endif
+
+// Pin p.bit just changed to level: CCI follows it, and a capture mode CCR
+// whose edge it is copies the count (COV if the last capture is still unread)
+static void captureEdge(int p, int bit, int level)
+{
+    size_t i;
+
+    for (i = 0; i < CAPTURE_INPUTS; i++) {
+        const CaptureInput *c = &captureInputs[i];
+        SimPortRegs *r = &simPort[p];
+        uint16_t *cctl = &simTimer[c->timer].cctl[c->ccr];
+        int mode = (*cctl >> 14) & 3;
+        if (c->port != p || c->bit != bit || !((r->sel | r->sel0 | r->sel1) & (1 << bit)))
+            continue;
+        if (*cctl & CCIS_3)
+            continue; // CCIxB, GND or VCC
+        *cctl = (uint16_t)((*cctl & ~CCI) | (level ? CCI : 0));
+        if (!(*cctl & CAP) || !(mode & (level ? 1 : 2)))
+            continue;
+        if (*cctl & CCIFG)
+            *cctl |= COV;
+        simTimer[c->timer].ccr[c->ccr] = simTimer[c->timer].r;
+        *cctl |= CCIFG;
+        dmaTimerFlag(c->timer, c->ccr);
+    }
+}
+
+// Recomputes the pin levels and latches edges into PxIFG
+static void portsUpdate(void)
+{
+    int p, bit;
+
+    for (p = 0; p < SIM_PORTS; p++) {
+        SimPortRegs *r = &simPort[p];
+        PortState *s = &portState[p];
+        uint8_t sel = r->sel | r->sel0 | r->sel1;
+        uint8_t output = r->dir & ~sel; // general purpose outputs
+        uint8_t input = ~r->dir;
+        uint8_t pulled = input & ~s->driven & r->ren;
+        uint8_t pin, changed;
+
+        if (!portPresent[p])
+            continue;
+        pin = (r->out & output) | (s->level & s->driven & input) | (r->out & pulled);
+        pin |= s->pin & ~(output | (s->driven & input) | pulled); // floating and peripheral pins hold
+        changed = pin ^ s->pin;
+        r->in = pin;
+        if (!changed)
+            continue;
+        r->ifg |= (changed & pin & ~r->ies) | (changed & ~pin & r->ies);
+        s->pin = pin;
+        for (bit = 0; bit < 8; bit++) {
+            if (changed & (1 << bit)) {
+                char name[8];
+                snprintf(name, sizeof(name), "P%s.%d", portNames[p], bit);
+                trace(name, (pin >> bit) & 1);
+                captureEdge(p, bit, (pin >> bit) & 1);
+            }
+        }
+    }
+}
+
+// Side effects of the previous register access
+// Timer_B: CLLD_0 latches load on the write, grouped ones once the whole group is written
+static void latchWrites(int t)
+{
+    uint8_t mask, done = 0;
+    int n, rule;
+
+    for (n = 0; n < timerCcrs[t]; n++) {
+        if (done & (1 << n))
+            continue;
+        rule = latchGroup(t, n, &mask);
+        done |= mask;
+        if (simTimer[t].cctl[rule] & 0x0600)
+            continue; // loads at a CLLD event, see timerLatch()
+        if (mask == (1 << n))
+            timerState[t].updated |= mask;
+        latchLoad(t, mask);
+    }
+}
+
+static void applyWrites(void)
+{
+    int t, n;
+
+    for (t = 0; t < SIM_TIMERS; t++) {
+        SimTimerRegs *r = &simTimer[t];
+        if (!timerCcrs[t])
+            continue;
+        if (r->ctl & 0x0004) { // TACLR/TBCLR: clear count, divider and direction
+            r->ctl &= ~0x0004;
+            r->r = 0;
+            timerState[t].phase = 0;
+            timerState[t].down = 0;
+        }
+        for (n = 0; n < timerCcrs[t]; n++)
+            if (!(r->cctl[n] & 0x00E0)) // OUTMOD_0 follows the OUT bit
+                setOutput(t, n, (r->cctl[n] & OUT) != 0);
+        if (t >= SIM_TB0)
+            latchWrites(t);
+    }
+    if (simMisc.wdtctl & WDTCNTCL) { // clears the count, and reads back 0
+        simMisc.wdtctl &= ~WDTCNTCL;
+        wdtCount = 0;
+        wdtPhase = 0;
+    }
+    dmaWrites();
+    portsUpdate();
+}
+
+// Time
+
+static void applyStimuli(void)
+{
+    int any = 0;
+
+    while (nextStimulus < stimulusCount && stimuli[nextStimulus].cycle <= now) {
+        Stimulus *s = &stimuli[nextStimulus++];
+        PortState *p = &portState[s->port];
+        if (s->level == SIM_Z) {
+            p->driven &= ~(1 << s->bit);
+        } else {
+            p->driven |= 1 << s->bit;
+            p->level = (uint8_t)((p->level & ~(1 << s->bit)) | (s->level << s->bit));
+        }
+        any = 1;
+    }
+    if (any)
+        portsUpdate();
+}
+
+static uint64_t nextEvent(void)
+{
+    uint64_t next = endCycles, c;
+    int t;
+
+    for (t = 0; t < SIM_TIMERS; t++) {
+        c = timerCyclesToEvent(t);
+        if (c != NEVER && now + c < next)
+            next = now + c;
+    }
+    c = wdtCyclesToEvent();
+    if (c != NEVER && now + c < next)
+        next = now + c;
+    if (nextStimulus < stimulusCount && stimuli[nextStimulus].cycle < next)
+        next = stimuli[nextStimulus].cycle > now ? stimuli[nextStimulus].cycle : now;
+    return next;
+}
+
+// Sleep time by low-power mode, from the SR bits the CPU sleeps with
+static void sleepCount(uint64_t cycles)
+{
+    int lpm = (sr & OSCOFF) ? 4 : ((sr & SCG1) ? 2 : 0) + ((sr & SCG0) ? 1 : 0);
+    int t;
+
+    lpmCycles[lpm] += cycles;
+    if (!(sr & SCG1) || smclkStopped())
+        return;
+    if (wdtSourceHz() && wdtSource() == 0) {
+        smclkHeldCycles += cycles;
+        return;
+    }
+    for (t = 0; t < SIM_TIMERS; t++) {
+        if (timerRunning(t) && ((simTimer[t].ctl >> 8) & 3) == 2) {
+            smclkHeldCycles += cycles;
+            return;
+        }
+    }
+}
+
+static void advance(uint64_t cycles)
+{
+    uint64_t target = now + cycles;
+
+    while (now < target) {
+        uint64_t next = nextEvent(), elapsed;
+        int reached[SIM_TIMERS];
+        int t;
+
+        if (next > target)
+            next = target;
+        elapsed = next - now;
+        contextCycles[context] += elapsed;
+        if (sr & CPUOFF)
+            sleepCount(elapsed);
+        now = next; // events below are stamped with the time they happen
+        // Every count first, so an event of one timer (an output wired to a
+        // capture input) sees the others where they are now
+        for (t = 0; t < SIM_TIMERS; t++)
+            reached[t] = timerRunning(t) && timerElapse(t, elapsed);
+        for (t = 0; t < SIM_TIMERS; t++) {
+            if (reached[t])
+                timerEvents(t);
+        }
+        wdtElapse(elapsed);
+        applyStimuli();
+        if (now >= endCycles)
+            longjmp(endJump, 1);
+    }
+}
+
+// Interrupts
+
+static int sourcePending(const Source *s)
+{
+    int n;
+
+    switch (s->kind) {
+    case SRC_PORT:
+        return (simPort[s->unit].ie & simPort[s->unit].ifg) != 0;
+    case SRC_CCR0:
+        return (simTimer[s->unit].cctl[0] & (CCIE | CCIFG)) == (CCIE | CCIFG);
+    case SRC_WDT:
+        return (WDT_IE & WDT_IFG & WDTIE) != 0;
+    default:
+        for (n = 1; n < timerCcrs[s->unit]; n++) {
+            if ((simTimer[s->unit].cctl[n] & (CCIE | CCIFG)) == (CCIE | CCIFG))
+                return 1;
+        }
+        return (simTimer[s->unit].ctl & 0x0003) == 0x0003; // TAIE and TAIFG
+    }
+}
+
+static void dispatch(void)
+{
+    while ((sr & GIE) && inIsr < 0) {
+        const Source *best = NULL;
+        size_t i, v;
+        uint64_t start;
+        int saved = context;
+
+        for (i = 0; i < SOURCES; i++) {
+            if (sourcePending(&sources[i]) && (!best || sources[i].vector > best->vector))
+                best = &sources[i];
+        }
+        if (!best)
+            return;
+        for (v = 0; v < vectorCount && simVectors[v].vector != best->vector; v++);
+        if (v == vectorCount) {
+            unhandledVector = best->vector;
+            longjmp(endJump, 2);
+        }
+        if (best->kind == SRC_CCR0)
+            simTimer[best->unit].cctl[0] &= ~CCIFG; // cleared when the interrupt is accepted
+        else if (best->kind == SRC_WDT)
+            WDT_IFG &= ~WDTIFG; // so is the interval flag
+
+        start = now;
+        isrExitSR = sr;
+        sr &= ~(GIE | CPUOFF | OSCOFF | SCG1);
+        context = CTX_ISR;
+        inIsr = (int)v;
+        trace(simVectors[v].name, 1);
+        advance(SIM_CYCLES_IRQ);
+        simVectors[v].isr();
+        applyWrites();
+        advance(SIM_CYCLES_RETI);
+        trace(simVectors[v].name, 0);
+        inIsr = -1;
+        context = saved;
+        sr = isrExitSR;
+
+        isrStats[v].calls++;
+        isrStats[v].total += now - start;
+        if (!isrStats[v].min || now - start < isrStats[v].min)
+            isrStats[v].min = now - start;
+        if (now - start > isrStats[v].max)
+            isrStats[v].max = now - start;
+    }
+}
+
+// Runs events and interrupts until an ISR clears CPUOFF (or forever after main)
+static void idle(int ctx)
+{
+    int saved = context;
+
+    context = ctx;
+    dispatch();
+    while (ctx == CTX_RETURNED || (sr & CPUOFF)) {
+        applyWrites();
+        advance(nextEvent() - now);
+        dispatch();
+    }
+    context = saved;
+}
+
+// Register access hooks
+
+void *simAccess(void *reg)
+{
+    int t;
+
+    applyWrites();
+    advance(SIM_CYCLES_ACCESS);
+    // The value lands at the end of the access, so a load during it takes the old one
+    for (t = SIM_TB0; t < SIM_TIMERS; t++) {
+        uint16_t *ccr = simTimer[t].ccr;
+        if ((uint16_t *)reg >= ccr && (uint16_t *)reg < ccr + timerCcrs[t])
+            timerState[t].updated |= (uint8_t)(1 << ((uint16_t *)reg - ccr)); // a group load needs it
+    }
+    if (inIsr < 0)
+        dispatch();
+    return reg;
+}
+
+void simWriteAddr(uintptr_t reg, uintptr_t value)
+{
+    *(volatile uintptr_t *)simAccess((void *)reg) = value;
+}
+
+uint16_t simTimerIV(int t)
+{
+    SimTimerRegs *r = &simTimer[t];
+    int n;
+
+    applyWrites();
+    advance(SIM_CYCLES_ACCESS);
+    for (n = 1; n < timerCcrs[t]; n++) {
+        if ((r->cctl[n] & (CCIE | CCIFG)) == (CCIE | CCIFG)) {
+            r->cctl[n] &= ~CCIFG; // reading IV clears the flag it reports
+            return (uint16_t)(2 * n);
+        }
+    }
+    if ((r->ctl & 0x0003) == 0x0003) {
+        r->ctl &= ~0x0001;
+        return t >= SIM_TB0 ? 0x0E : IV_TAIFG;
+    }
+    return 0;
+}
+
+uint16_t simPortIV(int p)
+{
+    uint8_t pending;
+    int bit;
+
+    applyWrites();
+    advance(SIM_CYCLES_ACCESS);
+    pending = simPort[p].ie & simPort[p].ifg;
+    for (bit = 0; bit < 8; bit++) {
+        if (pending & (1 << bit)) {
+            simPort[p].ifg &= ~(1 << bit);
+            return (uint16_t)(2 * (bit + 1));
+        }
+    }
+    return 0;
+}
+
+// Intrinsics
+
+void simBisSR(unsigned bits)
+{
+    sr |= bits;
+    applyWrites();
+    if (inIsr < 0) {
+        if (sr & CPUOFF)
+            idle(CTX_SLEEP);
+        else
+            dispatch();
+    }
+}
+
+void simBicSR(unsigned bits)
+{
+    sr &= ~bits;
+}
+
+void simBisSROnExit(unsigned bits)
+{
+    isrExitSR |= bits;
+}
+
+void simBicSROnExit(unsigned bits)
+{
+    isrExitSR &= ~bits;
+}
+
+unsigned simGetSR(void)
+{
+    return sr;
+}
+
+void simDelayCycles(unsigned long cycles)
+{
+    applyWrites();
+    advance(cycles);
+    if (inIsr < 0)
+        dispatch();
+}
+
+// Control
+
+void simInit(uint64_t end)
+{
+    endCycles = end;
+    for (vectorCount = 0; simVectors[vectorCount].isr; vectorCount++);
+    isrStats = calloc(vectorCount ? vectorCount : 1, sizeof(IsrStats));
+
+    // Factory state the programs check before they trust it
+    simMisc.calbc1_1mhz = 0x86;
+    simMisc.caldco_1mhz = 0xB5;
+    simMisc.calbc1_8mhz = 0x8D;
+    simMisc.caldco_8mhz = 0x92;
+    simMisc.calbc1_12mhz = 0x8E;
+    simMisc.caldco_12mhz = 0x9E;
+    simMisc.calbc1_16mhz = 0x8F;
+    simMisc.caldco_16mhz = 0x95;
+#ifdef SVSMLDLYIFG
+    simMisc.pmmifg = SVSMLDLYIFG; // SVM settled
+#endif
+#if defined(__MSP430G2553__)
+    simMisc.wdtctl = 0x6900; // running after reset, watchdog mode, SMCLK / 32768
+#else
+    simMisc.wdtctl = 0x6904;
+#endif
+}
+
+static int stimulusOrder(const void *a, const void *b)
+{
+    const Stimulus *x = a, *y = b;
+
+    return x->cycle < y->cycle ? -1 : x->cycle > y->cycle;
+}
+
+void simDrivePin(uint64_t cycle, int port, int bit, int level)
+{
+    if (port < 0 || port >= SIM_PORTS || !portPresent[port] || bit < 0 || bit > 7) {
+        fprintf(stderr, "sim: %s has no pin P%s.%d\n", SIM_DEVICE,
+                port >= 0 && port < SIM_PORTS ? portNames[port] : "?", bit);
+        exit(1);
+    }
+    if (stimulusCount == stimulusCap) {
+        stimulusCap = stimulusCap ? 2 * stimulusCap : 64;
+        stimuli = realloc(stimuli, stimulusCap * sizeof(Stimulus));
+    }
+    stimuli[stimulusCount].cycle = cycle;
+    stimuli[stimulusCount].port = (uint8_t)port;
+    stimuli[stimulusCount].bit = (uint8_t)bit;
+    stimuli[stimulusCount].level = (uint8_t)level;
+    stimulusCount++;
+    // Stable sort keeps the file order of stimuli at the same time
+    qsort(stimuli, stimulusCount, sizeof(Stimulus), stimulusOrder);
+}
+
+void simTrace(FILE *f)
+{
+    traceFile = f;
+}
+
+uint64_t simNow(void)
+{
+    return now;
+}
+
+int simRun(void (*program)(void))
+{
+    int why = setjmp(endJump);
+
+    if (why == 0) {
+        program();
+        idle(CTX_RETURNED); // returns only through endJump
+    }
+    if (traceFile)
+        fflush(traceFile);
+    if (why == 2) {
+        fprintf(stderr, "sim: interrupt vector %d is pending but has no #pragma vector handler\n",
+                unhandledVector);
+        return -1;
+    }
+    if (why == 3) {
+        fprintf(stderr, "sim: the watchdog expired at %.3f ms and would reset the device\n",
+                now * 1000.0 / CLOCK_MCLK_HZ);
+        return -1;
+    }
+    return 0;
+}
+
+// Parses a timer output name such as TA0.1
+static int outputByName(const char *name, size_t len, int *t, int *n)
+{
+    for (*t = 0; *t < SIM_TIMERS; (*t)++) {
+        size_t l = strlen(timerNames[*t]);
+        if (timerCcrs[*t] && len == l + 2 && !strncmp(name, timerNames[*t], l) && name[l] == '.') {
+            *n = name[l + 1] - '0';
+            return *n >= 0 && *n < timerCcrs[*t];
+        }
+    }
+    return 0;
+}
+
+int simExclusive(const char *a, const char *b, uint64_t dead)
+{
+    Exclusive *x = &exclusives[exclusiveCount];
+
+    if (exclusiveCount == SIM_EXCLUSIVES || !outputByName(a, strlen(a), &x->t[0], &x->n[0])
+        || !outputByName(b, strlen(b), &x->t[1], &x->n[1]))
+        return 0;
+    x->dead = dead;
+    x->minGap = NEVER;
+    exclusiveCount++;
+    return 1;
+}
+
+int simWire(const char *output, int port, int bit)
+{
+    Wire *w = &wires[wireCount];
+
+    if (wireCount == SIM_WIRES || !outputByName(output, strlen(output), &w->t, &w->n)
+        || port < 0 || port >= SIM_PORTS || !portPresent[port] || bit < 0 || bit > 7)
+        return 0;
+    w->port = port;
+    w->bit = bit;
+    wireDrive(port, bit, timerState[w->t].out[w->n]);
+    wireCount++;
+    return 1;
+}
+
+int simReport(FILE *f, char **budgets, int nBudgets)
+{
+    double ms = now * 1000.0 / CLOCK_MCLK_HZ;
+    double host = (double)clock() / CLOCKS_PER_SEC;
+    uint64_t isrTotal = 0;
+    size_t v;
+    int i, over = 0;
+
+    fprintf(f, "%s at %lu Hz: %.3f ms simulated (%llu cycles) in %.3f s host time\n",
+            SIM_DEVICE, (unsigned long)CLOCK_MCLK_HZ, ms, (unsigned long long)now, host);
+    fprintf(f, "main %llu, ISRs %llu, LPM %llu, after main returned %llu cycles\n",
+            (unsigned long long)contextCycles[CTX_MAIN], (unsigned long long)contextCycles[CTX_ISR],
+            (unsigned long long)contextCycles[CTX_SLEEP], (unsigned long long)contextCycles[CTX_RETURNED]);
+    fprintf(f, "asleep LPM0 %llu, LPM1 %llu, LPM2 %llu, LPM3 %llu, LPM4 %llu cycles, SMCLK held on by a timer %llu\n",
+            (unsigned long long)lpmCycles[0], (unsigned long long)lpmCycles[1], (unsigned long long)lpmCycles[2],
+            (unsigned long long)lpmCycles[3], (unsigned long long)lpmCycles[4], (unsigned long long)smclkHeldCycles);
+    fprintf(f, "%-20s %8s %6s %8s %6s %10s  (estimated cycles)\n", "ISR", "calls", "min", "mean", "max", "total");
+    for (v = 0; v < vectorCount; v++) {
+        IsrStats *s = &isrStats[v];
+        fprintf(f, "%-20s %8llu %6llu %8.1f %6llu %10llu\n", simVectors[v].name,
+                (unsigned long long)s->calls, (unsigned long long)s->min,
+                s->calls ? (double)s->total / s->calls : 0.0,
+                (unsigned long long)s->max, (unsigned long long)s->total);
+        isrTotal += s->total;
+    }
+    fprintf(f, "ISR load %.3f %%\n", now ? 100.0 * isrTotal / now : 0.0);
+    if (dmaTransfers)
+        fprintf(f, "DMA %llu transfers, %llu estimated cycles, load %.3f %%\n",
+                (unsigned long long)dmaTransfers, (unsigned long long)(dmaTransfers * SIM_CYCLES_DMA),
+                now ? 100.0 * dmaTransfers * SIM_CYCLES_DMA / now : 0.0);
+
+    // Exclusive pairs: any overlap is a shoot-through, any shorter gap a dead time violation
+    for (i = 0; i < exclusiveCount; i++) {
+        Exclusive *x = &exclusives[i];
+        char pair[24];
+        snprintf(pair, sizeof(pair), "%s.%d/%s.%d", timerNames[x->t[0]], x->n[0],
+                 timerNames[x->t[1]], x->n[1]);
+        fprintf(f, "%s: %lu overlaps, %lu gaps under %llu cycles, shortest gap %llu cycles\n", pair,
+                x->overlaps, x->shortGaps, (unsigned long long)x->dead,
+                x->minGap == NEVER ? 0ULL : (unsigned long long)x->minGap);
+        if (x->overlaps || x->shortGaps) {
+            fprintf(f, "SHOOT-THROUGH: %s, first at %.3f ms\n", pair, x->firstFault * 1000.0 / CLOCK_MCLK_HZ);
+            over++;
+        }
+    }
+
+    // Budgets: NAME=CYCLES, the most one call of the ISR may take
+    for (i = 0; i < nBudgets; i++) {
+        char *eq = strchr(budgets[i], '=');
+        size_t len = eq ? (size_t)(eq - budgets[i]) : 0;
+        int found = 0;
+        for (v = 0; eq && v < vectorCount; v++) {
+            if (strlen(simVectors[v].name) == len && !strncmp(simVectors[v].name, budgets[i], len)) {
+                unsigned long limit = strtoul(eq + 1, NULL, 10);
+                found = 1;
+                if (isrStats[v].max > limit) {
+                    fprintf(f, "BUDGET EXCEEDED: %s max %llu > %lu cycles\n", simVectors[v].name,
+                            (unsigned long long)isrStats[v].max, limit);
+                    over++;
+                }
+            }
+        }
+        if (!found) {
+            fprintf(f, "BUDGET UNKNOWN: %s\n", budgets[i]);
+            over++;
+        }
+    }
+    return over;
+}
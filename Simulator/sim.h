@@ -0,0 +1,105 @@
+// Host simulator core: the register model behind Simulator/msp430.h
+//
+// Every register macro in Simulator/msp430.h goes through simAccess(), which first
+// advances simulated time by SIM_CYCLES_ACCESS and applies the side effects of the
+// previous access (TACLR, pin edges, compare matches), then hands back the storage.
+// Interrupts are dispatched between accesses of main() and while the CPU sleeps.
+//
+// Cycle estimates count only what the simulator can see: register accesses,
+// interrupt entry and RETI. RAM and ALU work between accesses is free, so the
+// numbers are lower bounds for comparing versions of a program, not hardware timings.
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Cost model, in MCLK cycles (MSP430x2xx/5xx family user's guides)
+#define SIM_CYCLES_ACCESS 4 // one peripheral register access (absolute operand: 3-5)
+#define SIM_CYCLES_IRQ 6 // interrupt acceptance
+#define SIM_CYCLES_RETI 5 // return from interrupt
+#define SIM_CYCLES_DMA 2 // one DMA transfer, the CPU is held meanwhile
+
+#define SIM_CCRS 7 // most CCRs a timer can have (Timer_B7)
+#define SIM_Z 2 // pin level: not driven from outside
+#define SIM_DMA_CHANNELS 6 // most channels a DMA controller can have (FR5994)
+
+enum { SIM_TA0, SIM_TA1, SIM_TA2, SIM_TA3, SIM_TA4, SIM_TB0, SIM_TB1, SIM_TB2, SIM_TIMERS };
+enum { SIM_P1, SIM_P2, SIM_P3, SIM_P4, SIM_P5, SIM_P6, SIM_P7, SIM_P8, SIM_P9, SIM_P10, SIM_PJ, SIM_PORTS };
+
+typedef struct {
+    uint16_t ctl, r, ex0;
+    uint16_t cctl[SIM_CCRS];
+    uint16_t ccr[SIM_CCRS];
+} SimTimerRegs;
+
+typedef struct {
+    uint8_t in, out, dir, ren, sel, sel0, sel1, sel2, ies, ie, ifg, ds;
+} SimPortRegs;
+
+// Registers the programs only store to: clock system, power. The watchdog's
+// (WDTCTL, its enable and flag in IE1/IFG1 or SFRIE1/SFRIFG1) are modelled in sim.c.
+typedef struct {
+    uint16_t wdtctl, pm5ctl0, sfrie1, sfrifg1, frctl0;
+    uint16_t csctl[9], ucsctl[9];
+    uint16_t pmmctl0, pmmifg, svsmhctl, svsmlctl;
+    uint8_t bcsctl1, bcsctl2, bcsctl3, dcoctl, ie1, ifg1;
+    uint8_t calbc1_1mhz, caldco_1mhz, calbc1_8mhz, caldco_8mhz;
+    uint8_t calbc1_12mhz, caldco_12mhz, calbc1_16mhz, caldco_16mhz;
+    uint8_t pmmctl0_l, pmmctl0_h, csctl0_h, frctl0_h;
+} SimMiscRegs;
+
+// DMA channel: DMAxSA and DMAxDA hold host addresses, so programs set them with
+// __data16_write_addr() as they do for the 20-bit registers of the real parts
+typedef struct {
+    uint16_t ctl, sz;
+    uintptr_t sa, da;
+} SimDmaChannel;
+
+typedef struct {
+    uint16_t ctl[5]; // DMACTL0-DMACTL4
+    SimDmaChannel ch[SIM_DMA_CHANNELS];
+} SimDmaRegs;
+
+extern SimTimerRegs simTimer[SIM_TIMERS];
+extern SimPortRegs simPort[SIM_PORTS];
+extern SimMiscRegs simMisc;
+extern SimDmaRegs simDma;
+
+void *simAccess(void *reg);
+void simWriteAddr(uintptr_t reg, uintptr_t value);
+uint16_t simTimerIV(int timer);
+uint16_t simPortIV(int port);
+
+#define SIM_R8(reg) (*(volatile uint8_t *)simAccess(&(reg)))
+#define SIM_R16(reg) (*(volatile uint16_t *)simAccess(&(reg)))
+
+// Intrinsics
+void simBisSR(unsigned bits);
+void simBicSR(unsigned bits);
+void simBisSROnExit(unsigned bits);
+void simBicSROnExit(unsigned bits);
+unsigned simGetSR(void);
+void simDelayCycles(unsigned long cycles);
+
+// Vector table, generated by Simulator/run.py from the #pragma vector lines
+typedef struct {
+    int vector;
+    void (*isr)(void);
+    const char *name;
+} SimVector;
+
+extern const SimVector simVectors[];
+
+// Control, used by sim_main.c
+void simInit(uint64_t endCycles);
+int simRun(void (*program)(void)); // 0 at the end time, -1 on an unhandled interrupt
+void simDrivePin(uint64_t cycle, int port, int bit, int level);
+void simTrace(FILE *f);
+int simExclusive(const char *a, const char *b, uint64_t deadCycles); // 0 for an unknown output
+int simWire(const char *output, int port, int bit); // 0 for an unknown output or pin
+int simReport(FILE *f, char **budgets, int nBudgets); // number of budgets exceeded and faulty pairs
+uint64_t simNow(void);
+
+#endif
@@ -0,0 +1,209 @@
+// Command line front end of the host simulator, normally started by run.py
+//
+//   sim [--until TIME] [--stimulus FILE] [--drive TIME PIN LEVEL]... [--trace FILE]
+//       [--budget ISR=CYCLES]... [--exclusive OUT,OUT[@TIME]]... [--wire OUT,PIN]...
+//       [--dump SYMBOL[:WORDS]]...
+//
+// TIME is a number with an s, ms, us or cyc suffix. PIN is P1.3 or PJ.0, LEVEL
+// is 0, 1 or z (released). A stimulus file holds one "TIME PIN LEVEL" per line,
+// with # comments. --exclusive takes two timer outputs such as TA0.1,TA0.2 that
+// must never be high together, and that must stay TIME apart (the dead time).
+// --wire drives PIN with a timer output, as a jumper between the two pins would.
+// --dump prints a global variable of the program after the run, as WORDS (default
+// 1) 16-bit words in host byte order: "SYMBOL: w0 w1 ...".
+
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+#include <msp430.h>
+#include "../Common/clock.h"
+
+int simProgramMain(void); // the program's main(), renamed by run.py
+
+static void program(void)
+{
+    simProgramMain();
+}
+
+static void usage(const char *why)
+{
+    fprintf(stderr, "sim: %s\n", why);
+    exit(2);
+}
+
+static uint64_t parseTime(const char *s)
+{
+    char *end;
+    double v = strtod(s, &end);
+
+    if (end == s || v < 0)
+        usage("bad time");
+    if (!strcmp(end, "s"))
+        return (uint64_t)(v * CLOCK_MCLK_HZ + 0.5);
+    if (!strcmp(end, "ms"))
+        return (uint64_t)(v * CLOCK_MCLK_HZ / 1e3 + 0.5);
+    if (!strcmp(end, "us"))
+        return (uint64_t)(v * CLOCK_MCLK_HZ / 1e6 + 0.5);
+    if (!strcmp(end, "cyc"))
+        return (uint64_t)v;
+    usage("time needs an s, ms, us or cyc suffix");
+    return 0;
+}
+
+// P1.3 or PJ.0
+static void parsePin(const char *pin, int *port, int *bit)
+{
+    char *end;
+
+    if ((pin[0] != 'P' && pin[0] != 'p') || !pin[1])
+        usage("bad pin");
+    if (pin[1] == 'J' || pin[1] == 'j') {
+        *port = SIM_PJ;
+        end = (char *)pin + 2;
+    } else {
+        *port = (int)strtol(pin + 1, &end, 10) - 1;
+    }
+    if (*end != '.')
+        usage("bad pin");
+    *bit = (int)strtol(end + 1, &end, 10);
+    if (*end)
+        usage("bad pin");
+}
+
+static void drive(const char *time, const char *pin, const char *level)
+{
+    int port, bit, value;
+
+    parsePin(pin, &port, &bit);
+    if (!strcmp(level, "0"))
+        value = 0;
+    else if (!strcmp(level, "1"))
+        value = 1;
+    else if (!strcmp(level, "z") || !strcmp(level, "Z"))
+        value = SIM_Z;
+    else
+        usage("pin level must be 0, 1 or z");
+    simDrivePin(parseTime(time), port, bit, value);
+}
+
+static void exclusive(const char *arg)
+{
+    char a[8], b[8];
+    const char *comma = strchr(arg, ','), *at = strchr(arg, '@');
+    size_t la = comma ? (size_t)(comma - arg) : 0;
+    size_t lb = comma ? (at ? (size_t)(at - comma - 1) : strlen(comma + 1)) : 0;
+
+    if (!la || !lb || la >= sizeof(a) || lb >= sizeof(b))
+        usage("--exclusive takes OUT,OUT[@TIME]");
+    memcpy(a, arg, la);
+    a[la] = 0;
+    memcpy(b, comma + 1, lb);
+    b[lb] = 0;
+    if (!simExclusive(a, b, at ? parseTime(at + 1) : 0))
+        usage("--exclusive: unknown timer output");
+}
+
+static void wire(const char *arg)
+{
+    char output[8];
+    const char *comma = strchr(arg, ',');
+    int port, bit;
+
+    if (!comma || comma == arg || (size_t)(comma - arg) >= sizeof(output))
+        usage("--wire takes OUT,PIN");
+    memcpy(output, arg, comma - arg);
+    output[comma - arg] = 0;
+    parsePin(comma + 1, &port, &bit);
+    if (!simWire(output, port, bit))
+        usage("--wire: unknown timer output or pin");
+}
+
+// Prints words 16-bit words of the program's global symbol, looked up in the
+// binary's own symbol table (run.py links it with -rdynamic)
+static void dump(const char *arg)
+{
+    char name[64];
+    const char *colon = strchr(arg, ':');
+    size_t len = colon ? (size_t)(colon - arg) : strlen(arg);
+    long words = colon ? strtol(colon + 1, NULL, 10) : 1, i;
+    const uint16_t *p;
+
+    if (!len || len >= sizeof(name) || words < 1)
+        usage("--dump takes SYMBOL[:WORDS]");
+    memcpy(name, arg, len);
+    name[len] = 0;
+    p = dlsym(RTLD_DEFAULT, name);
+    if (!p) {
+        printf("%s: not found\n", name);
+        return;
+    }
+    printf("%s:", name);
+    for (i = 0; i < words; i++)
+        printf(" %u", p[i]);
+    printf("\n");
+}
+
+static void loadStimulus(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+
+    if (!f)
+        usage("cannot open the stimulus file");
+    while (fgets(line, sizeof(line), f)) {
+        char time[64], pin[16], level[8];
+        char *hash = strchr(line, '#');
+        if (hash)
+            *hash = 0;
+        if (sscanf(line, "%63s %15s %7s", time, pin, level) == 3)
+            drive(time, pin, level);
+        else if (strspn(line, " \t\r\n") != strlen(line))
+            usage("stimulus lines are TIME PIN LEVEL");
+    }
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t until = CLOCK_MCLK_HZ; // one second
+    char **budgets = calloc(argc, sizeof(char *)), **dumps = calloc(argc, sizeof(char *));
+    int nBudgets = 0, nDumps = 0, i, result;
+    FILE *trace = NULL;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--until") && i + 1 < argc) {
+            until = parseTime(argv[++i]);
+        } else if (!strcmp(argv[i], "--stimulus") && i + 1 < argc) {
+            loadStimulus(argv[++i]);
+        } else if (!strcmp(argv[i], "--drive") && i + 3 < argc) {
+            drive(argv[i + 1], argv[i + 2], argv[i + 3]);
+            i += 3;
+        } else if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+            trace = fopen(argv[++i], "w");
+            if (!trace)
+                usage("cannot open the trace file");
+            fprintf(trace, "cycle,signal,value\n");
+        } else if (!strcmp(argv[i], "--budget") && i + 1 < argc) {
+            budgets[nBudgets++] = argv[++i];
+        } else if (!strcmp(argv[i], "--exclusive") && i + 1 < argc) {
+            exclusive(argv[++i]);
+        } else if (!strcmp(argv[i], "--wire") && i + 1 < argc) {
+            wire(argv[++i]);
+        } else if (!strcmp(argv[i], "--dump") && i + 1 < argc) {
+            dumps[nDumps++] = argv[++i];
+        } else {
+            usage("unknown argument, see the comment at the top of sim_main.c");
+        }
+    }
+
+    simInit(until);
+    simTrace(trace);
+    result = simRun(program);
+    if (trace)
+        fclose(trace);
+    if (simReport(stdout, budgets, nBudgets))
+        result = 1;
+    for (i = 0; i < nDumps; i++)
+        dump(dumps[i]);
+    return result ? 1 : 0;
+}
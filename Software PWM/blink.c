@@ -0,0 +1,575 @@
+// Software PWM, one source for every board
+// The board is picked by the device define through Common/hal.h
+#include "../Common/hal.h"
+#include "../Common/clock.h"
+#include "../Common/event_queue.h"
+#include "../Common/gesture.h"
+#include "../Common/period.h"
+#include "../Common/portirq.h"
+
+// Software PWM output mode
+// PWM_MODE_POLLING:   main() compares the duty timer with the duty cycle forever
+// PWM_MODE_INTERRUPT: CCR0/CCR1 compare interrupts drive the LED while the CPU sleeps
+// PWM_MODE_SCHEDULER: up to 16 channels share the duty timer through pwm_scheduler.c
+// PWM_MODE_BITMASK:   one precomputed P1OUT byte per time slot through pwm_bitmask.c
+// PWM_MODE_BAM:       bit-angle modulation, one P1OUT bit-plane per brightness bit through pwm_bam.c
+#define PWM_MODE_POLLING   0
+#define PWM_MODE_INTERRUPT 1
+#define PWM_MODE_SCHEDULER 2
+#define PWM_MODE_BITMASK   3
+#define PWM_MODE_BAM       4
+
+#ifndef PWM_MODE
+#define PWM_MODE PWM_MODE_INTERRUPT
+#endif
+
+#define PWM_HZ 1000UL // PWM period rate of the duty timer
+
+#if PWM_MODE == PWM_MODE_SCHEDULER
+#include "pwm_scheduler.h"
+
+// Channels 0-7 drive the spare port of the board, channels 8-15 drive P1 (channel 8 is the red LED)
+#define SCHED_OUT_LO HAL_SPARE_OUT
+#define SCHED_DIR_LO HAL_SPARE_DIR
+#define SCHED_OUT_HI P1OUT
+#define SCHED_LED_CHANNEL 8
+#define SCHED_DEMO_CHANNELS HAL_SPARE_PINS // fixed duty ramp on the spare port
+#define SCHED_DEMO_STEP (PWM_TICKS * 12 / 100) // 12 % of a period in ticks, per demo channel
+
+void schedulerSetup(void);
+#elif PWM_MODE == PWM_MODE_BITMASK
+#include "pwm_bitmask.h"
+
+// Channels are P1 pins, channel 0 is the red LED
+#define BITMASK_PINS HAL_P1_PWM_PINS // every P1 pin the board leaves free
+#define BITMASK_SLOT_TICKS (CLOCK_SMCLK_HZ / (PWM_HZ * BITMASK_SLOTS)) // SMCLK cycles per slot
+#if BITMASK_SLOT_TICKS < 50
+#error "Bitmask slots must be longer than the slot ISR, lower PWM_HZ or raise CLOCK_MHZ"
+#endif
+
+void bitmaskSetup(void);
+#elif PWM_MODE == PWM_MODE_BAM
+#include "pwm_bam.h"
+
+// Channels are P1 pins, channel 0 is the red LED
+#define BAM_PINS HAL_P1_PWM_PINS // every P1 pin the board leaves free
+
+void bamSetup(void);
+#endif
+
+// Polling, interrupt and scheduler modes clock the duty timer from SMCLK / 8 (ID_3),
+// so one tick always covers a few instructions of ISR work
+#define PWM_TICKS (CLOCK_SMCLK_HZ / 8 / PWM_HZ) // duty timer ticks per period
+#if PWM_TICKS >= 0x10000 // CCR0 at most 0xFFFE, so up mode never reaches SCHED_NO_EDGE
+#error "PWM_HZ is too low for a 16-bit duty timer"
+#endif
+
+// Brightness tables come in the duty units of the mode (see Common/brightness.h)
+#if PWM_MODE == PWM_MODE_BITMASK
+#define BRIGHTNESS_TOP BITMASK_SLOTS // slots
+#elif PWM_MODE == PWM_MODE_BAM
+#define BRIGHTNESS_TOP BAM_MAX // BAM levels
+#else
+#define BRIGHTNESS_TOP PWM_TICKS // duty timer ticks
+#endif
+#include "../Common/brightness.h"
+
+// Brightness curve the button steps through
+#ifndef DUTY_TABLE
+#define DUTY_TABLE BRIGHTNESS_TABLE(Linear, 11)
+#endif
+#define DUTY_STEPS BRIGHTNESS_STEPS(DUTY_TABLE)
+
+// Green LED toggle: when it sits on P1 the bitmask and BAM modes rewrite
+// the whole port every slot, so the toggle goes through their static bits
+#if HAL_LED2_ON_P1 && PWM_MODE == PWM_MODE_BITMASK
+#define GREEN_TOGGLE() (bitmaskStatic ^= HAL_LED2_BIT) // P1OUT is rewritten every slot
+#elif HAL_LED2_ON_P1 && PWM_MODE == PWM_MODE_BAM
+#define GREEN_TOGGLE() (bamStatic ^= HAL_LED2_BIT) // P1OUT is rewritten every interval
+#else
+#define GREEN_TOGGLE() (HAL_LED2_OUT ^= HAL_LED2_BIT)
+#endif
+
+void frequencyCalc(const PeriodConfig *p);
+void gestureAction(uint8_t gesture);
+void gestureService(void);
+
+#define DEBOUNCE_HZ 100 // 100 Hz --> 10 ms intervals
+
+// Debounce timer
+// DEBOUNCE_TIMER_TIMER0: timer 0 of Common/hal.h
+// DEBOUNCE_TIMER_WDT:    the watchdog in interval mode through Common/wdt.h, timer 0 stays free
+#define DEBOUNCE_TIMER_TIMER0 0
+#define DEBOUNCE_TIMER_WDT    1
+
+#ifndef DEBOUNCE_TIMER
+#define DEBOUNCE_TIMER DEBOUNCE_TIMER_TIMER0
+#endif
+
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+#include "../Common/wdt.h"
+
+#ifndef WDT_ACLK
+#define WDT_ACLK 0 // 1: the intervals come from ACLK
+#endif
+#define WDT_SMCLK_HZ (WDT_ACLK ? 0 : CLOCK_SMCLK_HZ)
+
+// Watchdog interval and the intervals in one debounce delay, solved at compile time
+static const WdtConfig debounceWdt = WDT_CONFIG(WDT_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+WDT_ASSERT(WDT_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+
+uint16_t wdtLeft; // intervals to the end of the delay
+#define DEBOUNCE_VECTOR WDT_VECTOR
+#else
+// Debounce timer settings, solved at compile time
+static const PeriodConfig debouncePeriod = PERIOD_CONFIG(CLOCK_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+PERIOD_ASSERT(CLOCK_SMCLK_HZ, CLOCK_ACLK_HZ, DEBOUNCE_HZ);
+
+#define DEBOUNCE_VECTOR HAL_TIMER0_VECTOR
+#endif
+
+volatile int state = 0;
+volatile int dutycycle; // duty cycle in BRIGHTNESS_TOP units, loaded from DUTY_TABLE
+#if PWM_MODE == PWM_MODE_INTERRUPT
+int dutyLatched; // dutycycle as of the start of this period, ISRs only
+#endif
+unsigned int dutystep = DUTY_STEPS / 2; // starts halfway along the curve, main() only
+volatile uint16_t pwmPeriods = 0; // PWM periods since reset, the time stamp of button events
+
+// Button gestures (see Common/gesture.h), timed in PWM periods
+#ifndef GESTURE_LONG_MS
+#define GESTURE_LONG_MS 600 // hold for a long press: start ramping to full or off
+#endif
+#ifndef GESTURE_DOUBLE_MS
+#define GESTURE_DOUBLE_MS 0 // 0: a click steps up on release; e.g. 300: the gap for a double-click, one step down
+#endif
+#ifndef GESTURE_REPEAT_MS
+#define GESTURE_REPEAT_MS 100 // ramp step while held after a long press
+#endif
+
+#if PWM_MODE == PWM_MODE_BAM
+#define PERIODS_HZ (CLOCK_SMCLK_HZ / ((uint32_t)BAM_BASE_TICKS * BAM_MAX)) // one count per BAM frame
+#else
+#define PERIODS_HZ PWM_HZ
+#endif
+#define PERIODS_MS(ms) ((uint16_t)((uint32_t)(ms) * PERIODS_HZ / 1000))
+
+Gesture button;
+int rampDown = 0; // direction of the ramp a long press starts
+volatile uint16_t wakeAt; // pwmPeriods value at which the period ISR wakes main()
+volatile uint8_t wakeArmed = 0;
+
+// Counts a PWM period in the period ISRs, and wakes main() when it reaches wakeAt
+#define COUNT_PERIOD() do { \
+		if (++pwmPeriods == wakeAt && wakeArmed) { \
+			wakeArmed = 0; \
+			eventPost(EVENT_PERIOD, 0, pwmPeriods); \
+			__bic_SR_register_on_exit(LPM0_bits); \
+		} \
+	} while (0)
+
+int main(void)
+{
+    Event e;
+#if PWM_MODE == PWM_MODE_POLLING
+    uint16_t last = 0;
+    int duty; // dutycycle as of the start of this period
+#endif
+
+    WDTCTL = WDTPW | WDTHOLD;   // Stop watchdog timer
+    eventInit();
+    gestureInit(&button, PERIODS_MS(GESTURE_LONG_MS), PERIODS_MS(GESTURE_DOUBLE_MS),
+                PERIODS_MS(GESTURE_REPEAT_MS));
+    dutycycle = DUTY_TABLE[dutystep];
+	halUnlockPins(); // FRAM parts: release the pins from high-impedance mode
+
+	// Button configuration
+    halLedInit(0); // Set both LEDs as output
+    HAL_BTN_REN |= HAL_BTN_BIT; // Connects the on-board resistor to the button
+    HAL_BTN_OUT = HAL_BTN_BIT; // Sets up the button as pull-up resistor
+    
+	// Interrupt Configuration
+    HAL_BTN_IES |= HAL_BTN_BIT; // Interrupts on button release LO TO HI
+    HAL_BTN_IE |= HAL_BTN_BIT; // Enable interrupt on button pin
+    HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear interrupt flag
+
+#if PWM_MODE == PWM_MODE_SCHEDULER
+	schedulerSetup();
+#elif PWM_MODE == PWM_MODE_BITMASK
+	bitmaskSetup();
+#elif PWM_MODE == PWM_MODE_BAM
+	bamSetup();
+#endif
+
+    clockInit(); // MCLK = SMCLK = CLOCK_MHZ (see Common/clock.h)
+
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+    frequencyCalc(0); // duty timer only, the watchdog times the button
+#else
+	// Timer frequency of 100 Hz --> 10 ms intervals
+    frequencyCalc(&debouncePeriod);    // initialize timer to 100Hz
+#endif
+
+    __enable_interrupt(); // MUST BE ENABLED IN ADDITION TO GIE
+#if PWM_MODE != PWM_MODE_POLLING
+	// The duty timer interrupts switch the LED on and off,
+	// so the CPU only wakes up for the two edges of each period
+	// and for the button events the debounce ISR posts
+    while (1) {
+        eventWait(); // LPM0 until the queue holds an event
+        while (eventGet(&e))
+            gestureAction(gestureInput(&button, e.type, e.time));
+        gestureService();
+    }
+#else
+    __bis_SR_register(GIE); // enable global interrupts
+    
+	// Compare the current value of the duty timer
+	// with the duty cycle to determine the rate of LED flicker
+    duty = dutycycle;
+    while (1) {
+        uint16_t now = HAL_TIMER1(R);
+
+        if (now < last) {
+            pwmPeriods++; // the duty timer wrapped, no period ISR in this mode
+            duty = dutycycle; // a gesture mid-period takes effect from the next one
+        }
+        last = now;
+        if(now <= duty) 
+            HAL_LED1_OUT ^= HAL_LED1_BIT;
+        else
+            HAL_LED1_OUT &= ~HAL_LED1_BIT;
+        if (eventGet(&e))
+            gestureAction(gestureInput(&button, e.type, e.time));
+        gestureService();
+    }
+#endif
+
+}
+
+// Sets up the timer compare value to 
+void frequencyCalc(const PeriodConfig *p)
+{
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+    wdtEnable(); // watchdog interval interrupt enabled, the watchdog stays held until a press
+#else
+    HAL_TIMER0(CCR0) = p->ccr0; // ex. 100 Hz at 16 MHz --> 160000 cycles, /3 --> CCR0 = 53332
+#if PERIOD_HAS_IDEX
+    HAL_TIMER0(EX0) = p->ex; // expansion divider, latched by the next TACLR/TBCLR
+#endif
+    HAL_TIMER0(CCTL0) = CCIE; // capture compare interrupt enabled
+#endif
+    
+    // Duty cycle timer
+#if PWM_MODE == PWM_MODE_BITMASK
+    HAL_TIMER1(CCR0) = BITMASK_SLOT_TICKS - 1; // one CCR0 interrupt per slot
+    HAL_TIMER1(CCTL0) = CCIE; // slot interrupt
+    HAL_TIMER1(CTL) = HAL_TIMER_SMCLK + MC_1 + HAL_TIMER_CLR;
+#elif PWM_MODE == PWM_MODE_BAM
+    HAL_TIMER1(CCR0) = BAM_BASE_TICKS; // end of the first interval
+    HAL_TIMER1(CCTL0) = CCIE; // interval interrupt
+    HAL_TIMER1(CTL) = HAL_TIMER_SMCLK + MC_2 + HAL_TIMER_CLR; // continuous mode, CCR0 moves ahead every interval
+#else
+    HAL_TIMER1(CCR0) = PWM_TICKS - 1; // one period per PWM_HZ
+#if PWM_MODE != PWM_MODE_POLLING
+#if PWM_MODE == PWM_MODE_SCHEDULER
+    HAL_TIMER1(CCR1) = SCHED_NO_EDGE; // first edge is armed at the start of the period
+#else
+    HAL_TIMER1(CCR1) = dutycycle; // first duty edge
+#endif
+    HAL_TIMER1(CCTL0) = CCIE; // period edge interrupt
+    HAL_TIMER1(CCTL1) = CCIE; // duty edge interrupt
+#endif
+    // ID_3 gives 8 SMCLK cycles per tick, which leaves room for both ISRs between the edges
+    HAL_TIMER1(CTL) = HAL_TIMER_SMCLK + MC_1 + ID_3 + HAL_TIMER_CLR;
+#endif
+}
+
+// Runs in main() for every gesture of the button
+// Click: one step up, back to off after full brightness. Double-click: one step down.
+// Long press: start ramping to full, or to off from half and above. Repeat: one more
+// step of that ramp, until it reaches the end; it stays there until the release.
+void gestureAction(uint8_t gesture)
+{
+	switch (gesture) {
+	case GESTURE_CLICK:
+		if (++dutystep >= DUTY_STEPS)
+			dutystep = 0;
+		break;
+	case GESTURE_DOUBLE:
+		if (dutystep > 0)
+			dutystep--;
+		break;
+	case GESTURE_LONG:
+		rampDown = dutystep >= DUTY_STEPS / 2;
+		// fall through: the long press is the first step of the ramp
+	case GESTURE_REPEAT:
+		if (rampDown && dutystep > 0)
+			dutystep--;
+		else if (!rampDown && dutystep < DUTY_STEPS - 1)
+			dutystep++;
+		else
+			return; // at the end of the ramp, nothing changes
+		break;
+	default:
+		return;
+	}
+
+	dutycycle = DUTY_TABLE[dutystep];
+#if PWM_MODE == PWM_MODE_SCHEDULER
+	schedSetDuty(SCHED_LED_CHANNEL, dutycycle);
+	schedCommit();
+#elif PWM_MODE == PWM_MODE_BITMASK
+	bitmaskSetDuty(0, dutycycle);
+#elif PWM_MODE == PWM_MODE_BAM
+	bamSetBrightness(0, dutycycle);
+	bamCommit();
+#endif
+	GREEN_TOGGLE(); // Blink green LED on every gesture
+}
+
+// Runs in main() after the queue is empty: feeds the gesture deadlines that are due,
+// then arms the period ISR for the next one
+//
+// Arming goes off, stamp, on, check, so a deadline the ISR can no longer match is
+// handled here, and one the ISR also posts arrives early and is ignored.
+void gestureService(void)
+{
+	while (1) {
+		wakeArmed = 0;
+		if (!gestureWaiting(&button))
+			return;
+		wakeAt = button.deadline;
+		wakeArmed = 1;
+		if ((int16_t)(pwmPeriods - wakeAt) < 0)
+			return; // not due yet, the period ISR wakes main() at wakeAt
+		gestureAction(gestureInput(&button, EVENT_PERIOD, pwmPeriods));
+	}
+}
+
+// Button pin handler, run by PORT_Button
+// Called whenever button is pressed
+static void buttonEdge(void)
+{
+
+    // HAL_TIMER0(CTL) = Timer A0 (Timer B0 on the FR2311) chosen for use
+    // debouncePeriod.ctl selects the clock source and ID divider
+    // MC_1 Count-up mode
+	// HAL_TIMER_CLR clears the timer register
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	wdtLeft = debounceWdt.intervals;
+	wdtStart(&debounceWdt); // Begin the delay right away, from a cleared watchdog count
+#else
+	HAL_TIMER0(CTL) = debouncePeriod.ctl + MC_1 + HAL_TIMER_CLR; // Begin timer right away
+#endif
+	
+    HAL_BTN_IE &= ~HAL_BTN_BIT;  // Disable interrupts to prevent false alarm, the dispatch cleared the flag
+
+}
+
+// Handlers of the button port's pins, more buttons or encoder lines on the port add theirs
+static const PortHandler buttonPins[8] = { [HAL_BTN_PIN] = buttonEdge };
+
+// Interrupt subroutine
+// Called while a pin of the button port is pending, one pin per call (see Common/portirq.h)
+#pragma vector = HAL_BTN_VECTOR
+__interrupt void PORT_Button(void)
+{
+	PORT_DISPATCH(HAL_BTN_PORT, buttonPins);
+}
+
+// Interrupt subroutine
+// Called when the debounce timer reaches CCR0, or at every watchdog interval
+#pragma vector = DEBOUNCE_VECTOR
+__interrupt void Timer_Debounce(void)
+{
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	if (--wdtLeft)
+		return; // Delay not over yet
+#endif
+
+	// This switch is the logic for determining the status of the button
+	// On press, the case 0 loop is entered, and on release the case 1 loop is entered
+	
+	switch(state) {
+	
+	case 0:
+		eventPost(EVENT_PRESS, 0, pwmPeriods); // main() turns it into a gesture
+		HAL_BTN_IES &= ~HAL_BTN_BIT; // Set edge HI to LO
+		state = 1;
+		break;
+	case 1:
+		eventPost(EVENT_RELEASE, 0, pwmPeriods);
+		HAL_BTN_IFG &= ~HAL_BTN_BIT; // Clear flag
+		HAL_BTN_IES |= HAL_BTN_BIT; // Set Edge LO to HI
+		state = 0;
+		break;
+	}
+	
+	HAL_BTN_IE |= HAL_BTN_BIT; // Reenable interrupts
+#if DEBOUNCE_TIMER == DEBOUNCE_TIMER_WDT
+	wdtStop(); // Hold the watchdog
+#else
+	HAL_TIMER0(CTL) &= ~MC_3; // Stop timer
+	HAL_TIMER0(CTL) |= HAL_TIMER_CLR; // Clear Timer
+#endif
+	__bic_SR_register_on_exit(LPM0_bits); // Wake main() to take the event
+}
+
+#if PWM_MODE == PWM_MODE_INTERRUPT
+// Interrupt subroutine
+// Called when the duty timer reaches CCR0 (start of a new PWM period)
+#pragma vector = HAL_TIMER1_VECTOR
+__interrupt void Timer_Period(void)
+{
+	COUNT_PERIOD();
+	dutyLatched = dutycycle;
+	if (dutyLatched > 0)
+		HAL_LED1_OUT |= HAL_LED1_BIT; // turn red LED on
+	
+	// Latch the duty cycle once per period so a button press
+	// can never shorten or stretch the pulse already in progress
+	HAL_TIMER1(CCR1) = dutyLatched;
+}
+
+// Interrupt subroutine
+// Called when the duty timer reaches CCR1 (end of the on time)
+#pragma vector = HAL_TIMER1_IV_VECTOR
+__interrupt void Timer_Duty(void)
+{
+	switch (__even_in_range(HAL_TIMER1(IV), 14)) {
+	case 2: // CCR1
+		if (dutyLatched < PWM_TICKS) // the latched value, a new one waits for the next period
+			HAL_LED1_OUT &= ~HAL_LED1_BIT; // turn red LED off
+		break;
+	default:
+		break;
+	}
+}
+#elif PWM_MODE == PWM_MODE_SCHEDULER
+#ifdef SCHED_BENCHMARK
+unsigned int schedCycles[4]; // scheduler cycles per period for 1, 4, 8 and 16 channels
+#endif
+
+// Sets up the scheduler outputs: the red LED follows the button
+// and the demo channels get a fixed ramp of duty cycles
+void schedulerSetup(void)
+{
+	unsigned char i;
+	uint16_t demo = 0; // channel i gets 12 % more than channel i - 1
+
+	halSpareInit(); // route the whole spare port to general I/O
+	SCHED_DIR_LO |= SCHED_DEMO_CHANNELS; // Set demo channels as output
+	SCHED_OUT_LO &= (unsigned char)~SCHED_DEMO_CHANNELS;
+	
+	schedInit(PWM_TICKS); // CCR0 + 1 ticks per period
+
+#ifdef SCHED_BENCHMARK
+	// Time one period of scheduler work with the debounce timer counting MCLK cycles
+	HAL_TIMER0(CTL) = HAL_TIMER_SMCLK + MC_2 + HAL_TIMER_CLR;
+	schedCycles[0] = schedBenchmark(1, &HAL_TIMER0(R));
+	schedCycles[1] = schedBenchmark(4, &HAL_TIMER0(R));
+	schedCycles[2] = schedBenchmark(8, &HAL_TIMER0(R));
+	schedCycles[3] = schedBenchmark(16, &HAL_TIMER0(R));
+	HAL_TIMER0(CTL) = 0; // Stop timer
+#endif
+
+	for (i = 0; i < 8; i++) {
+		demo += SCHED_DEMO_STEP;
+		if (SCHED_DEMO_CHANNELS & (1 << i))
+			schedSetDuty(i, demo);
+		else
+			schedSetDuty(i, 0);
+	}
+	schedSetDuty(SCHED_LED_CHANNEL, dutycycle);
+	schedCommit();
+}
+
+// Interrupt subroutine
+// Called when the duty timer reaches CCR0 (start of a new PWM period)
+#pragma vector = HAL_TIMER1_VECTOR
+__interrupt void Timer_Period(void)
+{
+	unsigned int on = schedPeriodStart(); // also commits pending duty changes
+	
+	COUNT_PERIOD();
+	SCHED_OUT_LO |= (unsigned char)on;
+	SCHED_OUT_HI |= (unsigned char)(on >> 8);
+	HAL_TIMER1(CCR1) = schedNextTime(); // arm the first edge
+}
+
+// Interrupt subroutine
+// Called when the duty timer reaches CCR1 (one or more channels turn off)
+#pragma vector = HAL_TIMER1_IV_VECTOR
+__interrupt void Timer_Duty(void)
+{
+	unsigned int off;
+
+	switch (__even_in_range(HAL_TIMER1(IV), 14)) {
+	case 2: // CCR1
+		off = schedEdge();
+		SCHED_OUT_LO &= ~(unsigned char)off;
+		SCHED_OUT_HI &= ~(unsigned char)(off >> 8);
+		HAL_TIMER1(CCR1) = schedNextTime(); // arm the next edge
+		break;
+	default:
+		break;
+	}
+}
+#elif PWM_MODE == PWM_MODE_BITMASK
+// Sets up the bitmask outputs: the red LED follows the button
+// and the other channels get a fixed ramp of duty cycles
+void bitmaskSetup(void)
+{
+	unsigned char i;
+
+	P1DIR |= BITMASK_PINS; // Set channels as output
+	bitmaskInit(BITMASK_PINS, HAL_P1_PULLUPS); // button pull-up stays selected
+	
+	for (i = 1; i < 8; i++) {
+		if (BITMASK_PINS & (1 << i))
+			bitmaskSetDuty(i, i * 12);
+	}
+	bitmaskSetDuty(0, dutycycle);
+}
+
+// Interrupt subroutine
+// Called when the duty timer reaches CCR0 (start of the next slot)
+#pragma vector = HAL_TIMER1_VECTOR
+__interrupt void Timer_Period(void)
+{
+	P1OUT = bitmaskNextSlot(); // every channel in one store
+	if (bitmaskSlot == bitmaskTable)
+		COUNT_PERIOD(); // the last slot of a period
+}
+#elif PWM_MODE == PWM_MODE_BAM
+// Sets up the BAM outputs: the red LED follows the button
+// and the other channels get a fixed ramp of brightness levels
+void bamSetup(void)
+{
+	unsigned char i;
+
+	P1DIR |= BAM_PINS; // Set channels as output
+	bamInit(BAM_PINS, HAL_P1_PULLUPS); // button pull-up stays selected
+	
+	for (i = 1; i < 8; i++) {
+		if (BAM_PINS & (1 << i))
+			bamSetBrightness(i, (BAM_MAX >> (8 - i)));
+	}
+	bamSetBrightness(0, dutycycle);
+	bamCommit();
+}
+
+// Interrupt subroutine
+// Called when the duty timer reaches CCR0 (start of the next bit interval)
+#pragma vector = HAL_TIMER1_VECTOR
+__interrupt void Timer_Period(void)
+{
+	uint16_t ticks;
+	
+	P1OUT = bamNextPlane(&ticks); // every channel in one store
+	HAL_TIMER1(CCR0) += ticks; // binary weighted interval length
+	if (bamBit == 0)
+		COUNT_PERIOD(); // the last interval of a frame
+}
+#endif
@@ -0,0 +1,68 @@
+// Bit-angle modulation (BAM) software PWM (see pwm_bam.h)
+
+#include "pwm_bam.h"
+
+uint8_t bamPlane[2][BAM_BITS];
+volatile uint8_t bamActive = 0;
+volatile uint8_t bamPending = 0;
+volatile uint8_t bamStatic = 0;
+uint8_t bamBit = 0;
+const uint8_t *bamFrame = bamPlane[0];
+uint16_t bamInterval = BAM_BASE_TICKS;
+
+static uint8_t bamPins;
+static uint16_t bamLevel[8];
+
+// Turns every channel off and sets the value of the non-BAM pins
+void bamInit(uint8_t pins, uint8_t staticBits)
+{
+    uint8_t i;
+
+    for (i = 0; i < BAM_BITS; i++) {
+        bamPlane[0][i] = 0;
+        bamPlane[1][i] = 0;
+    }
+    for (i = 0; i < 8; i++)
+        bamLevel[i] = 0;
+
+    bamPins = pins;
+    bamStatic = staticBits & ~pins;
+    bamActive = 0;
+    bamFrame = bamPlane[0];
+    bamPending = 0;
+    bamBit = 0;
+}
+
+// Sets the brightness of one pin (0 to BAM_MAX). Takes effect on bamCommit().
+void bamSetBrightness(uint8_t pin, uint16_t level)
+{
+    if (pin > 7 || !(bamPins & (1 << pin)))
+        return;
+
+    bamLevel[pin] = level > BAM_MAX ? BAM_MAX : level;
+}
+
+// Rebuilds the bit-planes into the inactive buffer; the ISR swaps it in at
+// the start of the next frame
+//
+// Costs BAM_BITS x 8 shift-and-test steps, independent of the old values.
+void bamCommit(void)
+{
+    uint8_t *plane;
+    uint8_t b, pin;
+
+    bamPending = 0;
+    plane = bamPlane[bamActive ^ 1];
+
+    for (b = 0; b < BAM_BITS; b++) {
+        uint8_t bits = 0;
+
+        for (pin = 0; pin < 8; pin++) {
+            if (bamLevel[pin] & (1 << b))
+                bits |= 1 << pin;
+        }
+        plane[b] = bits;
+    }
+
+    bamPending = 1;
+}
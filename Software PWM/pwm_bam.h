@@ -0,0 +1,66 @@
+// Bit-angle modulation (BAM) software PWM
+//
+// An N-bit brightness frame is split into N intervals whose lengths are the
+// binary weights 1, 2, 4 ... 2^(N-1) times BAM_BASE_TICKS. During interval b a
+// pin is high if bit b of its brightness is set. The timer therefore fires only
+// N times per frame, and each ISR writes one precomputed bit-plane to the port.
+//
+// Brightness changes are built into a second set of bit-planes and swapped in
+// at the start of the next frame, so a frame never mixes old and new values.
+// Pins outside the channel mask come from bamStatic, as in pwm_bitmask.h.
+
+#ifndef PWM_BAM_H
+#define PWM_BAM_H
+
+#include <stdint.h>
+
+// Brightness resolution in bits (1 to 12)
+#ifndef BAM_BITS
+#define BAM_BITS 8
+#endif
+
+// Timer ticks of the shortest (bit 0) interval, must exceed the BAM ISR
+#ifndef BAM_BASE_TICKS
+#define BAM_BASE_TICKS 100
+#endif
+
+#define BAM_MAX ((1 << BAM_BITS) - 1)
+
+#if (BAM_BASE_TICKS << (BAM_BITS - 1)) > 0xFFFF
+#error "Longest BAM interval does not fit the 16-bit timer"
+#endif
+
+extern uint8_t bamPlane[2][BAM_BITS];
+extern volatile uint8_t bamActive;
+extern volatile uint8_t bamPending;
+extern volatile uint8_t bamStatic;
+extern uint8_t bamBit;
+extern const uint8_t *bamFrame;
+extern uint16_t bamInterval;
+
+void bamInit(uint8_t pins, uint8_t staticBits);
+void bamSetBrightness(uint8_t pin, uint16_t level);
+void bamCommit(void);
+
+// Called from the BAM ISR (a CCR in continuous mode). Returns the port byte for
+// the interval that starts now and stores the interval length in *ticks, to be
+// added to the CCR.
+static inline uint8_t bamNextPlane(uint16_t *ticks)
+{
+    uint8_t b = bamBit;
+
+    if (b == 0) {
+        if (bamPending) {
+            bamActive ^= 1;
+            bamFrame = bamPlane[bamActive];
+            bamPending = 0;
+        }
+        bamInterval = BAM_BASE_TICKS;
+    }
+    *ticks = bamInterval;
+    bamInterval <<= 1;
+    bamBit = (b + 1 == BAM_BITS) ? 0 : b + 1;
+    return bamFrame[b] | bamStatic;
+}
+
+#endif
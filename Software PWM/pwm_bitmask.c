@@ -0,0 +1,54 @@
+// Port-wide bitmask software PWM (see pwm_bitmask.h)
+
+#include "pwm_bitmask.h"
+
+uint8_t bitmaskTable[BITMASK_SLOTS];
+const uint8_t *bitmaskSlot = bitmaskTable;
+volatile uint8_t bitmaskStatic = 0;
+
+static uint8_t bitmaskPins;
+static uint8_t bitmaskDuty[8];
+
+// Clears the table (all channels off) and sets the value of the non-PWM pins
+void bitmaskInit(uint8_t pins, uint8_t staticBits)
+{
+    uint8_t i;
+
+    for (i = 0; i < BITMASK_SLOTS; i++)
+        bitmaskTable[i] = 0;
+    for (i = 0; i < 8; i++)
+        bitmaskDuty[i] = 0;
+
+    bitmaskPins = pins;
+    bitmaskStatic = staticBits & ~pins;
+    bitmaskSlot = bitmaskTable;
+}
+
+// Sets the number of slots (0 to BITMASK_SLOTS) a pin is high for
+//
+// Only the slots between the old and the new duty cycle change, so the cost is
+// proportional to the size of the step, not to the table size. Each slot is
+// updated with a single XOR, which the slot ISR can never observe half done.
+void bitmaskSetDuty(uint8_t pin, uint8_t duty)
+{
+    uint8_t bit = 1 << pin;
+    uint8_t from, to;
+
+    if (pin > 7 || !(bitmaskPins & bit))
+        return;
+    if (duty > BITMASK_SLOTS)
+        duty = BITMASK_SLOTS;
+
+    if (duty > bitmaskDuty[pin]) {
+        from = bitmaskDuty[pin];
+        to = duty;
+    }
+    else {
+        from = duty;
+        to = bitmaskDuty[pin];
+    }
+    bitmaskDuty[pin] = duty;
+
+    while (from < to)
+        bitmaskTable[from++] ^= bit;
+}
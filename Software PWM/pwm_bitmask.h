@@ -0,0 +1,39 @@
+// Port-wide bitmask software PWM
+//
+// Every time slot of the PWM period has a precomputed output byte holding the
+// state of all PWM pins of one port. The slot ISR does one table load and one
+// PxOUT store, so its cost does not depend on how many pins are driven, and all
+// pins change in the same instruction.
+//
+// Pins that are not PWM channels (pull-up selects, status LEDs) are kept in
+// bitmaskStatic, which the ISR ORs into every slot. Change those pins through
+// bitmaskStatic instead of writing PxOUT directly.
+
+#ifndef PWM_BITMASK_H
+#define PWM_BITMASK_H
+
+#include <stdint.h>
+
+// Time slots per PWM period, which is also the duty resolution (at most 255)
+#ifndef BITMASK_SLOTS
+#define BITMASK_SLOTS 100
+#endif
+
+extern uint8_t bitmaskTable[BITMASK_SLOTS];
+extern const uint8_t *bitmaskSlot;
+extern volatile uint8_t bitmaskStatic;
+
+void bitmaskInit(uint8_t pins, uint8_t staticBits);
+void bitmaskSetDuty(uint8_t pin, uint8_t duty);
+
+// Called from the slot ISR: returns the port byte for this slot and advances
+static inline uint8_t bitmaskNextSlot(void)
+{
+    uint8_t out = *bitmaskSlot | bitmaskStatic;
+
+    if (++bitmaskSlot == &bitmaskTable[BITMASK_SLOTS])
+        bitmaskSlot = bitmaskTable;
+    return out;
+}
+
+#endif
@@ -0,0 +1,122 @@
+// Multi-channel software PWM scheduler (see pwm_scheduler.h)
+
+#include "pwm_scheduler.h"
+
+SchedTable schedTable[2];
+const SchedEdge *schedCursor = schedTable[0].edge;
+volatile uint8_t schedActive = 0;
+volatile uint8_t schedPending = 0;
+
+static uint16_t schedPeriod;
+static uint16_t schedDuty[SCHED_MAX_CHANNELS];
+
+// Sets the period (CCR0 + 1) and turns every channel off
+void schedInit(uint16_t period)
+{
+    uint8_t i;
+
+    schedPeriod = period;
+    for (i = 0; i < SCHED_MAX_CHANNELS; i++)
+        schedDuty[i] = 0;
+
+    schedTable[0].edge[0].time = SCHED_NO_EDGE;
+    schedTable[0].edge[0].mask = 0;
+    schedTable[0].on = 0;
+    schedTable[1] = schedTable[0];
+    schedCursor = schedTable[0].edge;
+    schedActive = 0;
+    schedPending = 0;
+}
+
+// Sets the on time of one channel in timer ticks. Takes effect on schedCommit().
+// On times within SCHED_MIN_GAP of either end of the period are rounded to
+// fully off or fully on, which keeps every edge clear of the CCR0 ISR.
+void schedSetDuty(uint8_t channel, uint16_t duty)
+{
+    if (channel >= SCHED_MAX_CHANNELS)
+        return;
+
+    if (duty > schedPeriod - SCHED_MIN_GAP)
+        duty = schedPeriod;
+    else if (duty < SCHED_MIN_GAP)
+        duty = duty ? SCHED_MIN_GAP : 0;
+
+    schedDuty[channel] = duty;
+}
+
+// Rebuilds the edge table from the current duty cycles
+//
+// Runs in O(n^2) for n channels (insertion sort), which is at most a few
+// hundred cycles for 16 channels. Call it from the foreground or from a low
+// rate ISR, never from the PWM ISRs themselves.
+void schedCommit(void)
+{
+    SchedTable *t;
+    uint8_t order[SCHED_MAX_CHANNELS];
+    uint8_t n = 0;
+    uint8_t e = 0;
+    uint8_t i, j;
+
+    // Cancel a commit the CCR0 ISR has not picked up yet, then
+    // build into whichever table the ISR is not reading
+    schedPending = 0;
+    t = &schedTable[schedActive ^ 1];
+    t->on = 0;
+
+    // Sort the channels that switch off inside the period by on time
+    for (i = 0; i < SCHED_MAX_CHANNELS; i++) {
+        if (schedDuty[i] == 0)
+            continue;
+        t->on |= 1u << i;
+        if (schedDuty[i] >= schedPeriod)
+            continue; // on for the whole period, no edge
+        for (j = n; j > 0 && schedDuty[order[j - 1]] > schedDuty[i]; j--)
+            order[j] = order[j - 1];
+        order[j] = i;
+        n++;
+    }
+
+    // One edge per distinct turn-off time; a channel closer than
+    // SCHED_MIN_GAP to the previous edge joins that edge
+    for (i = 0; i < n; i++) {
+        uint16_t time = schedDuty[order[i]];
+
+        if (e > 0 && time - t->edge[e - 1].time < SCHED_MIN_GAP) {
+            t->edge[e - 1].mask |= 1u << order[i];
+        }
+        else {
+            t->edge[e].time = time;
+            t->edge[e].mask = 1u << order[i];
+            e++;
+        }
+    }
+    t->edge[e].time = SCHED_NO_EDGE;
+    t->edge[e].mask = 0;
+
+    schedPending = 1;
+}
+
+#ifdef SCHED_BENCHMARK
+// Measures the scheduler work for one full period with the given number of
+// channels, each on its own edge where the period allows it
+//
+// counter must point at a timer register that counts MCLK cycles (for example
+// TA0R with TASSEL_2, ID_0 and MC_2). The result excludes the interrupt entry,
+// RETI and the port writes done by the board code.
+uint16_t schedBenchmark(uint8_t channels, volatile uint16_t *counter)
+{
+    uint16_t start;
+    uint16_t step = schedPeriod / (channels + 1);
+    uint8_t i;
+
+    for (i = 0; i < SCHED_MAX_CHANNELS; i++)
+        schedSetDuty(i, i < channels ? step * (i + 1) : 0);
+    schedCommit();
+
+    start = *counter;
+    schedPeriodStart();
+    while (schedNextTime() != SCHED_NO_EDGE)
+        schedEdge();
+    return *counter - start;
+}
+#endif
@@ -0,0 +1,83 @@
+// Multi-channel software PWM scheduler
+//
+// Drives up to 16 PWM channels from one timer running in up mode. CCR0 marks
+// the start of every period and CCR1 is reprogrammed to the next edge, so each
+// period costs one CCR0 interrupt plus one CCR1 interrupt per distinct edge
+// (channels with the same turn-off time share an edge).
+//
+// Channel n drives bit n of a 16-bit output mask. The board code maps the low
+// byte to one port and the high byte to another.
+//
+// Foreground code calls schedSetDuty() for every channel that changed and then
+// schedCommit(), which sorts the edges into the inactive half of a double
+// buffered table. The CCR0 ISR swaps tables at the next period boundary, so
+// the ISRs never see a half built table.
+
+#ifndef PWM_SCHEDULER_H
+#define PWM_SCHEDULER_H
+
+#include <stdint.h>
+
+#define SCHED_MAX_CHANNELS 16
+
+// Smallest distance between two edges, and between an edge and either end of
+// the period, in timer ticks. Edges closer than this are merged so that CCR1
+// is never programmed with a count the timer has already passed. Must cover
+// the worst-case run time of the CCR1 ISR.
+#ifndef SCHED_MIN_GAP
+#define SCHED_MIN_GAP 8
+#endif
+
+// Compare value that up mode never reaches: parks CCR1 until the next period.
+// That holds while CCR0 is below it, so a period is at most 0xFFFF ticks.
+#define SCHED_NO_EDGE 0xFFFF
+
+typedef struct {
+    uint16_t time; // timer count at which the channels switch off
+    uint16_t mask; // channels that switch off at this count
+} SchedEdge;
+
+typedef struct {
+    SchedEdge edge[SCHED_MAX_CHANNELS + 1]; // sorted by time, ends with SCHED_NO_EDGE
+    uint16_t on; // channels switched on at the start of the period
+} SchedTable;
+
+extern SchedTable schedTable[2];
+extern const SchedEdge *schedCursor;
+extern volatile uint8_t schedActive;
+extern volatile uint8_t schedPending;
+
+void schedInit(uint16_t period);
+void schedSetDuty(uint8_t channel, uint16_t duty);
+void schedCommit(void);
+
+#ifdef SCHED_BENCHMARK
+uint16_t schedBenchmark(uint8_t channels, volatile uint16_t *counter);
+#endif
+
+// Called from the CCR0 ISR. Swaps in a freshly committed table and returns
+// the channels that switch on for this period.
+static inline uint16_t schedPeriodStart(void)
+{
+    if (schedPending) {
+        schedActive ^= 1;
+        schedPending = 0;
+    }
+    schedCursor = schedTable[schedActive].edge;
+    return schedTable[schedActive].on;
+}
+
+// Compare value for CCR1: the next edge, or SCHED_NO_EDGE when the period has none left
+static inline uint16_t schedNextTime(void)
+{
+    return schedCursor->time;
+}
+
+// Called from the CCR1 ISR. Returns the channels that switch off at this
+// edge and advances to the next one.
+static inline uint16_t schedEdge(void)
+{
+    return (schedCursor++)->mask;
+}
+
+#endif